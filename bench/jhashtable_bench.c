@@ -0,0 +1,1221 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include "../include/jhashtable.h"
+
+////////////////////////////////////////////////////////////////////////////////
+/// Allocation Counter
+////////////////////////////////////////////////////////////////////////////////
+
+// 링크 시 --wrap 옵션으로 malloc, calloc, free 를 아래 함수로 연결한다.
+// 여러 스레드 측정에서도 횟수가 맞도록 원자적으로 증가시킨다.
+void* __real_malloc(size_t size);
+void* __real_calloc(size_t count, size_t size);
+void __real_free(void *ptr);
+
+static unsigned long mallocCount = 0;
+static unsigned long freeCount = 0;
+
+void* __wrap_malloc(size_t size)
+{
+	__atomic_fetch_add(&mallocCount, 1, __ATOMIC_RELAXED);
+	return __real_malloc(size);
+}
+
+void* __wrap_calloc(size_t count, size_t size)
+{
+	__atomic_fetch_add(&mallocCount, 1, __ATOMIC_RELAXED);
+	return __real_calloc(count, size);
+}
+
+void __wrap_free(void *ptr)
+{
+	if(ptr != NULL) __atomic_fetch_add(&freeCount, 1, __ATOMIC_RELAXED);
+	__real_free(ptr);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Benchmark Utilities
+////////////////////////////////////////////////////////////////////////////////
+
+// 측정 결과 구조체
+typedef struct _bench_result_t {
+	// 연산 한 번의 평균 시간(ns)
+	double nsPerOp;
+	// 측정 구간의 malloc, calloc 호출 횟수
+	unsigned long mallocs;
+	// 측정 구간의 free 호출 횟수
+	unsigned long frees;
+} BenchResult;
+
+static unsigned long mallocStart = 0;
+static unsigned long freeStart = 0;
+static struct timespec timeStart;
+
+static void BenchBegin(void)
+{
+	mallocStart = mallocCount;
+	freeStart = freeCount;
+	clock_gettime(CLOCK_MONOTONIC, &timeStart);
+}
+
+static BenchResult BenchEnd(int opCount)
+{
+	struct timespec timeEnd;
+	clock_gettime(CLOCK_MONOTONIC, &timeEnd);
+
+	BenchResult result;
+	double elapsed = (double)(timeEnd.tv_sec - timeStart.tv_sec) * 1e9 + (double)(timeEnd.tv_nsec - timeStart.tv_nsec);
+	result.nsPerOp = elapsed / (double)opCount;
+	result.mallocs = mallocCount - mallocStart;
+	result.frees = freeCount - freeStart;
+	return result;
+}
+
+static void BenchPrint(const char *mode, const char *operation, int opCount, BenchResult result)
+{
+	printf("%-8s %-14s %10d %10.1f %12lu %12lu\n", mode, operation, opCount, result.nsPerOp, result.mallocs, result.frees);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Benchmarks
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static void BenchNodePool(int count, int useNodePool)
+ * @brief 노드 메모리 풀 사용 여부에 따른 삽입, 삭제, 반복 삽입/삭제 성능과 할당 횟수를 측정하는 함수
+ * @param count 데이터 개수(입력)
+ * @param useNodePool 노드 메모리 풀 사용 여부(입력)
+ * @return 반환값 없음
+ */
+static void BenchNodePool(int count, int useNodePool)
+{
+	const char *mode = (useNodePool != 0) ? "pool" : "malloc";
+	int *keys = (int*)malloc(sizeof(int) * (size_t)count);
+	int index = 0;
+	int round = 0;
+	BenchResult result;
+
+	for(index = 0; index < count; index++) keys[index] = index;
+
+	JHashTableOption option;
+	JHashTableInitOption(&option);
+	option.useNodePool = useNodePool;
+	JHashTablePtr table = NewJHashTableWithOption(count, IntType, IntType, &option);
+	if(table == NULL)
+	{
+		free(keys);
+		return;
+	}
+
+	BenchBegin();
+	for(index = 0; index < count; index++) JHashTableAddData(table, &keys[index], &keys[index]);
+	BenchPrint(mode, "insert", count, BenchEnd(count));
+
+	BenchBegin();
+	for(index = 0; index < count; index++) JHashTableDeleteData(table, &keys[index], &keys[index]);
+	BenchPrint(mode, "delete", count, BenchEnd(count));
+
+	// 삽입과 삭제를 반복해서 노드 재사용 효과를 측정
+	BenchBegin();
+	for(round = 0; round < 4; round++)
+	{
+		for(index = 0; index < count; index++) JHashTableAddData(table, &keys[index], &keys[index]);
+		for(index = 0; index < count; index++) JHashTableDeleteData(table, &keys[index], &keys[index]);
+	}
+	result = BenchEnd(count * 8);
+	BenchPrint(mode, "churn", count * 8, result);
+
+	DeleteJHashTable(&table);
+	free(keys);
+}
+
+/**
+ * @fn static void BenchConstruction(int size)
+ * @brief 지정한 Bucket 개수의 해쉬 테이블 생성, 삭제 시간과 할당 횟수를 측정하는 함수
+ * @param size Bucket 개수(입력)
+ * @return 반환값 없음
+ */
+static void BenchConstruction(int size)
+{
+	BenchBegin();
+	JHashTablePtr table = NewJHashTable(size, IntType, IntType);
+	BenchPrint("chain", "create", 1, BenchEnd(1));
+	if(table == NULL) return;
+
+	BenchBegin();
+	DeleteJHashTable(&table);
+	BenchPrint("chain", "destroy", 1, BenchEnd(1));
+}
+
+/**
+ * @fn static void BenchSkewedBuild(int count)
+ * @brief 모든 키가 하나의 Bucket 에 모이는 경우 중복 검사 여부에 따른 적재 시간을 측정하는 함수
+ * @param count 데이터 개수(입력)
+ * @return 반환값 없음
+ */
+static void BenchSkewedBuild(int count)
+{
+	int *keys = (int*)malloc(sizeof(int) * (size_t)count);
+	int index = 0;
+	int checkDuplicate = 0;
+
+	for(index = 0; index < count; index++) keys[index] = index;
+
+	JHashTableOption option;
+	JHashTableInitOption(&option);
+	option.loadFactor = 0;
+
+	for(checkDuplicate = 1; checkDuplicate >= 0; checkDuplicate--)
+	{
+		JHashTablePtr table = NewJHashTableWithOption(1, IntType, IntType, &option);
+		if(table == NULL) break;
+
+		BenchBegin();
+		for(index = 0; index < count; index++)
+		{
+			if(checkDuplicate != 0) JHashTableAddData(table, &keys[index], &keys[index]);
+			else JHashTableAddUnchecked(table, &keys[index], &keys[index]);
+		}
+		BenchPrint((checkDuplicate != 0) ? "checked" : "unchkd", "skewed", count, BenchEnd(count));
+
+		DeleteJHashTable(&table);
+	}
+
+	free(keys);
+}
+
+/**
+ * @fn static void BenchIntKeyPattern(int count, int powerOfTwoBuckets)
+ * @brief 연속, 일정 간격, 음수 정수 키에 대해 버킷 위치 계산 방식별 삽입, 검색 성능을 측정하는 함수
+ * 버킷 개수 1024 에서 시작해서 자동 확장하므로 나머지 연산 방식은 버킷 개수 간격의 키가 한 버킷에 모인다.
+ * @param count 데이터 개수(입력)
+ * @param powerOfTwoBuckets 2 의 거듭제곱 버킷과 Fibonacci 혼합 사용 여부(입력)
+ * @return 반환값 없음
+ */
+static void BenchIntKeyPattern(int count, int powerOfTwoBuckets)
+{
+	const char *mode = (powerOfTwoBuckets != 0) ? "pow2" : "modulo";
+	const char *patternNames[3] = { "seq", "stride", "negative" };
+	char operation[32];
+	int *keys = (int*)malloc(sizeof(int) * (size_t)count);
+	int pattern = 0;
+	int index = 0;
+
+	JHashTableOption option;
+	JHashTableInitOption(&option);
+	option.powerOfTwoBuckets = powerOfTwoBuckets;
+
+	for(pattern = 0; pattern < 3; pattern++)
+	{
+		for(index = 0; index < count; index++)
+		{
+			if(pattern == 0) keys[index] = index;
+			else if(pattern == 1) keys[index] = index * 1024;
+			else keys[index] = -index;
+		}
+
+		JHashTablePtr table = NewJHashTableWithOption(1024, IntType, IntType, &option);
+		if(table == NULL) break;
+
+		snprintf(operation, sizeof(operation), "%s-ins", patternNames[pattern]);
+		BenchBegin();
+		for(index = 0; index < count; index++) JHashTableAddData(table, &keys[index], &keys[index]);
+		BenchPrint(mode, operation, count, BenchEnd(count));
+
+		snprintf(operation, sizeof(operation), "%s-get", patternNames[pattern]);
+		BenchBegin();
+		for(index = 0; index < count; index++) JHashTableGet(table, &keys[index]);
+		BenchPrint(mode, operation, count, BenchEnd(count));
+
+		DeleteJHashTable(&table);
+	}
+
+	free(keys);
+}
+
+/**
+ * @fn static void BenchAddBatch(int count, LockType lockType)
+ * @brief 빈 테이블에 데이터를 하나씩 추가하는 시간과 일괄 추가(JHashTableAddBatch)로 추가하는 시간, 할당 횟수를 측정하는 함수
+ * 일괄 추가는 1024 개씩 나누어 호출하는 경우와 한 번에 호출하는 경우를 함께 측정한다.
+ * 동시 접근 모드는 확장 비용이 섞이지 않도록 데이터 개수 크기의 버킷으로 만든다(잠금 없는 테이블은 버킷 1024 개에서 시작).
+ * @param count 데이터 개수(입력)
+ * @param lockType 동시 접근 보호 유형(입력)
+ * @return 반환값 없음
+ */
+static void BenchAddBatch(int count, LockType lockType)
+{
+	const int batchSizes[2] = { 1024, 0 };
+	const char *mode = (lockType == RwLock) ? "rwlock" : "nolock";
+	char operation[32];
+	int *keys = (int*)malloc(sizeof(int) * (size_t)count);
+	void **keyPtrs = (void**)malloc(sizeof(void*) * (size_t)count);
+	int sizeIndex = 0;
+	int batchCount = 0;
+	int index = 0;
+
+	for( ; index < count; index++)
+	{
+		keys[index] = index;
+		keyPtrs[index] = &keys[index];
+	}
+
+	JHashTableOption option;
+	JHashTableInitOption(&option);
+	option.lockType = lockType;
+	option.lockStripeCount = 1024;
+
+	JHashTablePtr table = NewJHashTableWithOption((lockType != NoLock) ? count : 1024, IntType, IntType, &option);
+	if(table != NULL)
+	{
+		BenchBegin();
+		for(index = 0; index < count; index++) JHashTableAddData(table, keyPtrs[index], keyPtrs[index]);
+		BenchPrint(mode, "add-loop", count, BenchEnd(count));
+		DeleteJHashTable(&table);
+	}
+
+	for( ; sizeIndex < 2; sizeIndex++)
+	{
+		table = NewJHashTableWithOption((lockType != NoLock) ? count : 1024, IntType, IntType, &option);
+		if(table == NULL) break;
+
+		batchCount = (batchSizes[sizeIndex] == 0) ? count : batchSizes[sizeIndex];
+		if(batchSizes[sizeIndex] == 0) snprintf(operation, sizeof(operation), "add-batch-all");
+		else snprintf(operation, sizeof(operation), "add-batch%d", batchSizes[sizeIndex]);
+
+		BenchBegin();
+		for(index = 0; index < count; index += batchCount)
+		{
+			JHashTableAddBatch(table, keyPtrs + index, keyPtrs + index, (count - index < batchCount) ? count - index : batchCount, NULL);
+		}
+		BenchPrint(mode, operation, count, BenchEnd(count));
+		DeleteJHashTable(&table);
+	}
+
+	free(keyPtrs);
+	free(keys);
+}
+
+/**
+ * @fn static void BenchFindBatch(int count, StorageType storageType)
+ * @brief 무작위 순서의 키를 하나씩 검색하는 시간과 일괄 검색(JHashTableFindBatch)으로 prefetch 거리별로 검색하는 시간을 측정하는 함수
+ * @param count 데이터 개수(입력)
+ * @param storageType 저장 방식(입력)
+ * @return 반환값 없음
+ */
+static void BenchFindBatch(int count, StorageType storageType)
+{
+	const int distances[4] = { 0, 2, JHT_DEFAULT_PREFETCH_DISTANCE, JHT_MAX_PREFETCH_DISTANCE };
+	const char *mode = (storageType == OpenAddressStorage) ? "swiss" : "chain";
+	char operation[32];
+	int *keys = (int*)malloc(sizeof(int) * (size_t)count);
+	void **keyPtrs = (void**)malloc(sizeof(void*) * (size_t)count);
+	FindResult *results = (FindResult*)malloc(sizeof(FindResult) * (size_t)count);
+	void *tempPtr = NULL;
+	int distanceIndex = 0;
+	int index = 0;
+	int swapIndex = 0;
+
+	JHashTableOption option;
+	JHashTableInitOption(&option);
+	option.storageType = storageType;
+
+	JHashTablePtr table = NewJHashTableWithOption(count, IntType, IntType, &option);
+	if(table != NULL)
+	{
+		for(index = 0; index < count; index++)
+		{
+			keys[index] = index;
+			keyPtrs[index] = &keys[index];
+			JHashTableAddData(table, &keys[index], &keys[index]);
+		}
+
+		// 검색 순서를 섞어 버킷 접근이 캐시에서 벗어나도록 한다.
+		srand(7);
+		for(index = count - 1; index > 0; index--)
+		{
+			swapIndex = rand() % (index + 1);
+			tempPtr = keyPtrs[index];
+			keyPtrs[index] = keyPtrs[swapIndex];
+			keyPtrs[swapIndex] = tempPtr;
+		}
+
+		BenchBegin();
+		for(index = 0; index < count; index++) JHashTableFindData(table, keyPtrs[index], keyPtrs[index]);
+		BenchPrint(mode, "find-loop", count, BenchEnd(count));
+
+		for( ; distanceIndex < 4; distanceIndex++)
+		{
+			JHashTableSetPrefetchDistance(table, distances[distanceIndex]);
+			snprintf(operation, sizeof(operation), "batch-d%d", distances[distanceIndex]);
+			BenchBegin();
+			JHashTableFindBatch(table, keyPtrs, keyPtrs, results, count);
+			BenchPrint(mode, operation, count, BenchEnd(count));
+		}
+
+		DeleteJHashTable(&table);
+	}
+
+	free(results);
+	free(keyPtrs);
+	free(keys);
+}
+
+/**
+ * @fn static void BenchGetOrInsert(int count, StorageType storageType)
+ * @brief 절반이 저장된 키들을 검색 후 없으면 추가하는 시간과 JHashTableGetOrInsert 로 처리하는 시간을 측정하는 함수
+ * @param count 데이터 개수(입력)
+ * @param storageType 저장 방식(입력)
+ * @return 반환값 없음
+ */
+static void BenchGetOrInsert(int count, StorageType storageType)
+{
+	const char *mode = (storageType == OpenAddressStorage) ? "swiss" : "chain";
+	int *keys = (int*)malloc(sizeof(int) * (size_t)count);
+	int pass = 0;
+	int index = 0;
+
+	JHashTableOption option;
+	JHashTableInitOption(&option);
+	option.storageType = storageType;
+
+	for(index = 0; index < count; index++) keys[index] = index;
+
+	for( ; pass < 2; pass++)
+	{
+		JHashTablePtr table = NewJHashTableWithOption(count, IntType, IntType, &option);
+		if(table == NULL) break;
+		for(index = 0; index < count; index += 2) JHashTableAddData(table, &keys[index], &keys[index]);
+
+		BenchBegin();
+		for(index = 0; index < count; index++)
+		{
+			if(pass == 1) JHashTableGetOrInsert(table, &keys[index], &keys[index], NULL);
+			else if(JHashTableGet(table, &keys[index]) == NULL) JHashTableAddData(table, &keys[index], &keys[index]);
+		}
+		BenchPrint(mode, (pass == 1) ? "get-or-insert" : "get+add", count, BenchEnd(count));
+		DeleteJHashTable(&table);
+	}
+
+	free(keys);
+}
+
+/**
+ * @fn static void BenchEraseHandle(int count, StorageType storageType)
+ * @brief 검색 후 삭제(JHashTableFindData + JHashTableDeleteData)하는 시간과 핸들로 삭제(JHashTableFindEntry + JHashTableEraseHandle)하는 시간을 측정하는 함수
+ * @param count 데이터 개수(입력)
+ * @param storageType 저장 방식(입력)
+ * @return 반환값 없음
+ */
+static void BenchEraseHandle(int count, StorageType storageType)
+{
+	const char *mode = (storageType == OpenAddressStorage) ? "swiss" : "chain";
+	int *keys = (int*)malloc(sizeof(int) * (size_t)count);
+	int pass = 0;
+	int index = 0;
+	JHashTableEntry entry;
+
+	JHashTableOption option;
+	JHashTableInitOption(&option);
+	option.storageType = storageType;
+
+	for(index = 0; index < count; index++) keys[index] = index;
+
+	for( ; pass < 2; pass++)
+	{
+		JHashTablePtr table = NewJHashTableWithOption(count, IntType, IntType, &option);
+		if(table == NULL) break;
+		for(index = 0; index < count; index++) JHashTableAddData(table, &keys[index], &keys[index]);
+
+		BenchBegin();
+		for(index = 0; index < count; index++)
+		{
+			if(pass == 1)
+			{
+				if(JHashTableFindEntry(table, &keys[index], NULL, &entry) != NULL) JHashTableEraseHandle(table, &entry);
+			}
+			else if(JHashTableFindData(table, &keys[index], &keys[index]) == FindSuccess)
+			{
+				JHashTableDeleteData(table, &keys[index], &keys[index]);
+			}
+		}
+		BenchPrint(mode, (pass == 1) ? "find+erase" : "find+delete", count, BenchEnd(count));
+		DeleteJHashTable(&table);
+	}
+
+	free(keys);
+}
+
+/**
+ * @fn static void BenchClear(int count, int bucketRatio)
+ * @brief 테이블을 삭제 후 새로 생성(DeleteJHashTable + NewJHashTable)해서 다시 채우는 시간과 JHashTableClear 로 비우고 다시 채우는 시간을 측정하는 함수
+ * @param count 한 번에 채우는 데이터 개수(입력)
+ * @param bucketRatio 데이터 개수 대비 버킷 개수 배수(입력, 클수록 빈 버킷이 많음)
+ * @return 반환값 없음
+ */
+static void BenchClear(int count, int bucketRatio)
+{
+	const char *mode = (bucketRatio > 1) ? "sparse" : "dense";
+	const int roundCount = 10;
+	int *keys = (int*)malloc(sizeof(int) * (size_t)count);
+	int pass = 0;
+	int round = 0;
+	int index = 0;
+
+	for(index = 0; index < count; index++) keys[index] = index;
+
+	for( ; pass < 2; pass++)
+	{
+		JHashTablePtr table = NewJHashTable(count * bucketRatio, IntType, IntType);
+		if(table == NULL) break;
+		for(index = 0; index < count; index++) JHashTableAddData(table, &keys[index], &keys[index]);
+
+		BenchBegin();
+		for(round = 0; round < roundCount; round++)
+		{
+			if(pass == 1)
+			{
+				JHashTableClear(table);
+			}
+			else
+			{
+				DeleteJHashTable(&table);
+				table = NewJHashTable(count * bucketRatio, IntType, IntType);
+				if(table == NULL) break;
+			}
+			for(index = 0; index < count; index++) JHashTableAddData(table, &keys[index], &keys[index]);
+		}
+		BenchPrint(mode, (pass == 1) ? "clear+fill" : "renew+fill", count * roundCount, BenchEnd(count * roundCount));
+		DeleteJHashTable(&table);
+	}
+
+	free(keys);
+}
+
+/**
+ * @fn static void BenchIterScan(int count, int bucketRatio)
+ * @brief 버킷을 하나씩 검사하는 직접 작성한 순회와 순회 커서(JHashTableIter)로 모든 데이터를 읽는 시간을 측정하는 함수
+ * @param count 데이터 개수(입력)
+ * @param bucketRatio 데이터 개수 대비 버킷 개수 배수(입력, 클수록 빈 버킷이 많음)
+ * @return 반환값 없음
+ */
+static void BenchIterScan(int count, int bucketRatio)
+{
+	const char *mode = (bucketRatio > 1) ? "sparse" : "dense";
+	int *keys = (int*)malloc(sizeof(int) * (size_t)count);
+	volatile long sum = 0;
+	int listIndex = 0;
+	int index = 0;
+	JNodePtr node = NULL;
+	JHashTableIter iter;
+
+	JHashTablePtr table = NewJHashTable(count * bucketRatio, IntType, IntType);
+	if(table != NULL)
+	{
+		for(index = 0; index < count; index++)
+		{
+			keys[index] = index;
+			JHashTableAddData(table, &keys[index], &keys[index]);
+		}
+
+		BenchBegin();
+		for(listIndex = 0; listIndex < table->size; listIndex++)
+		{
+			if(table->listContainer[listIndex] == NULL) continue;
+			for(node = table->listContainer[listIndex]->head->next; node != table->listContainer[listIndex]->tail; node = node->next)
+			{
+				sum += *((int*)node->data);
+			}
+		}
+		BenchPrint(mode, "scan-loop", count, BenchEnd(count));
+
+		BenchBegin();
+		for(index = JHashTableIterBegin(table, &iter); index == 1; index = JHashTableIterNext(&iter))
+		{
+			sum += *((int*)JHashTableIterGet(&iter, NULL));
+		}
+		BenchPrint(mode, "scan-iter", count, BenchEnd(count));
+
+		DeleteJHashTable(&table);
+	}
+
+	free(keys);
+}
+
+/**
+ * @fn static void BenchDrain(int count)
+ * @brief 데이터 개수의 64 배 버킷을 가진 희소 테이블을 앞, 뒤에서부터 모두 삭제하는 시간을 측정하는 함수
+ * @param count 데이터 개수(입력)
+ * @return 반환값 없음
+ */
+static void BenchDrain(int count)
+{
+	int *keys = (int*)malloc(sizeof(int) * (size_t)count);
+	int index = 0;
+	int direction = 0;
+
+	for(index = 0; index < count; index++) keys[index] = index * 61;
+
+	for(direction = 0; direction < 2; direction++)
+	{
+		JHashTablePtr table = NewJHashTable(count * 64, IntType, IntType);
+		if(table == NULL) break;
+		for(index = 0; index < count; index++) JHashTableAddData(table, &keys[index], &keys[index]);
+
+		BenchBegin();
+		if(direction == 0) while(JHashTableDeleteFirstData(table) == DeleteSuccess);
+		else while(JHashTableDeleteLastData(table) == DeleteSuccess);
+		BenchPrint("sparse", (direction == 0) ? "drain-first" : "drain-last", count, BenchEnd(count));
+
+		DeleteJHashTable(&table);
+	}
+
+	free(keys);
+}
+
+/**
+ * @fn static void BenchPop(int count)
+ * @brief GetFirstData 후 DeleteFirstData 로 꺼내는 방식과 PopFirst 로 꺼내는 방식의 시간을 비교하는 함수
+ * @param count 데이터 개수(입력)
+ * @return 반환값 없음
+ */
+static void BenchPop(int count)
+{
+	int *keys = (int*)malloc(sizeof(int) * (size_t)count);
+	int index = 0;
+	int usePop = 0;
+	long long checksum = 0;
+
+	for(index = 0; index < count; index++) keys[index] = index * 61;
+
+	for(usePop = 0; usePop < 2; usePop++)
+	{
+		JHashTablePtr table = NewJHashTable(count * 64, IntType, IntType);
+		if(table == NULL) break;
+		for(index = 0; index < count; index++) JHashTableAddData(table, &keys[index], &keys[index]);
+
+		BenchBegin();
+		if(usePop == 0)
+		{
+			void *data = NULL;
+			while((data = JHashTableGetFirstData(table)) != NULL)
+			{
+				checksum += *((int*)data);
+				JHashTableDeleteFirstData(table);
+			}
+		}
+		else
+		{
+			void *data = NULL;
+			while((data = JHashTablePopFirst(table)) != NULL) checksum += *((int*)data);
+		}
+		BenchPrint("sparse", (usePop == 0) ? "get+delete" : "pop-first", count, BenchEnd(count));
+
+		DeleteJHashTable(&table);
+	}
+
+	if(checksum == 0) printf("checksum: %lld\n", checksum);
+	free(keys);
+}
+
+// 여러 스레드 측정용 스레드 인자 구조체
+typedef struct _bench_thread_arg_t {
+	// 함께 사용하는 해쉬 테이블
+	JHashTablePtr table;
+	// 테이블 전체를 보호하는 잠금(동시 접근 모드 테이블이면 NULL)
+	pthread_mutex_t *tableMutex;
+	// 스레드가 사용할 키 배열
+	int *keys;
+	// 키 개수
+	int count;
+	// 함께 사용하는 샤드 테이블(샤드 테이블 측정 시 사용)
+	JShardedHashTablePtr shardedTable;
+	// 가장 오래 걸린 연산 한 번의 시간(ns, 확장 측정 시 사용)
+	unsigned long maxNs;
+	// 쓰기 버퍼의 비우기 크기(쓰기 버퍼 측정 시 사용, 0 이면 버퍼 없이 추가)
+	int flushSize;
+	// 쓰기 버퍼의 누적 통계(쓰기 버퍼 측정 시 사용)
+	JInsertBufferStats bufferStats;
+} BenchThreadArg;
+
+static void* BenchMixedWorker(void *data)
+{
+	BenchThreadArg *arg = (BenchThreadArg*)data;
+	int index = 0;
+	int round = 0;
+
+	for(index = 0; index < arg->count; index++)
+	{
+		if(arg->tableMutex != NULL) pthread_mutex_lock(arg->tableMutex);
+		JHashTableAddData(arg->table, &(arg->keys[index]), &(arg->keys[index]));
+		if(arg->tableMutex != NULL) pthread_mutex_unlock(arg->tableMutex);
+	}
+	for(round = 0; round < 4; round++)
+	{
+		for(index = 0; index < arg->count; index++)
+		{
+			if(arg->tableMutex != NULL) pthread_mutex_lock(arg->tableMutex);
+			JHashTableGet(arg->table, &(arg->keys[index]));
+			if(arg->tableMutex != NULL) pthread_mutex_unlock(arg->tableMutex);
+		}
+	}
+	for(index = 0; index < arg->count; index++)
+	{
+		if(arg->tableMutex != NULL) pthread_mutex_lock(arg->tableMutex);
+		JHashTableDeleteData(arg->table, &(arg->keys[index]), &(arg->keys[index]));
+		if(arg->tableMutex != NULL) pthread_mutex_unlock(arg->tableMutex);
+	}
+	return NULL;
+}
+
+/**
+ * @fn static void BenchConcurrent(int count, int maxThreads, LockType lockType)
+ * @brief 스레드 1 개부터 maxThreads 개까지 같은 테이블에 삽입, 검색(4 회), 삭제를 동시에 수행하는 처리량을 측정하는 함수
+ * NoLock 은 테이블 전체를 하나의 mutex 로 보호하는 기존 사용 방식이며, 스레드마다 서로 다른 키 범위를 사용한다.
+ * ns/op 는 전체 연산 개수 대비 경과 시간이므로 처리량이 늘어날수록 줄어든다.
+ * @param count 스레드 하나의 데이터 개수(입력)
+ * @param maxThreads 최대 스레드 개수(입력)
+ * @param lockType 동시 접근 보호 유형(입력)
+ * @return 반환값 없음
+ */
+static void BenchConcurrent(int count, int maxThreads, LockType lockType)
+{
+	const char *mode = (lockType == RwLock) ? "rwlock" : ((lockType == SpinLock) ? "spin" : ((lockType == LockFree) ? "lockfree" : "mutex"));
+	char operation[32];
+	int *keys = (int*)malloc(sizeof(int) * (size_t)count * (size_t)maxThreads);
+	pthread_t *threads = (pthread_t*)malloc(sizeof(pthread_t) * (size_t)maxThreads);
+	BenchThreadArg *args = (BenchThreadArg*)malloc(sizeof(BenchThreadArg) * (size_t)maxThreads);
+	pthread_mutex_t tableMutex = PTHREAD_MUTEX_INITIALIZER;
+	int threadCount = 1;
+	int index = 0;
+
+	for(index = 0; index < count * maxThreads; index++) keys[index] = index;
+
+	JHashTableOption option;
+	JHashTableInitOption(&option);
+	option.lockType = lockType;
+	option.lockStripeCount = 1024;
+
+	while(threadCount <= maxThreads)
+	{
+		JHashTablePtr table = NewJHashTableWithOption(count * threadCount, IntType, IntType, &option);
+		if(table == NULL) break;
+
+		BenchBegin();
+		for(index = 0; index < threadCount; index++)
+		{
+			args[index].table = table;
+			args[index].tableMutex = (lockType == NoLock) ? &tableMutex : NULL;
+			args[index].keys = keys + (size_t)index * (size_t)count;
+			args[index].count = count;
+			pthread_create(&threads[index], NULL, BenchMixedWorker, &args[index]);
+		}
+		for(index = 0; index < threadCount; index++) pthread_join(threads[index], NULL);
+		snprintf(operation, sizeof(operation), "mixed-t%d", threadCount);
+		BenchPrint(mode, operation, count * threadCount * 6, BenchEnd(count * threadCount * 6));
+
+		DeleteJHashTable(&table);
+		if(threadCount == maxThreads) break;
+		threadCount = (threadCount * 2 > maxThreads) ? maxThreads : threadCount * 2;
+	}
+
+	pthread_mutex_destroy(&tableMutex);
+	free(args);
+	free(threads);
+	free(keys);
+}
+
+static void* BenchShardedWorker(void *data)
+{
+	BenchThreadArg *arg = (BenchThreadArg*)data;
+	int index = 0;
+	int round = 0;
+
+	for(index = 0; index < arg->count; index++) JShardedHashTableAddData(arg->shardedTable, &(arg->keys[index]), &(arg->keys[index]));
+	for(round = 0; round < 4; round++)
+	{
+		for(index = 0; index < arg->count; index++) JShardedHashTableGet(arg->shardedTable, &(arg->keys[index]));
+	}
+	for(index = 0; index < arg->count; index++) JShardedHashTableDeleteData(arg->shardedTable, &(arg->keys[index]), &(arg->keys[index]));
+	return NULL;
+}
+
+static void* BenchGrowthWorker(void *data)
+{
+	BenchThreadArg *arg = (BenchThreadArg*)data;
+	struct timespec before;
+	struct timespec after;
+	unsigned long elapsed = 0;
+	int index = 0;
+
+	arg->maxNs = 0;
+	for(index = 0; index < arg->count; index++)
+	{
+		clock_gettime(CLOCK_MONOTONIC, &before);
+		JHashTableAddData(arg->table, &(arg->keys[index]), &(arg->keys[index]));
+		clock_gettime(CLOCK_MONOTONIC, &after);
+		elapsed = (unsigned long)((after.tv_sec - before.tv_sec) * 1000000000L + (after.tv_nsec - before.tv_nsec));
+		if(elapsed > arg->maxNs) arg->maxNs = elapsed;
+	}
+	return NULL;
+}
+
+/**
+ * @fn static void BenchGrowth(int count, int maxThreads, int cooperativeResize)
+ * @brief 스레드 1 개부터 maxThreads 개까지 같은 테이블에 동시에 삽입하는 처리량과 가장 오래 걸린 삽입 한 번의 시간을 측정하는 함수
+ * cooperativeResize 이면 버킷 64 개에서 시작해 삽입 중 여러 번 확장하고, 아니면 모든 데이터 개수만큼 미리 할당한 테이블을 사용한다.
+ * @param count 스레드 하나의 데이터 개수(입력)
+ * @param maxThreads 최대 스레드 개수(입력)
+ * @param cooperativeResize 동시 접근 모드의 자동 확장 사용 여부(입력)
+ * @return 반환값 없음
+ */
+static void BenchGrowth(int count, int maxThreads, int cooperativeResize)
+{
+	const char *mode = (cooperativeResize != 0) ? "grow" : "presize";
+	char operation[32];
+	int *keys = (int*)malloc(sizeof(int) * (size_t)count * (size_t)maxThreads);
+	pthread_t *threads = (pthread_t*)malloc(sizeof(pthread_t) * (size_t)maxThreads);
+	BenchThreadArg *args = (BenchThreadArg*)calloc((size_t)maxThreads, sizeof(BenchThreadArg));
+	unsigned long maxNs = 0;
+	int threadCount = 1;
+	int index = 0;
+
+	for(index = 0; index < count * maxThreads; index++) keys[index] = index;
+
+	JHashTableOption option;
+	JHashTableInitOption(&option);
+	option.lockType = RwLock;
+	option.lockStripeCount = 1024;
+	option.cooperativeResize = cooperativeResize;
+
+	while(threadCount <= maxThreads)
+	{
+		JHashTablePtr table = NewJHashTableWithOption((cooperativeResize != 0) ? 64 : count * threadCount, IntType, IntType, &option);
+		if(table == NULL) break;
+
+		BenchBegin();
+		for(index = 0; index < threadCount; index++)
+		{
+			args[index].table = table;
+			args[index].keys = keys + (size_t)index * (size_t)count;
+			args[index].count = count;
+			pthread_create(&threads[index], NULL, BenchGrowthWorker, &args[index]);
+		}
+		for(index = 0; index < threadCount; index++) pthread_join(threads[index], NULL);
+		snprintf(operation, sizeof(operation), "insert-t%d", threadCount);
+		BenchPrint(mode, operation, count * threadCount, BenchEnd(count * threadCount));
+
+		maxNs = 0;
+		for(index = 0; index < threadCount; index++)
+		{
+			if(args[index].maxNs > maxNs) maxNs = args[index].maxNs;
+		}
+		printf("%-8s %-14s max-ns %lu buckets %d\n", mode, "insert-stats", maxNs, JHashTableGetSize(table));
+
+		DeleteJHashTable(&table);
+		if(threadCount == maxThreads) break;
+		threadCount = (threadCount * 2 > maxThreads) ? maxThreads : threadCount * 2;
+	}
+
+	free(args);
+	free(threads);
+	free(keys);
+}
+
+static void* BenchInsertBufferWorker(void *data)
+{
+	BenchThreadArg *arg = (BenchThreadArg*)data;
+	int index = 0;
+
+	if(arg->flushSize == 0)
+	{
+		for(index = 0; index < arg->count; index++) JHashTableAddData(arg->table, &(arg->keys[index]), &(arg->keys[index]));
+		return NULL;
+	}
+
+	JInsertBufferPtr buffer = NewJInsertBuffer(arg->table, arg->flushSize, 0);
+	if(buffer == NULL) return NULL;
+	for(index = 0; index < arg->count; index++) JInsertBufferAdd(buffer, &(arg->keys[index]), &(arg->keys[index]));
+	JInsertBufferFlush(buffer);
+	JInsertBufferGetStats(buffer, &(arg->bufferStats));
+	DeleteJInsertBuffer(&buffer);
+	return NULL;
+}
+
+/**
+ * @fn static void BenchInsertBuffer(int count, int maxThreads)
+ * @brief 스레드 1 개부터 maxThreads 개까지 같은 테이블에 바로 추가하는 처리량과 스레드별 쓰기 버퍼로 모아서 추가하는 처리량을 측정하는 함수
+ * 쓰기 버퍼는 비우기 크기별로 측정하고, 추가 하나당 잡은 잠금 횟수와 비우기 시간, 가장 오래 기다린 시간을 함께 출력한다.
+ * @param count 스레드 하나의 데이터 개수(입력)
+ * @param maxThreads 최대 스레드 개수(입력)
+ * @return 반환값 없음
+ */
+static void BenchInsertBuffer(int count, int maxThreads)
+{
+	const int flushSizes[3] = { 0, 64, 1024 };
+	char mode[32];
+	char operation[32];
+	int *keys = (int*)malloc(sizeof(int) * (size_t)count * (size_t)maxThreads);
+	pthread_t *threads = (pthread_t*)malloc(sizeof(pthread_t) * (size_t)maxThreads);
+	BenchThreadArg *args = (BenchThreadArg*)calloc((size_t)maxThreads, sizeof(BenchThreadArg));
+	JInsertBufferStats total;
+	int sizeIndex = 0;
+	int threadCount = 1;
+	int index = 0;
+
+	for(index = 0; index < count * maxThreads; index++) keys[index] = index;
+
+	JHashTableOption option;
+	JHashTableInitOption(&option);
+	option.lockType = RwLock;
+	option.lockStripeCount = 1024;
+
+	for( ; sizeIndex < 3; sizeIndex++)
+	{
+		if(flushSizes[sizeIndex] == 0) snprintf(mode, sizeof(mode), "direct");
+		else snprintf(mode, sizeof(mode), "buf%d", flushSizes[sizeIndex]);
+
+		for(threadCount = 1; threadCount <= maxThreads; )
+		{
+			JHashTablePtr table = NewJHashTableWithOption(count * threadCount, IntType, IntType, &option);
+			if(table == NULL) break;
+
+			BenchBegin();
+			for(index = 0; index < threadCount; index++)
+			{
+				memset(&args[index], 0, sizeof(BenchThreadArg));
+				args[index].table = table;
+				args[index].keys = keys + (size_t)index * (size_t)count;
+				args[index].count = count;
+				args[index].flushSize = flushSizes[sizeIndex];
+				pthread_create(&threads[index], NULL, BenchInsertBufferWorker, &args[index]);
+			}
+			for(index = 0; index < threadCount; index++) pthread_join(threads[index], NULL);
+			snprintf(operation, sizeof(operation), "insert-t%d", threadCount);
+			BenchPrint(mode, operation, count * threadCount, BenchEnd(count * threadCount));
+
+			if(flushSizes[sizeIndex] != 0)
+			{
+				memset(&total, 0, sizeof(total));
+				for(index = 0; index < threadCount; index++)
+				{
+					total.insertedCount += args[index].bufferStats.insertedCount;
+					total.flushCount += args[index].bufferStats.flushCount;
+					total.lockCount += args[index].bufferStats.lockCount;
+					total.totalFlushNs += args[index].bufferStats.totalFlushNs;
+					if(args[index].bufferStats.maxFlushNs > total.maxFlushNs) total.maxFlushNs = args[index].bufferStats.maxFlushNs;
+					if(args[index].bufferStats.maxDelayNs > total.maxDelayNs) total.maxDelayNs = args[index].bufferStats.maxDelayNs;
+				}
+				printf("%-8s %-14s locks/insert %.3f avg-flush-ns %llu max-flush-ns %llu max-delay-ns %llu\n", mode, "flush-stats",
+					(total.insertedCount > 0) ? (double)total.lockCount / (double)total.insertedCount : 0.0,
+					(unsigned long long)((total.flushCount > 0) ? total.totalFlushNs / total.flushCount : 0),
+					(unsigned long long)total.maxFlushNs, (unsigned long long)total.maxDelayNs);
+			}
+
+			DeleteJHashTable(&table);
+			if(threadCount == maxThreads) break;
+			threadCount = (threadCount * 2 > maxThreads) ? maxThreads : threadCount * 2;
+		}
+	}
+
+	free(args);
+	free(threads);
+	free(keys);
+}
+
+/**
+ * @fn static void BenchBuildParallel(int count, int maxThreads)
+ * @brief 키/데이터 배열을 JHashTableAddData 로 순서대로 추가하는 시간과 JHashTableBuildParallel 로 스레드 1 개부터 maxThreads 개까지 나누어 추가하는 시간을 측정하는 함수
+ * 두 경우 모두 버킷 64 개에서 시작한다.
+ * @param count 데이터 개수(입력)
+ * @param maxThreads 최대 스레드 개수(입력)
+ * @return 반환값 없음
+ */
+static void BenchBuildParallel(int count, int maxThreads)
+{
+	char operation[32];
+	int *keys = (int*)malloc(sizeof(int) * (size_t)count);
+	void **keyPtrs = (void**)malloc(sizeof(void*) * (size_t)count);
+	int threadCount = 1;
+	int index = 0;
+
+	for(index = 0; index < count; index++)
+	{
+		keys[index] = index;
+		keyPtrs[index] = &keys[index];
+	}
+
+	JHashTablePtr table = NewJHashTable(64, IntType, IntType);
+	BenchBegin();
+	for(index = 0; index < count; index++) JHashTableAddData(table, keyPtrs[index], keyPtrs[index]);
+	BenchPrint("build", "add-loop", count, BenchEnd(count));
+	DeleteJHashTable(&table);
+
+	while(threadCount <= maxThreads)
+	{
+		table = NewJHashTable(64, IntType, IntType);
+		BenchBegin();
+		JHashTableBuildParallel(table, keyPtrs, keyPtrs, count, threadCount);
+		snprintf(operation, sizeof(operation), "build-t%d", threadCount);
+		BenchPrint("build", operation, count, BenchEnd(count));
+		DeleteJHashTable(&table);
+
+		if(threadCount == maxThreads) break;
+		threadCount = (threadCount * 2 > maxThreads) ? maxThreads : threadCount * 2;
+	}
+
+	free(keyPtrs);
+	free(keys);
+}
+
+// ctx 는 스레드별 데이터 합계 배열(작업 풀 밖에서 호출되면 첫 번째 공간 사용)
+static int BenchSumVisit(void *key, void *value, void *ctx)
+{
+	int workerIndex = JWorkPoolGetWorkerIndex();
+	(void)key;
+	((long*)ctx)[(workerIndex < 0) ? 0 : workerIndex] += *((int*)value);
+	return 0;
+}
+
+/**
+ * @fn static void BenchForEach(int count, int maxThreads)
+ * @brief 모든 데이터의 합계를 JHashTableForEach 로 계산하는 시간과 작업 풀 스레드 1 개부터 maxThreads 개까지 JHashTableForEachParallel 로 계산하는 시간을 측정하는 함수
+ * @param count 데이터 개수(입력)
+ * @param maxThreads 최대 스레드 개수(입력)
+ * @return 반환값 없음
+ */
+static void BenchForEach(int count, int maxThreads)
+{
+	char operation[32];
+	int *keys = (int*)malloc(sizeof(int) * (size_t)count);
+	long *sums = (long*)calloc((size_t)maxThreads, sizeof(long));
+	int threadCount = 1;
+	int index = 0;
+
+	JHashTablePtr table = NewJHashTable(count, IntType, IntType);
+	for(index = 0; index < count; index++)
+	{
+		keys[index] = index;
+		JHashTableAddData(table, &keys[index], &keys[index]);
+	}
+
+	BenchBegin();
+	JHashTableForEach(table, BenchSumVisit, sums);
+	BenchPrint("foreach", "serial", count, BenchEnd(count));
+
+	while(threadCount <= maxThreads)
+	{
+		JWorkPoolPtr pool = NewJWorkPool(threadCount);
+		if(pool == NULL) break;
+
+		BenchBegin();
+		JHashTableForEachParallel(table, pool, BenchSumVisit, sums);
+		snprintf(operation, sizeof(operation), "parallel-t%d", threadCount);
+		BenchPrint("foreach", operation, count, BenchEnd(count));
+		DeleteJWorkPool(&pool);
+
+		if(threadCount == maxThreads) break;
+		threadCount = (threadCount * 2 > maxThreads) ? maxThreads : threadCount * 2;
+	}
+
+	DeleteJHashTable(&table);
+	free(sums);
+	free(keys);
+}
+
+/**
+ * @fn static void BenchSharded(int count, int maxThreads, LockType lockType)
+ * @brief BenchConcurrent 와 같은 작업을 샤드 64 개의 샤드 테이블로 수행하는 처리량과 샤드별 데이터 분포, 잠금 대기 횟수를 측정하는 함수
+ * @param count 스레드 하나의 데이터 개수(입력)
+ * @param maxThreads 최대 스레드 개수(입력)
+ * @param lockType 샤드 잠금 유형(입력)
+ * @return 반환값 없음
+ */
+static void BenchSharded(int count, int maxThreads, LockType lockType)
+{
+	const char *mode = (lockType == RwLock) ? "shard-rw" : "shard-sp";
+	char operation[32];
+	int *keys = (int*)malloc(sizeof(int) * (size_t)count * (size_t)maxThreads);
+	pthread_t *threads = (pthread_t*)malloc(sizeof(pthread_t) * (size_t)maxThreads);
+	BenchThreadArg *args = (BenchThreadArg*)malloc(sizeof(BenchThreadArg) * (size_t)maxThreads);
+	int threadCount = 1;
+	int index = 0;
+	JHashShardStats stats;
+
+	for(index = 0; index < count * maxThreads; index++) keys[index] = index;
+
+	while(threadCount <= maxThreads)
+	{
+		JShardedHashTablePtr table = NewJShardedHashTable(64, count * threadCount, IntType, IntType, lockType, NULL);
+		if(table == NULL) break;
+
+		BenchBegin();
+		for(index = 0; index < threadCount; index++)
+		{
+			memset(&args[index], 0, sizeof(BenchThreadArg));
+			args[index].shardedTable = table;
+			args[index].keys = keys + (size_t)index * (size_t)count;
+			args[index].count = count;
+			pthread_create(&threads[index], NULL, BenchShardedWorker, &args[index]);
+		}
+		for(index = 0; index < threadCount; index++) pthread_join(threads[index], NULL);
+		snprintf(operation, sizeof(operation), "mixed-t%d", threadCount);
+		BenchPrint(mode, operation, count * threadCount * 6, BenchEnd(count * threadCount * 6));
+
+		// 샤드별 추가 요청 개수의 최소/최대값으로 분포를 확인한다.
+		unsigned long minAdds = 0;
+		unsigned long maxAdds = 0;
+		unsigned long contended = 0;
+		for(index = 0; index < JShardedHashTableGetShardCount(table); index++)
+		{
+			JShardedHashTableGetShardStats(table, index, &stats);
+			if((index == 0) || (stats.addCount < minAdds)) minAdds = (unsigned long)stats.addCount;
+			if(stats.addCount > maxAdds) maxAdds = (unsigned long)stats.addCount;
+			contended += (unsigned long)stats.contendedCount;
+		}
+		printf("%-8s %-14s min-add %lu max-add %lu contended %lu\n", mode, "shard-stats", minAdds, maxAdds, contended);
+
+		DeleteJShardedHashTable(&table);
+		if(threadCount == maxThreads) break;
+		threadCount = (threadCount * 2 > maxThreads) ? maxThreads : threadCount * 2;
+	}
+
+	free(args);
+	free(threads);
+	free(keys);
+}
+
+static void* BenchReadMostlyWorker(void *data)
+{
+	BenchThreadArg *arg = (BenchThreadArg*)data;
+	int index = 0;
+	int round = 0;
+
+	// 50 번 중 1 번(2 %)은 삭제 후 다시 추가하고, 나머지는 검색한다.
+	for(round = 0; round < 8; round++)
+	{
+		for(index = 0; index < arg->count; index++)
+		{
+			if((index % 50) == 0)
+			{
+				JHashTableDeleteData(arg->table, &(arg->keys[index]), &(arg->keys[index]));
+				JHashTableAddData(arg->table, &(arg->keys[index]), &(arg->keys[index]));
+			}
+			else
+			{
+				JHashTableFindData(arg->table, &(arg->keys[index]), &(arg->keys[index]));
+			}
+		}
+	}
+	return NULL;
+}
+
+/**
+ * @fn static void BenchReadMostly(int count, int maxThreads, int lockFreeRead)
+ * @brief 검색 98 %, 삭제/추가 2 % 작업을 스레드 1 개부터 maxThreads 개까지 동시에 수행하는 처리량을 측정하는 함수
+ * 읽기/쓰기 잠금으로 검색하는 경우와 잠금 없이 검색하는 경우를 비교한다.
+ * @param count 스레드 하나의 데이터 개수(입력)
+ * @param maxThreads 최대 스레드 개수(입력)
+ * @param lockFreeRead 잠금 없는 검색 사용 여부(입력)
+ * @return 반환값 없음
+ */
+static void BenchReadMostly(int count, int maxThreads, int lockFreeRead)
+{
+	const char *mode = (lockFreeRead != 0) ? "lfread" : "rwlock";
+	char operation[32];
+	int *keys = (int*)malloc(sizeof(int) * (size_t)count * (size_t)maxThreads);
+	pthread_t *threads = (pthread_t*)malloc(sizeof(pthread_t) * (size_t)maxThreads);
+	BenchThreadArg *args = (BenchThreadArg*)malloc(sizeof(BenchThreadArg) * (size_t)maxThreads);
+	int threadCount = 1;
+	int index = 0;
+
+	for(index = 0; index < count * maxThreads; index++) keys[index] = index;
+
+	JHashTableOption option;
+	JHashTableInitOption(&option);
+	option.lockType = RwLock;
+	option.lockStripeCount = 1024;
+	option.lockFreeRead = lockFreeRead;
+
+	while(threadCount <= maxThreads)
+	{
+		JHashTablePtr table = NewJHashTableWithOption(count * threadCount, IntType, IntType, &option);
+		if(table == NULL) break;
+		for(index = 0; index < count * threadCount; index++) JHashTableAddData(table, &keys[index], &keys[index]);
+
+		BenchBegin();
+		for(index = 0; index < threadCount; index++)
+		{
+			args[index].table = table;
+			args[index].tableMutex = NULL;
+			args[index].keys = keys + (size_t)index * (size_t)count;
+			args[index].count = count;
+			pthread_create(&threads[index], NULL, BenchReadMostlyWorker, &args[index]);
+		}
+		for(index = 0; index < threadCount; index++) pthread_join(threads[index], NULL);
+		snprintf(operation, sizeof(operation), "read98-t%d", threadCount);
+		BenchPrint(mode, operation, count * threadCount * 8, BenchEnd(count * threadCount * 8));
+
+		DeleteJHashTable(&table);
+		if(threadCount == maxThreads) break;
+		threadCount = (threadCount * 2 > maxThreads) ? maxThreads : threadCount * 2;
+	}
+
+	free(args);
+	free(threads);
+	free(keys);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Main Function
+////////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char **argv)
+{
+	int count = 1000000;
+	int maxThreads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+	if(argc > 1) count = atoi(argv[1]);
+	if(argc > 2) maxThreads = atoi(argv[2]);
+	if(count <= 0) return 1;
+	if(maxThreads <= 0) maxThreads = 1;
+
+	printf("%-8s %-14s %10s %10s %12s %12s\n", "mode", "op", "ops", "ns/op", "mallocs", "frees");
+	BenchNodePool(count, 0);
+	BenchNodePool(count, 1);
+	BenchConstruction(count * 10);
+	BenchSkewedBuild(count / 50);
+	BenchIntKeyPattern(count / 10, 0);
+	BenchIntKeyPattern(count / 10, 1);
+	BenchAddBatch(count, NoLock);
+	BenchAddBatch(count, RwLock);
+	BenchFindBatch(count, ChainStorage);
+	BenchFindBatch(count, OpenAddressStorage);
+	BenchGetOrInsert(count, ChainStorage);
+	BenchGetOrInsert(count, OpenAddressStorage);
+	BenchEraseHandle(count, ChainStorage);
+	BenchEraseHandle(count, OpenAddressStorage);
+	BenchClear(count / 10, 1);
+	BenchClear(count / 100, 64);
+	BenchIterScan(count, 1);
+	BenchIterScan(count / 10, 64);
+	BenchDrain(count / 10);
+	BenchPop(count / 10);
+	BenchConcurrent(count / 10, maxThreads, NoLock);
+	BenchConcurrent(count / 10, maxThreads, RwLock);
+	BenchConcurrent(count / 10, maxThreads, SpinLock);
+	BenchConcurrent(count / 10, maxThreads, LockFree);
+	BenchGrowth(count / 10, maxThreads, 0);
+	BenchGrowth(count / 10, maxThreads, 1);
+	BenchInsertBuffer(count / 10, maxThreads);
+	BenchBuildParallel(count, maxThreads);
+	BenchForEach(count, maxThreads);
+	BenchSharded(count / 10, maxThreads, RwLock);
+	BenchSharded(count / 10, maxThreads, SpinLock);
+	BenchReadMostly(count / 10, maxThreads, 0);
+	BenchReadMostly(count / 10, maxThreads, 1);
+
+	return 0;
+}
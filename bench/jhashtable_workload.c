@@ -0,0 +1,588 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <math.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include "../include/jhashtable.h"
+
+////////////////////////////////////////////////////////////////////////////////
+/// Definitions
+////////////////////////////////////////////////////////////////////////////////
+
+// 지연 시간 histogram 의 2 의 거듭제곱 구간 하나를 나누는 칸 개수(상대 오차 1/32 이하)
+#define WORKLOAD_SUB_BUCKETS 16
+// 지연 시간 histogram 칸 개수(2^40 ns 까지)
+#define WORKLOAD_HISTOGRAM_SIZE (WORKLOAD_SUB_BUCKETS + 37 * WORKLOAD_SUB_BUCKETS)
+// 최대 스레드 개수
+#define WORKLOAD_MAX_THREADS 256
+// 최대 테이블 크기 개수(-s 옵션)
+#define WORKLOAD_MAX_SIZES 16
+// Zipf 순위를 키로 바꿀 때 곱하는 소수(테이블 크기보다 큰 소수라서 나머지 연산 결과가 순열이 된다)
+#define WORKLOAD_SCATTER_PRIME 1000000007ULL
+// 남은 메모리 중 테이블에 사용할 수 있는 비율
+#define WORKLOAD_MEMORY_RATIO 0.8
+
+// 측정 연산 유형
+// 추가와 삭제는 스레드마다 겹치지 않는 새로운 키 범위를 순열 순서로 한 번씩 사용하므로 중복 추가나 없는 키 삭제로 실패하지 않는다.
+typedef enum _workload_type_t {
+	// 새로운 키 범위에 추가
+	WorkloadInsert = 0,
+	// 저장된 키 검색
+	WorkloadFind,
+	// 새로운 키 범위를 미리 채운 후 삭제
+	WorkloadDelete,
+	// 검색 80%, 새로운 키 범위에 추가 10%, 삭제 10%(새로운 키 범위의 앞쪽 절반을 미리 채우고 삭제, 뒤쪽 절반에 추가)
+	WorkloadMixed,
+	WorkloadCount
+} WorkloadType;
+
+// 키 분포 유형
+typedef enum _workload_dist_t {
+	DistUniform = 0,
+	DistZipf,
+	DistCount
+} WorkloadDist;
+
+static const char *workloadNames[WorkloadCount] = { "insert", "find", "delete", "mixed" };
+static const char *distNames[DistCount] = { "uniform", "zipf" };
+
+// Zipf 분포 생성기 구조체(YCSB ZipfianGenerator 와 같은 방식)
+typedef struct _workload_zipf_t {
+	// 키 개수
+	uint64_t n;
+	// 분포 기울기(0 < theta < 1)
+	double theta;
+	// 1 / (1 - theta)
+	double alpha;
+	// 1 ~ n 까지의 1 / i^theta 합
+	double zetan;
+	// 계산 보정값
+	double eta;
+} WorkloadZipf;
+
+// 측정 설정 구조체
+typedef struct _workload_config_t {
+	// 테이블 크기(미리 채울 데이터 개수) 목록
+	long sizes[WORKLOAD_MAX_SIZES];
+	// 테이블 크기 개수
+	int sizeCount;
+	// 최대 스레드 개수
+	int maxThreads;
+	// 스레드 하나의 측정 연산 개수
+	int opsPerThread;
+	// 측정할 연산 유형(비트 단위)
+	int workloadMask;
+	// 측정할 키 분포(비트 단위)
+	int distMask;
+	// Zipf 분포 기울기
+	double theta;
+	// 테이블 잠금 유형
+	LockType lockType;
+	// 버킷 잠금 개수
+	int lockStripeCount;
+} WorkloadConfig;
+
+// 스레드 인자 구조체
+typedef struct _workload_thread_arg_t {
+	// 측정할 테이블
+	JHashTablePtr table;
+	// 전체 키 배열(저장된 키 범위 다음에 새로운 키 범위가 이어진다)
+	int *keys;
+	// 저장된 키 개수
+	long size;
+	// 이 스레드만 사용하는 새로운 키 범위의 시작 위치
+	long freshStart;
+	// 이 스레드만 사용하는 새로운 키 범위 크기
+	long freshSize;
+	// 다음에 추가할 새로운 키의 순열 순서
+	long insertOrder;
+	// 다음에 삭제할 새로운 키의 순열 순서
+	long deleteOrder;
+	// 연산 유형
+	WorkloadType workload;
+	// 저장된 키 범위의 Zipf 생성기(균등 분포면 NULL)
+	const WorkloadZipf *storedZipf;
+	// 난수 상태
+	uint64_t random;
+	// 연산 개수
+	int opCount;
+	// 성공한 연산 개수(검색은 찾은 개수, 추가와 삭제는 실제로 추가하거나 삭제한 개수)
+	uint64_t successCount;
+	// 동시에 시작하기 위한 장벽
+	pthread_barrier_t *barrier;
+	// 연산별 지연 시간 histogram
+	uint64_t histogram[WORKLOAD_HISTOGRAM_SIZE];
+} WorkloadThreadArg;
+
+////////////////////////////////////////////////////////////////////////////////
+/// Utilities
+////////////////////////////////////////////////////////////////////////////////
+
+static uint64_t WorkloadNowNs(void)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint64_t)now.tv_sec * 1000000000ULL + (uint64_t)now.tv_nsec;
+}
+
+// xorshift64* 난수
+static uint64_t WorkloadRandom(uint64_t *state)
+{
+	uint64_t x = *state;
+	x ^= x >> 12;
+	x ^= x << 25;
+	x ^= x >> 27;
+	*state = x;
+	return x * 0x2545F4914F6CDD1DULL;
+}
+
+// [0, 1) 범위 실수 난수
+static double WorkloadRandomUnit(uint64_t *state)
+{
+	return (double)(WorkloadRandom(state) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+/**
+ * @fn static void WorkloadZipfInit(WorkloadZipf *zipf, uint64_t n, double theta)
+ * @brief 키 n 개에 대한 Zipf 분포 생성기를 초기화하는 함수(zetan 계산에 O(n) 소요)
+ * @param zipf Zipf 분포 생성기 구조체 객체의 주소(출력)
+ * @param n 키 개수(입력)
+ * @param theta 분포 기울기(입력)
+ * @return 반환값 없음
+ */
+static void WorkloadZipfInit(WorkloadZipf *zipf, uint64_t n, double theta)
+{
+	uint64_t index = 1;
+	double zeta2 = 1.0 + pow(0.5, theta);
+
+	zipf->n = n;
+	zipf->theta = theta;
+	zipf->alpha = 1.0 / (1.0 - theta);
+	zipf->zetan = 0;
+	for( ; index <= n; index++) zipf->zetan += 1.0 / pow((double)index, theta);
+	zipf->eta = (1.0 - pow(2.0 / (double)n, 1.0 - theta)) / (1.0 - zeta2 / zipf->zetan);
+}
+
+/**
+ * @fn static uint64_t WorkloadNextKey(const WorkloadZipf *zipf, uint64_t n, uint64_t *random)
+ * @brief [0, n) 범위 키 위치를 분포에 따라 하나 고르는 함수
+ * Zipf 분포면 순위가 높은 키가 인접한 버킷에 모이지 않도록 순위에 큰 소수를 곱한 나머지를 키 위치로 사용한다.
+ * @param zipf Zipf 분포 생성기 구조체 객체의 주소(입력, 균등 분포면 NULL)
+ * @param n 키 개수(입력)
+ * @param random 난수 상태(출력)
+ * @return 키 위치
+ */
+static uint64_t WorkloadNextKey(const WorkloadZipf *zipf, uint64_t n, uint64_t *random)
+{
+	if(zipf == NULL) return WorkloadRandom(random) % n;
+
+	uint64_t rank = 0;
+	double u = WorkloadRandomUnit(random);
+	double uz = u * zipf->zetan;
+	if(uz < 1.0) rank = 0;
+	else if(uz < 1.0 + pow(0.5, zipf->theta)) rank = 1;
+	else rank = (uint64_t)((double)n * pow(zipf->eta * u - zipf->eta + 1.0, zipf->alpha));
+	if(rank >= n) rank = n - 1;
+
+	return (rank * WORKLOAD_SCATTER_PRIME) % n;
+}
+
+/**
+ * @fn static long WorkloadFreshIndex(long freshStart, long freshSize, long order)
+ * @brief 스레드 하나의 새로운 키 범위에서 order 번째로 사용할 키 위치를 반환하는 함수
+ * 순서에 큰 소수를 곱한 나머지를 사용하므로 범위 안의 모든 키를 한 번씩, 인접하지 않은 순서로 사용한다.
+ * @param freshStart 새로운 키 범위의 시작 위치(입력)
+ * @param freshSize 새로운 키 범위 크기(입력)
+ * @param order 순서(입력, 범위 크기 이상이면 처음부터 다시 사용)
+ * @return 키 위치
+ */
+static long WorkloadFreshIndex(long freshStart, long freshSize, long order)
+{
+	return freshStart + (long)(((uint64_t)(order % freshSize) * WORKLOAD_SCATTER_PRIME) % (uint64_t)freshSize);
+}
+
+// 지연 시간(ns)을 histogram 칸 위치로 바꾼다.
+static int WorkloadHistogramIndex(uint64_t ns)
+{
+	if(ns < WORKLOAD_SUB_BUCKETS) return (int)ns;
+
+	int msb = 63 - __builtin_clzll(ns);
+	int index = WORKLOAD_SUB_BUCKETS + (msb - 4) * WORKLOAD_SUB_BUCKETS + (int)((ns >> (msb - 4)) - WORKLOAD_SUB_BUCKETS);
+	return (index < WORKLOAD_HISTOGRAM_SIZE) ? index : WORKLOAD_HISTOGRAM_SIZE - 1;
+}
+
+// histogram 칸의 대표 지연 시간(칸 범위의 가운데, ns)
+static double WorkloadHistogramValue(int index)
+{
+	if(index < WORKLOAD_SUB_BUCKETS) return (double)index;
+
+	int shift = (index - WORKLOAD_SUB_BUCKETS) / WORKLOAD_SUB_BUCKETS;
+	int sub = (index - WORKLOAD_SUB_BUCKETS) % WORKLOAD_SUB_BUCKETS;
+	double low = (double)((uint64_t)(WORKLOAD_SUB_BUCKETS + sub) << shift);
+	return low + (double)(1ULL << shift) / 2.0;
+}
+
+// histogram 에서 누적 비율이 ratio 이상이 되는 지연 시간(ns)
+static double WorkloadPercentile(const uint64_t *histogram, uint64_t total, double ratio)
+{
+	uint64_t target = (uint64_t)ceil(ratio * (double)total);
+	uint64_t sum = 0;
+	int index = 0;
+
+	if(target == 0) target = 1;
+	for( ; index < WORKLOAD_HISTOGRAM_SIZE; index++)
+	{
+		sum += histogram[index];
+		if(sum >= target) return WorkloadHistogramValue(index);
+	}
+	return WorkloadHistogramValue(WORKLOAD_HISTOGRAM_SIZE - 1);
+}
+
+// 쉼표로 구분한 이름 목록을 비트 단위 값으로 바꾼다(모르는 이름이면 -1).
+static int WorkloadParseNames(const char *list, const char **names, int nameCount)
+{
+	char buffer[256];
+	char *token = NULL;
+	char *savePtr = NULL;
+	int mask = 0;
+	int index = 0;
+
+	snprintf(buffer, sizeof(buffer), "%s", list);
+	for(token = strtok_r(buffer, ",", &savePtr); token != NULL; token = strtok_r(NULL, ",", &savePtr))
+	{
+		for(index = 0; index < nameCount; index++)
+		{
+			if(strcmp(token, names[index]) == 0) break;
+		}
+		if(index == nameCount) return -1;
+		mask |= (1 << index);
+	}
+	return mask;
+}
+
+// 데이터 하나가 사용하는 메모리 추정치(노드, 버킷 하나의 리스트와 리스트 노드 2 개, Slot 주소, 키)
+static double WorkloadBytesPerEntry(void)
+{
+	return (double)(sizeof(JNode) * 3 + sizeof(JLinkedList) + sizeof(void*) + sizeof(int));
+}
+
+static double WorkloadAvailableBytes(void)
+{
+	return (double)sysconf(_SC_AVPHYS_PAGES) * (double)sysconf(_SC_PAGESIZE);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Workload
+////////////////////////////////////////////////////////////////////////////////
+
+static void* WorkloadWorker(void *data)
+{
+	WorkloadThreadArg *arg = (WorkloadThreadArg*)data;
+	int index = 0;
+	int isSuccess = 0;
+	int *key = NULL;
+	uint64_t choice = 0;
+	uint64_t before = 0;
+	uint64_t after = 0;
+
+	pthread_barrier_wait(arg->barrier);
+	for( ; index < arg->opCount; index++)
+	{
+		choice = 0;
+		if(arg->workload == WorkloadMixed) choice = WorkloadRandom(&(arg->random)) % 10;
+
+		if((arg->workload == WorkloadInsert) || (choice == 8))
+		{
+			key = &(arg->keys[WorkloadFreshIndex(arg->freshStart, arg->freshSize, arg->insertOrder++)]);
+			before = WorkloadNowNs();
+			isSuccess = (JHashTableAddData(arg->table, key, key) != NULL);
+		}
+		else if((arg->workload == WorkloadDelete) || (choice == 9))
+		{
+			key = &(arg->keys[WorkloadFreshIndex(arg->freshStart, arg->freshSize, arg->deleteOrder++)]);
+			before = WorkloadNowNs();
+			isSuccess = (JHashTableDeleteData(arg->table, key, key) == DeleteSuccess);
+		}
+		else
+		{
+			key = &(arg->keys[WorkloadNextKey(arg->storedZipf, (uint64_t)arg->size, &(arg->random))]);
+			before = WorkloadNowNs();
+			isSuccess = (JHashTableGet(arg->table, key) != NULL);
+		}
+		after = WorkloadNowNs();
+		arg->successCount += (uint64_t)isSuccess;
+		arg->histogram[WorkloadHistogramIndex(after - before)]++;
+	}
+	return NULL;
+}
+
+/**
+ * @fn static void WorkloadRun(FILE *out, int *isFirst, JHashTablePtr table, int *keys, long size, WorkloadType workload, WorkloadDist dist, const WorkloadZipf *storedZipf, int threadCount, int opsPerThread)
+ * @brief 연산 유형 하나를 스레드 threadCount 개로 측정하고 결과를 JSON 객체로 출력하는 함수
+ * 새로운 키 범위는 스레드마다 opsPerThread 개씩 나눠 주되 전체가 size 개를 넘지 않게 줄여서, 측정 중 데이터 개수가 size 의 2 배를 넘지 않게 한다.
+ * 추가와 삭제 측정은 연산 개수도 새로운 키 범위 크기로 줄이고(혼합 측정은 범위를 순환), 측정 후 새로운 키를 모두 삭제해서 다음 측정의 테이블 크기를 유지한다.
+ * 키 분포(Zipf)는 저장된 키를 검색하는 연산에만 적용하고, successRatio 로 실제로 성공한 연산의 비율을,
+ * tableCount 와 buckets 로 측정 시작 시 데이터 개수와 버킷 개수를 함께 출력한다.
+ * @return 반환값 없음
+ */
+static void WorkloadRun(FILE *out, int *isFirst, JHashTablePtr table, int *keys, long size, WorkloadType workload, WorkloadDist dist,
+	const WorkloadZipf *storedZipf, int threadCount, int opsPerThread)
+{
+	long freshSize = (size / threadCount < opsPerThread) ? size / threadCount : opsPerThread;
+	if(freshSize < 1) freshSize = 1;
+	long freshCount = (long)threadCount * freshSize;
+	int opCount = ((workload == WorkloadInsert) || (workload == WorkloadDelete)) ? (int)freshSize : opsPerThread;
+	long prefillCount = 0;
+	long index = 0;
+	int threadIndex = 0;
+	int histogramIndex = 0;
+	uint64_t histogram[WORKLOAD_HISTOGRAM_SIZE];
+	uint64_t total = 0;
+	uint64_t successCount = 0;
+	pthread_t threads[WORKLOAD_MAX_THREADS];
+	pthread_barrier_t barrier;
+	WorkloadThreadArg *args = (WorkloadThreadArg*)calloc((size_t)threadCount, sizeof(WorkloadThreadArg));
+	if(args == NULL) return;
+
+	// 삭제 측정은 새로운 키 범위를 미리 모두 채우고, 혼합 측정은 스레드별 범위에서 삭제할 앞쪽 절반(순열 순서)만 채운다.
+	if(workload == WorkloadDelete) prefillCount = freshSize;
+	else if(workload == WorkloadMixed) prefillCount = freshSize / 2;
+	for(threadIndex = 0; threadIndex < threadCount; threadIndex++)
+	{
+		for(index = 0; index < prefillCount; index++)
+		{
+			int *key = &keys[WorkloadFreshIndex(size + (long)threadIndex * freshSize, freshSize, index)];
+			JHashTableAddUnchecked(table, key, key);
+		}
+	}
+
+	int tableCount = JHashTableGetCount(table);
+	int bucketCount = JHashTableGetSize(table);
+	pthread_barrier_init(&barrier, NULL, (unsigned int)threadCount + 1);
+	for(threadIndex = 0; threadIndex < threadCount; threadIndex++)
+	{
+		args[threadIndex].table = table;
+		args[threadIndex].keys = keys;
+		args[threadIndex].size = size;
+		args[threadIndex].freshStart = size + (long)threadIndex * freshSize;
+		args[threadIndex].freshSize = freshSize;
+		args[threadIndex].insertOrder = (workload == WorkloadMixed) ? prefillCount : 0;
+		args[threadIndex].deleteOrder = 0;
+		args[threadIndex].workload = workload;
+		args[threadIndex].storedZipf = (dist == DistZipf) ? storedZipf : NULL;
+		args[threadIndex].random = ((uint64_t)threadIndex + 1) * (uint64_t)0x9E3779B97F4A7C15ULL + (uint64_t)size;
+		args[threadIndex].opCount = opCount;
+		args[threadIndex].barrier = &barrier;
+		pthread_create(&threads[threadIndex], NULL, WorkloadWorker, &args[threadIndex]);
+	}
+
+	// 연산 개수가 적으면 스레드가 장벽을 지나자마자 끝날 수 있으므로, 시작 시각은 장벽을 열기 전에 읽는다.
+	uint64_t start = WorkloadNowNs();
+	pthread_barrier_wait(&barrier);
+	for(threadIndex = 0; threadIndex < threadCount; threadIndex++) pthread_join(threads[threadIndex], NULL);
+	uint64_t elapsed = WorkloadNowNs() - start;
+	pthread_barrier_destroy(&barrier);
+
+	memset(histogram, 0, sizeof(histogram));
+	for(threadIndex = 0; threadIndex < threadCount; threadIndex++)
+	{
+		for(histogramIndex = 0; histogramIndex < WORKLOAD_HISTOGRAM_SIZE; histogramIndex++)
+		{
+			histogram[histogramIndex] += args[threadIndex].histogram[histogramIndex];
+			total += args[threadIndex].histogram[histogramIndex];
+		}
+		successCount += args[threadIndex].successCount;
+	}
+
+	fprintf(out, "%s\n    {\"workload\": \"%s\", \"dist\": \"%s\", \"size\": %ld, \"tableCount\": %d, \"buckets\": %d, \"threads\": %d, "
+		"\"ops\": %llu, \"seconds\": %.6f, \"opsPerSec\": %.0f, \"successRatio\": %.4f, \"p50Ns\": %.0f, \"p99Ns\": %.0f, \"p999Ns\": %.0f}",
+		(*isFirst != 0) ? "" : ",", workloadNames[workload], distNames[dist], size, tableCount, bucketCount, threadCount, (unsigned long long)total,
+		(double)elapsed / 1e9, (elapsed > 0) ? (double)total * 1e9 / (double)elapsed : 0.0,
+		(total > 0) ? (double)successCount / (double)total : 0.0,
+		WorkloadPercentile(histogram, total, 0.5), WorkloadPercentile(histogram, total, 0.99), WorkloadPercentile(histogram, total, 0.999));
+	fflush(out);
+	*isFirst = 0;
+
+	// 새로운 키 범위를 모두 삭제해서 저장된 키 개수만 남긴다.
+	for(index = 0; index < freshCount; index++) JHashTableRemoveKey(table, &keys[size + index]);
+	free(args);
+}
+
+/**
+ * @fn static void WorkloadRunSize(FILE *out, int *isFirst, const WorkloadConfig *config, long size)
+ * @brief 테이블 하나를 size 개 데이터로 채운 후 모든 키 분포, 연산 유형, 스레드 개수를 측정하는 함수
+ * 남은 메모리로 테이블을 만들 수 없으면 건너뛴 이유를 JSON 객체로 출력한다.
+ * @return 반환값 없음
+ */
+static void WorkloadRunSize(FILE *out, int *isFirst, const WorkloadConfig *config, long size)
+{
+	// 측정마다 새로운 키는 최대 size 개(스레드마다 최소 1 개)까지 사용하므로(WorkloadRun 참고), 버킷 개수도 size 에 맞춘다.
+	long freshMax = (long)config->maxThreads * (long)config->opsPerThread;
+	if(freshMax > size) freshMax = (size > config->maxThreads) ? size : config->maxThreads;
+	long totalKeys = size + freshMax;
+	double neededBytes = WorkloadBytesPerEntry() * (double)totalKeys;
+	int dist = 0;
+	int workload = 0;
+	int threadCount = 0;
+	long index = 0;
+
+	if((totalKeys > INT32_MAX) || (neededBytes > WorkloadAvailableBytes() * WORKLOAD_MEMORY_RATIO))
+	{
+		fprintf(out, "%s\n    {\"size\": %ld, \"skipped\": \"insufficient memory\", \"neededBytes\": %.0f, \"availableBytes\": %.0f}",
+			(*isFirst != 0) ? "" : ",", size, neededBytes, WorkloadAvailableBytes());
+		*isFirst = 0;
+		return;
+	}
+
+	int *keys = (int*)malloc(sizeof(int) * (size_t)totalKeys);
+	if(keys == NULL) return;
+	for(index = 0; index < totalKeys; index++) keys[index] = (int)index;
+
+	JHashTableOption option;
+	JHashTableInitOption(&option);
+	option.lockType = config->lockType;
+	option.lockStripeCount = config->lockStripeCount;
+
+	JHashTablePtr table = NewJHashTableWithOption((int)totalKeys, IntType, IntType, &option);
+	if(table == NULL)
+	{
+		free(keys);
+		return;
+	}
+
+	fprintf(stderr, "size %ld: filling\n", size);
+	for(index = 0; index < size; index++) JHashTableAddUnchecked(table, &keys[index], &keys[index]);
+
+	WorkloadZipf storedZipf;
+	if((config->distMask & (1 << DistZipf)) != 0) WorkloadZipfInit(&storedZipf, (uint64_t)size, config->theta);
+
+	for(dist = 0; dist < DistCount; dist++)
+	{
+		if((config->distMask & (1 << dist)) == 0) continue;
+		for(workload = 0; workload < WorkloadCount; workload++)
+		{
+			if((config->workloadMask & (1 << workload)) == 0) continue;
+			for(threadCount = 1; threadCount <= config->maxThreads; )
+			{
+				fprintf(stderr, "size %ld: %s %s t%d\n", size, distNames[dist], workloadNames[workload], threadCount);
+				WorkloadRun(out, isFirst, table, keys, size, (WorkloadType)workload, (WorkloadDist)dist, &storedZipf,
+					threadCount, config->opsPerThread);
+
+				if(threadCount == config->maxThreads) break;
+				threadCount = (threadCount * 2 > config->maxThreads) ? config->maxThreads : threadCount * 2;
+			}
+		}
+	}
+
+	DeleteJHashTable(&table);
+	free(keys);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Main Function
+////////////////////////////////////////////////////////////////////////////////
+
+static void WorkloadUsage(const char *name)
+{
+	fprintf(stderr,
+		"usage: %s [-s sizes] [-t maxThreads] [-o opsPerThread] [-w workloads] [-d dists] [-z theta] [-l lock] [-c stripes] [-f output]\n"
+		"  -s  테이블 크기 목록(쉼표 구분, 기본값 1000,10000,100000,1000000,10000000,100000000)\n"
+		"  -t  최대 스레드 개수(1, 2, 4 ... 순서로 측정, 기본값 CPU 개수)\n"
+		"  -o  스레드 하나의 측정 연산 개수(기본값 100000, 추가와 삭제는 테이블 크기 / 스레드 개수 이하로 줄임)\n"
+		"  -w  연산 유형(insert,find,delete,mixed)\n"
+		"  -d  키 분포(uniform,zipf)\n"
+		"  -z  Zipf 분포 기울기(0 < theta < 1, 기본값 0.99)\n"
+		"  -l  잠금 유형(rwlock, spinlock, lockfree, 기본값 rwlock)\n"
+		"  -c  버킷 잠금 개수(기본값 1024)\n"
+		"  -f  JSON 결과 파일(기본값 표준 출력)\n", name);
+}
+
+int main(int argc, char **argv)
+{
+	WorkloadConfig config;
+	const char *sizeList = "1000,10000,100000,1000000,10000000,100000000";
+	const char *outputPath = NULL;
+	const char *lockName = "rwlock";
+	char *token = NULL;
+	char *savePtr = NULL;
+	char sizeBuffer[256];
+	int option = 0;
+	int index = 0;
+	int isFirst = 1;
+
+	memset(&config, 0, sizeof(config));
+	config.maxThreads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+	config.opsPerThread = 100000;
+	config.workloadMask = (1 << WorkloadCount) - 1;
+	config.distMask = (1 << DistCount) - 1;
+	config.theta = 0.99;
+	config.lockType = RwLock;
+	config.lockStripeCount = 1024;
+
+	while((option = getopt(argc, argv, "s:t:o:w:d:z:l:c:f:h")) != -1)
+	{
+		switch(option)
+		{
+			case 's': sizeList = optarg; break;
+			case 't': config.maxThreads = atoi(optarg); break;
+			case 'o': config.opsPerThread = atoi(optarg); break;
+			case 'w': config.workloadMask = WorkloadParseNames(optarg, workloadNames, WorkloadCount); break;
+			case 'd': config.distMask = WorkloadParseNames(optarg, distNames, DistCount); break;
+			case 'z': config.theta = atof(optarg); break;
+			case 'l': lockName = optarg; break;
+			case 'c': config.lockStripeCount = atoi(optarg); break;
+			case 'f': outputPath = optarg; break;
+			default: WorkloadUsage(argv[0]); return 1;
+		}
+	}
+
+	if(strcmp(lockName, "rwlock") == 0) config.lockType = RwLock;
+	else if(strcmp(lockName, "spinlock") == 0) config.lockType = SpinLock;
+	else if(strcmp(lockName, "lockfree") == 0) config.lockType = LockFree;
+	else config.lockType = NoLock;
+
+	snprintf(sizeBuffer, sizeof(sizeBuffer), "%s", sizeList);
+	for(token = strtok_r(sizeBuffer, ",", &savePtr); (token != NULL) && (config.sizeCount < WORKLOAD_MAX_SIZES); token = strtok_r(NULL, ",", &savePtr))
+	{
+		config.sizes[config.sizeCount++] = atol(token);
+	}
+
+	if((config.maxThreads <= 0) || (config.maxThreads > WORKLOAD_MAX_THREADS) || (config.opsPerThread <= 0)
+		|| (config.workloadMask <= 0) || (config.distMask <= 0) || (config.theta <= 0) || (config.theta >= 1)
+		|| (config.lockType == NoLock) || (config.lockStripeCount <= 0) || (config.sizeCount == 0))
+	{
+		WorkloadUsage(argv[0]);
+		return 1;
+	}
+	for(index = 0; index < config.sizeCount; index++)
+	{
+		if(config.sizes[index] <= 0)
+		{
+			WorkloadUsage(argv[0]);
+			return 1;
+		}
+	}
+
+	FILE *out = stdout;
+	if(outputPath != NULL)
+	{
+		out = fopen(outputPath, "w");
+		if(out == NULL)
+		{
+			perror(outputPath);
+			return 1;
+		}
+	}
+
+	fprintf(out, "{\n  \"benchmark\": \"jhashtable-workload\",\n  \"lock\": \"%s\",\n  \"lockStripeCount\": %d,\n  \"opsPerThread\": %d,\n"
+		"  \"zipfTheta\": %.3f,\n  \"maxThreads\": %d,\n  \"results\": [", lockName, config.lockStripeCount, config.opsPerThread,
+		config.theta, config.maxThreads);
+	for(index = 0; index < config.sizeCount; index++) WorkloadRunSize(out, &isFirst, &config, config.sizes[index]);
+	fprintf(out, "\n  ]\n}\n");
+
+	if(out != stdout) fclose(out);
+	return 0;
+}
@@ -1,6 +1,10 @@
 #ifndef __JHASHTABLE_H__
 #define __JHASHTABLE_H__
 
+#include <stddef.h>
+#include <stdint.h>
+#include <pthread.h>
+
 ///////////////////////////////////////////////////////////////////////////////
 /// Enums
 ///////////////////////////////////////////////////////////////////////////////
@@ -23,6 +27,17 @@ typedef enum FindResult
 	FindSuccess = 1
 } FindResult;
 
+// 추가 결과 열거형(JHashTableGetOrInsert, JHashTableUpsert)
+typedef enum InsertResult
+{
+	// 실패
+	InsertFail = -1,
+	// 새로운 데이터를 추가함
+	InsertAdded = 1,
+	// 키가 이미 저장되어 있음(JHashTableUpsert 는 데이터를 교체함)
+	InsertExisting = 2
+} InsertResult;
+
 // 데이터 유형 열거형
 typedef enum DataType
 {
@@ -41,6 +56,30 @@ typedef enum HashType
 	StringType
 } HashType;
 
+// 저장소 유형 열거형
+typedef enum StorageType
+{
+	// 버킷마다 이중 연결 리스트를 두는 Chaining 방식
+	ChainStorage = 1,
+	// 슬롯마다 1 byte 제어 메타데이터를 두는 SwissTable 방식의 Open Addressing
+	OpenAddressStorage
+} StorageType;
+
+// 동시 접근 보호 유형 열거형
+typedef enum LockType
+{
+	// 알 수 없는 유형(JHashTableGetLockType 실패 시 반환, 테이블 생성에는 사용할 수 없음)
+	UnknownLock = -1,
+	// 동기화하지 않음(한 스레드에서만 사용)
+	NoLock = 0,
+	// 버킷 그룹마다 읽기/쓰기 잠금(pthread_rwlock_t) 사용, 검색끼리는 동시에 진행
+	RwLock,
+	// 버킷 그룹마다 스핀 잠금 사용, 잠금 구간이 짧고 스레드 수가 코어 수 이하일 때 사용
+	SpinLock,
+	// 잠금 없이 버킷마다 CAS 로 연결하는 단일 연결 리스트(Harris/Michael) 사용, 잠금을 잡은 스레드가 멈춰도 다른 스레드는 진행한다.
+	LockFree
+} LockType;
+
 ///////////////////////////////////////////////////////////////////////////////
 /// Macro
 ///////////////////////////////////////////////////////////////////////////////
@@ -50,13 +89,129 @@ typedef enum HashType
 #define HASH_FAIL -1
 #endif
 
+// Chaining 저장소의 기본 자동 확장 기준 적재율(데이터 개수 / 버킷 개수)
+#ifndef JHT_DEFAULT_LOAD_FACTOR
+#define JHT_DEFAULT_LOAD_FACTOR 1.0
+#endif
+
+// 점진적 재해싱 시 연산 한 번마다 옮기는 버킷 개수
+#ifndef JHT_REHASH_STEP
+#define JHT_REHASH_STEP 4
+#endif
+
+// 메모리 풀이 처음 할당하는 슬랩의 객체 개수(이후 슬랩마다 2 배씩 증가)
+#ifndef JHT_POOL_MIN_SLAB_OBJECTS
+#define JHT_POOL_MIN_SLAB_OBJECTS 64
+#endif
+
+// 메모리 풀 슬랩 하나의 최대 객체 개수
+#ifndef JHT_POOL_MAX_SLAB_OBJECTS
+#define JHT_POOL_MAX_SLAB_OBJECTS 4096
+#endif
+
+// 2 의 64 승 / 황금비(Fibonacci 해싱 곱셈 상수)
+#ifndef JHT_FIBONACCI_MULTIPLIER
+#define JHT_FIBONACCI_MULTIPLIER 0x9E3779B97F4A7C15ULL
+#endif
+
+// Open Addressing 저장소에서 한 번에 검사하는 제어 바이트(슬롯) 개수
+#ifndef JHT_GROUP_SIZE
+#define JHT_GROUP_SIZE 16
+#endif
+
+// (동시 접근 모드) 기본 버킷 잠금 개수
+#ifndef JHT_DEFAULT_LOCK_STRIPES
+#define JHT_DEFAULT_LOCK_STRIPES 64
+#endif
+
+// (동시 접근 모드) 최대 버킷 잠금 개수
+#ifndef JHT_MAX_LOCK_STRIPES
+#define JHT_MAX_LOCK_STRIPES 65536
+#endif
+
+// (잠금 없는 검색) 버킷 잠금 하나에 모인 삭제 대기 노드가 이 개수 이상이면 epoch 를 진행하고 해제를 시도한다.
+#ifndef JHT_RECLAIM_THRESHOLD
+#define JHT_RECLAIM_THRESHOLD 64
+#endif
+
+// (샤드 테이블) 최대 샤드 개수
+#ifndef JHT_MAX_SHARDS
+#define JHT_MAX_SHARDS 4096
+#endif
+
+// (병렬 적재) 최대 스레드 개수
+#ifndef JHT_MAX_BUILD_THREADS
+#define JHT_MAX_BUILD_THREADS 256
+#endif
+
+// (병렬 적재) 스레드 하나가 맡는 최소 데이터 개수(데이터가 적으면 스레드 개수를 줄인다)
+#ifndef JHT_BUILD_MIN_PAIRS_PER_THREAD
+#define JHT_BUILD_MIN_PAIRS_PER_THREAD 4096
+#endif
+
+// (병렬 적재) 스레드 하나당 나누는 버킷 구역 개수(데이터가 많은 구역을 맡은 스레드를 다른 스레드들이 기다리지 않도록 잘게 나눈다)
+#ifndef JHT_BUILD_PARTITIONS_PER_THREAD
+#define JHT_BUILD_PARTITIONS_PER_THREAD 16
+#endif
+
+// (작업 풀) 최대 스레드 개수
+#ifndef JHT_MAX_WORK_THREADS
+#define JHT_MAX_WORK_THREADS 256
+#endif
+
+// (병렬 순회) 작업 단위 하나가 맡는 버킷(슬롯) 개수
+#ifndef JHT_FOREACH_CHUNK_BUCKETS
+#define JHT_FOREACH_CHUNK_BUCKETS 256
+#endif
+
+// (순회 커서) 연결 리스트를 미리 읽어 두는 버킷 거리(Head 는 이 거리, 연결 리스트 구조체는 2 배 거리 앞을 읽는다)
+#ifndef JHT_ITER_PREFETCH_BUCKETS
+#define JHT_ITER_PREFETCH_BUCKETS 8
+#endif
+
+// (일괄 검색) 해쉬값을 먼저 모두 계산하는 키 묶음 크기(스택에 해쉬값과 Slot 위치를 둔다)
+#ifndef JHT_FIND_BATCH_SIZE
+#define JHT_FIND_BATCH_SIZE 64
+#endif
+
+// (일괄 검색) 기본 prefetch 거리(prefetch 단계 하나가 앞서는 키 개수)
+#ifndef JHT_DEFAULT_PREFETCH_DISTANCE
+#define JHT_DEFAULT_PREFETCH_DISTANCE 4
+#endif
+
+// (일괄 검색) 최대 prefetch 거리(4 단계가 모두 키 묶음 안에서 앞서도록 키 묶음 크기의 1/4)
+#define JHT_MAX_PREFETCH_DISTANCE (JHT_FIND_BATCH_SIZE / 4)
+
+// (일괄 추가) 해쉬값을 먼저 모두 계산하고 버킷별로 묶는 데이터 묶음 크기(스택에 해쉬값과 묶음 정보를 둔다)
+#ifndef JHT_ADD_BATCH_SIZE
+#define JHT_ADD_BATCH_SIZE 256
+#endif
+
+// (쓰기 버퍼) 비우기 크기를 지정하지 않았을 때 모아 두는 데이터 개수
+#ifndef JHT_DEFAULT_FLUSH_SIZE
+#define JHT_DEFAULT_FLUSH_SIZE 256
+#endif
+
+// 캐시 라인 크기(잠금끼리 같은 캐시 라인을 공유하지 않도록 정렬할 때 사용)
+#ifndef JHT_CACHE_LINE_SIZE
+#define JHT_CACHE_LINE_SIZE 64
+#endif
+
 ///////////////////////////////////////////////////////////////////////////////
 /// Definitions
 ///////////////////////////////////////////////////////////////////////////////
 
-typedef int (*_jhashInt_f)(int key, int hashSize);
-typedef int (*_jhashChar_f)(char key, int hashSize);
-typedef int (*_jhashString_f)(const char* key, int hashSize);
+// 키 해싱 함수 유형(seed 를 반영한 64 bit 전체 해쉬값 반환)
+// 버킷 위치는 전체 해쉬값을 버킷 개수로 나눈 나머지로 정한다.
+typedef uint64_t (*_jhashInt_f)(int key, uint64_t seed);
+typedef uint64_t (*_jhashChar_f)(char key, uint64_t seed);
+typedef uint64_t (*_jhashString_f)(const char* key, uint64_t seed);
+
+// 순회 함수 유형(키, 데이터, 사용자 데이터), 0 이 아닌 값을 반환하면 순회를 멈춘다.
+typedef int (*_jhashVisit_f)(void *key, void *value, void *ctx);
+
+// (작업 풀) 작업 단위 하나를 처리하는 함수 유형(작업 인자, 작업 단위 위치, 처리하는 스레드 위치)
+typedef void (*_jworkTask_f)(void *arg, int taskIndex, int workerIndex);
 
 // Linked List 에서 data 를 관리하기 위한 노드 구조체
 typedef struct _jnode_t {
@@ -64,10 +219,44 @@ typedef struct _jnode_t {
 	struct _jnode_t *prev;
 	// 다음 노드 주소
 	struct _jnode_t *next;
+	// Key
+	void *key;
 	// Value
 	void *data;
+	// Key 의 전체 해쉬값(해쉬 테이블에서 키 비교 전에 먼저 비교, 키가 없으면 0)
+	uint64_t hash;
+	// 세대 번호(메모리 풀에 반환하거나 삭제 대기할 때마다 증가, 핸들이 가리키는 노드가 그대로인지 확인)
+	uint32_t generation;
 } JNode, *JNodePtr, **JNodePtrContainer;
 
+// 같은 크기의 객체들을 큰 슬랩 단위로 할당하고 재사용하는 메모리 풀 구조체
+typedef struct _jpool_t {
+	// 객체 하나의 크기
+	size_t objectSize;
+	// 반환된 객체들의 단일 연결 리스트(객체의 첫 포인터 크기 공간을 다음 주소로 사용)
+	void *freeList;
+	// 할당한 슬랩들의 단일 연결 리스트(가장 최근 슬랩이 처음)
+	void *slabs;
+	// 가장 최근 슬랩에서 아직 한 번도 사용하지 않은 첫 객체 주소
+	char *cursor;
+	// 가장 최근 슬랩에서 아직 한 번도 사용하지 않은 객체 개수
+	int remaining;
+	// 다음 슬랩의 객체 개수
+	int nextSlabObjects;
+	// 할당한 슬랩 개수
+	int slabCount;
+	// 사용 중인 객체 개수
+	int usedObjects;
+} JPool, *JPoolPtr;
+
+// 해쉬 테이블 하나의 노드와 연결 리스트를 할당하는 메모리 풀 묶음 구조체
+typedef struct _jnodepool_t {
+	// JNode 메모리 풀(Head, Tail 노드 포함)
+	JPool nodes;
+	// JLinkedList 메모리 풀
+	JPool lists;
+} JNodePool, *JNodePoolPtr;
+
 // Hash Table value 를 관리하는 이중 연결 리스트 구조체
 typedef struct _jlinkedlist_t {
 	// 해쉬값(Key 를 해쉬 테이블의 크기로 해싱한 값)
@@ -80,10 +269,164 @@ typedef struct _jlinkedlist_t {
 	JNodePtr tail;
 	// 사용자 데이터
 	void *data;
+	// 노드와 연결 리스트를 할당한 메모리 풀(NULL 이면 malloc 사용)
+	JNodePoolPtr pool;
 } JLinkedList, *JLinkedListPtr, **JLinkedListPtrContainer;
 
+// 데이터가 있는 버킷을 1 bit 로 표시하는 bitmap 구조체
+// 처음/마지막 데이터 검색 시 64 개 버킷씩 tzcnt/lzcnt 로 검사한다.
+typedef struct _jbucketbitmap_t {
+	// 버킷 64 개당 하나씩 사용하는 bit 배열
+	uint64_t *words;
+	// bit 배열 크기
+	int wordCount;
+	// 0 이 아닐 수 있는 첫 번째 word 위치(이보다 앞의 word 는 모두 0)
+	int lowWord;
+	// 0 이 아닐 수 있는 마지막 word 위치(이보다 뒤의 word 는 모두 0)
+	int highWord;
+	// 여러 스레드가 함께 갱신하는지 여부
+	// 1 이면 word 와 위치 범위를 원자적으로 갱신하고, 검색 시 위치 범위를 줄이지 않는다.
+	int isShared;
+} JBucketBitmap, *JBucketBitmapPtr;
+
+// (잠금 없는 검색) 삭제 대기 노드 목록 구조체
+// 분리된 노드를 삭제 시점 epoch % 3 위치별로 모아 두고, 검색 중인 스레드가 모두 지나간 목록부터 해제한다.
+typedef struct _jretirelist_t {
+	// epoch % 3 위치별 삭제 대기 노드 목록(노드의 prev 로 연결)
+	JNodePtr nodes[3];
+	// 목록별 삭제 시점의 epoch
+	uint64_t epochs[3];
+	// 삭제 대기 노드 개수
+	int count;
+} JRetireList, *JRetireListPtr;
+
+// (동시 접근 모드) 버킷 그룹 하나를 보호하는 잠금 구조체
+// 연속된 버킷 묶음(최대 64 개) 단위로 나누어 잠금 개수로 나눈 나머지가 같은 묶음들을 보호하며,
+// 잠금끼리 캐시 라인을 공유하지 않도록 정렬한다.
+typedef struct _jlockstripe_t {
+	// 읽기/쓰기 잠금(RwLock)
+	pthread_rwlock_t rwlock;
+	// 스핀 잠금 상태(SpinLock, 0 이면 해제)
+	int spinLock;
+	// 보호하는 버킷들에 저장된 데이터 개수
+	int count;
+	// 보호하는 버킷들의 노드와 연결 리스트를 메모리 풀에서 할당하는지 여부
+	int usePool;
+	// 보호하는 버킷들의 노드와 연결 리스트 메모리 풀(잠금 안에서만 사용)
+	JNodePool pool;
+	// (잠금 없는 검색) 보호하는 버킷들에서 분리된 삭제 대기 노드 목록(잠금 안에서만 사용)
+	JRetireList retired;
+} __attribute__((aligned(JHT_CACHE_LINE_SIZE))) JLockStripe, *JLockStripePtr;
+
+// (잠금 없는 검색) 스레드별 검색 상태 구조체
+// 스레드가 테이블을 처음 검색할 때 등록되며, 검색 중인 동안 시작 시점의 epoch 를 게시한다.
+typedef struct _jepochrecord_t {
+	// 검색을 시작할 때 읽은 전체 epoch(검색 중이 아니면 0)
+	uint64_t localEpoch;
+	// 중첩된 검색 구간 개수(사용 중인 스레드만 변경, 0 이 되면 localEpoch 를 지운다)
+	int depth;
+	// 사용 상태(0: 반환됨, 1: 사용 중, 2: 스레드가 가져가는 중), JHashTableReleaseThread 호출 시 0
+	int isUsed;
+	// 사용 중인 스레드
+	pthread_t owner;
+	// (잠금 없는 버킷) 스레드가 분리한 삭제 대기 노드 목록(사용 중인 스레드만 변경)
+	JRetireList retired;
+	// (잠금 없는 버킷) 스레드가 추가한 데이터 개수 - 삭제한 데이터 개수(사용 중인 스레드만 변경)
+	int count;
+	// 다음 검색 상태
+	struct _jepochrecord_t *next;
+} __attribute__((aligned(JHT_CACHE_LINE_SIZE))) JEpochRecord, *JEpochRecordPtr;
+
+// (작업 풀) 스레드 하나가 처리할 작업 단위 범위 구조체
+// 시작 위치(하위 32 bit)와 끝 위치(상위 32 bit)를 하나의 64 bit 값으로 두고 CAS 로 변경한다.
+// 스레드는 자신의 범위 앞에서부터 하나씩 가져가고, 범위가 비면 다른 스레드 범위의 뒤쪽 절반을 가져온다(work stealing).
+typedef struct _jworkqueue_t {
+	// 남은 작업 단위 범위
+	uint64_t range;
+	// 작업 풀
+	struct _jworkpool_t *pool;
+	// 스레드 위치(0 은 작업을 요청한 스레드)
+	int workerIndex;
+} __attribute__((aligned(JHT_CACHE_LINE_SIZE))) JWorkQueue, *JWorkQueuePtr;
+
+// 작업 풀 구조체
+// 생성 시 만든 스레드들을 작업마다 다시 사용하며, 작업을 요청한 스레드도 함께 처리한다.
+// 한 번에 하나의 작업만 요청할 수 있다.
+typedef struct _jworkpool_t {
+	// 작업을 처리하는 스레드 개수(작업을 요청한 스레드 포함)
+	int threadCount;
+	// 생성한 스레드 배열(threadCount - 1 개)
+	pthread_t *threads;
+	// 작업 시작/완료 상태를 보호하는 잠금
+	pthread_mutex_t mutex;
+	// 새로운 작업 시작 알림
+	pthread_cond_t startCond;
+	// 작업 완료 알림
+	pthread_cond_t doneCond;
+	// 작업 순번(작업을 요청할 때마다 1 증가)
+	uint64_t generation;
+	// 현재 작업을 처리 중인 생성된 스레드 개수
+	int busyCount;
+	// 종료 요청 여부
+	int isStopping;
+	// 작업 단위 하나를 처리하는 함수
+	_jworkTask_f taskFunc;
+	// 작업 인자
+	void *taskArg;
+	// 스레드별 작업 단위 범위(threadCount 개)
+	JWorkQueuePtr queues;
+} JWorkPool, *JWorkPoolPtr, **JWorkPoolPtrContainer;
+
+// Open Addressing 저장소에서 key 와 value 를 관리하는 슬롯 구조체
+typedef struct _jslot_t {
+	// Key
+	void *key;
+	// Value
+	void *data;
+} JSlot, *JSlotPtr;
+
+// Hash Table 생성 옵션 구조체
+// JHashTableInitOption 으로 기본값을 채운 후 필요한 항목만 변경해서 사용한다.
+typedef struct _jhashtable_option_t {
+	// 저장소 유형(기본값: ChainStorage)
+	StorageType storageType;
+	// (Chaining) 자동 확장 기준 적재율, 0 이하이면 확장하지 않음(기본값: JHT_DEFAULT_LOAD_FACTOR)
+	double loadFactor;
+	// (Chaining) 노드와 연결 리스트를 테이블 전용 메모리 풀에서 할당할지 여부, 0 이면 malloc 사용(기본값: 1)
+	int useNodePool;
+	// (Chaining) 버킷 개수를 2 의 거듭제곱으로 올림하고, 전체 해쉬값에 Fibonacci 곱셈 혼합을 적용한
+	// 상위 bit 로 버킷 위치를 정할지 여부(나눗셈 제거, 연속/일정 간격 키 분산), 0 이면 나머지 연산 사용(기본값: 0)
+	int powerOfTwoBuckets;
+	// int 형(정수) 키 해싱 함수, NULL 이면 저장소별 기본 함수 사용(기본값: NULL)
+	// 기본 함수 : Chaining 은 JHashIntModulo, JHashCharSum, JHashStringWy / Open Addressing 은 JHashIntMix, JHashCharMix, JHashStringWy
+	_jhashInt_f intHashFunc;
+	// char 형(문자) 키 해싱 함수, NULL 이면 저장소별 기본 함수 사용(기본값: NULL)
+	_jhashChar_f charHashFunc;
+	// char* 형(문자열) 키 해싱 함수, NULL 이면 저장소별 기본 함수 사용(기본값: NULL)
+	_jhashString_f stringHashFunc;
+	// 해싱 함수에 전달할 seed(기본값: 0)
+	uint64_t hashSeed;
+	// (Chaining) 동시 접근 보호 유형, NoLock 이 아니면 여러 스레드에서 같은 테이블을 사용할 수 있다(기본값: NoLock)
+	// 동시 접근 모드에서는 cooperativeResize 를 사용하지 않으면 자동 확장(재해싱)을 하지 않으므로 예상 데이터 개수에 맞게 버킷 개수를 지정한다.
+	// LockFree 는 버킷 잠금과 메모리 풀을 사용하지 않고(lockStripeCount, useNodePool 무시) 검색도 잠금 없이 수행하며,
+	// 한 버킷 안의 데이터는 전체 해쉬값 순서(같으면 추가 순서)로 저장한다.
+	LockType lockType;
+	// (Chaining) 동시 접근 모드의 버킷 잠금 개수, 2 의 거듭제곱으로 올림(기본값: JHT_DEFAULT_LOCK_STRIPES)
+	int lockStripeCount;
+	// (Chaining) 동시 접근 모드에서 검색(Find, Get, GetFirst, GetLast)을 잠금 없이 수행할지 여부(기본값: 0)
+	// 삭제된 노드는 epoch 기반으로 검색 중인 스레드가 없을 때 해제한다.
+	// 삭제한 키와 데이터의 메모리는 JHashTableSynchronize 호출 후 해제해야 한다.
+	int lockFreeRead;
+	// (Chaining) 동시 접근 모드(RwLock, SpinLock)에서 loadFactor 기준으로 자동 확장할지 여부(기본값: 0)
+	// 기존 Slot 배열과 2 배 크기의 새로운 Slot 배열을 함께 두고, 각 연산이 기존 Slot 몇 개씩을 나누어 옮긴다.
+	// 옮겨진 Slot 에는 전달 표시를 남겨 검색이 새로운 Slot 배열로 이어지며, lockFreeRead 와 함께 사용할 수 없다.
+	int cooperativeResize;
+	// 일괄 검색(JHashTableFindBatch)의 prefetch 거리, 0 이면 prefetch 하지 않음(0 ~ JHT_MAX_PREFETCH_DISTANCE, 기본값: JHT_DEFAULT_PREFETCH_DISTANCE)
+	int prefetchDistance;
+} JHashTableOption, *JHashTableOptionPtr;
+
 // Hash Table 관리 구조체
-// Chaining 방식
+// Chaining 방식 또는 Open Addressing 방식
 typedef struct _jhashtable_t {
 	// 해쉬 테이블의 전체 크기
 	int size;
@@ -91,16 +434,248 @@ typedef struct _jhashtable_t {
 	HashType keyType;
 	// 저장할 Value 데이터 유형
 	HashType valueType;
-	// 해쉬 테이블에서 관리하는 Slot 들
+	// 저장소 유형
+	StorageType storageType;
+	// 저장된 전체 데이터 개수
+	int count;
+	// (Chaining) 해쉬 테이블에서 관리하는 Slot 들
+	// 비어 있는 Slot 은 NULL 이며, 처음 데이터가 추가될 때 연결 리스트를 생성한다.
+	// 동시 접근 모드의 재해싱 중 새로운 Slot 배열로 옮겨진 Slot 에는 전달 표시가 저장된다.
 	JLinkedListPtrContainer listContainer;
+	// (Chaining) 자동 확장 기준 적재율, 0 이하이면 확장하지 않음
+	double loadFactor;
+	// (Chaining) 노드와 연결 리스트를 할당하는 메모리 풀(사용하지 않으면 NULL)
+	JNodePoolPtr nodePool;
+	// (Chaining) 데이터가 있는 Slot 들의 bitmap
+	JBucketBitmap occupied;
+	// (Chaining) 재해싱 중 새로운 Slot 들의 bitmap
+	JBucketBitmap rehashOccupied;
+	// (Chaining) 버킷 개수가 2 의 거듭제곱이고 Fibonacci 곱셈 혼합으로 버킷 위치를 정하는지 여부
+	int powerOfTwoBuckets;
+	// (Chaining) 점진적 재해싱 중 데이터를 옮겨 받는 새로운 Slot 들(재해싱 중이 아니면 NULL)
+	// 비어 있는 Slot 은 처음 데이터가 옮겨질 때 연결 리스트를 생성한다.
+	JLinkedListPtrContainer rehashContainer;
+	// (Chaining) 새로운 Slot 들의 개수
+	int rehashSize;
+	// (Chaining) 다음에 옮길 기존 Slot 의 위치(이보다 앞의 Slot 들은 이미 옮겨짐)
+	// 동시 접근 모드에서는 다음에 옮기기를 맡을 기존 Slot 의 위치(맡은 Slot 은 옮기는 중일 수 있음)
+	int rehashIndex;
+	// (Open Addressing) 슬롯별 제어 바이트 배열(EMPTY, DELETED 또는 7 bit 해쉬 태그)
+	// 그룹 단위 검사가 배열 끝을 넘지 않도록 앞쪽 JHT_GROUP_SIZE 개의 바이트를 뒤에 복제해서 관리한다.
+	signed char *ctrlBytes;
+	// (Open Addressing) 슬롯 배열
+	JSlotPtr slots;
+	// (Open Addressing) 삭제 표시된 슬롯 개수
+	int deletedSlots;
+	// (Open Addressing) 슬롯 배열을 새로 할당할 때마다 증가하는 세대 번호(핸들의 슬롯 위치가 아직 유효한지 확인)
+	uint32_t slotsGeneration;
 	// int 형(정수) 키 해싱 함수
 	_jhashInt_f intHashFunc;
 	// char 형(문자) 키 해싱 함수
 	_jhashChar_f charHashFunc;
 	// char* 형(문자열) 키 해싱 함수
 	_jhashString_f stringHashFunc;
+	// 해싱 함수에 전달할 seed
+	uint64_t hashSeed;
+	// (Chaining) 동시 접근 보호 유형
+	LockType lockType;
+	// (Chaining) 버킷 잠금 배열(동시 접근 모드가 아니면 NULL)
+	// 동시 접근 모드에서는 데이터 개수와 메모리 풀을 잠금별로 나누어 관리한다.
+	JLockStripePtr lockStripes;
+	// (Chaining) 버킷 잠금 개수(2 의 거듭제곱)
+	int lockStripeCount;
+	// (Chaining) 하나의 잠금이 연속해서 보호하는 버킷 개수의 log2 값(0 ~ 6)
+	int lockStripeShift;
+	// (동시 접근 모드) 잠금 위치를 정하는 기준 버킷 개수(생성 시 버킷 개수)
+	// 키의 잠금은 이 개수 기준의 버킷 위치로 정하므로, 2 배씩 확장해도 키를 보호하는 잠금은 바뀌지 않는다.
+	int lockBaseSize;
+	// (동시 접근 모드) 자동 확장 여부
+	int cooperativeResize;
+	// (동시 접근 모드) 새로운 Slot 배열로 옮기기를 마친 기존 Slot 개수
+	int rehashDoneCount;
+	// (동시 접근 모드) 메모리 할당 실패로 옮기지 못한 기존 Slot 이 있는지 여부(1 이면 다시 시도)
+	int rehashRetry;
+	// (동시 접근 모드) 재해싱 시작/완료(쓰기)와 재해싱 상태를 읽는 작업(읽기)을 구분하는 잠금
+	// 추가, 검색, 삭제는 버킷 잠금만 사용하고 이 잠금은 잡지 않는다.
+	pthread_rwlock_t resizeLock;
+	// (Chaining) 검색을 잠금 없이 수행하는지 여부
+	int lockFreeRead;
+	// (잠금 없는 검색) 전체 epoch(1 부터 시작)
+	uint64_t globalEpoch;
+	// (잠금 없는 검색) 스레드별 검색 상태를 찾을 때 테이블을 구분하는 값(테이블마다 다름)
+	uint64_t epochDomainId;
+	// (잠금 없는 검색) 등록된 스레드별 검색 상태 목록
+	JEpochRecordPtr epochRecords;
+	// (잠금 없는 버킷) 버킷별 단일 연결 리스트의 첫 노드 주소 배열(LockFree 가 아니면 NULL)
+	// 노드의 next 최하위 bit 가 1 이면 삭제 표시된 노드이다.
+	JNodePtr *lockFreeBuckets;
+	// 일괄 검색의 prefetch 거리(0 이면 prefetch 하지 않음)
+	int prefetchDistance;
 } JHashTable, *JHashTablePtr, **JHashTablePtrContainer;
 
+// 해쉬 테이블 순회 커서 구조체
+// 스택에 두고 사용하며, 순회 중에 메모리를 할당하지 않는다.
+typedef struct _jhashtable_iter_t {
+	// 순회 중인 해쉬 테이블
+	JHashTablePtr table;
+	// 현재 Slot 배열(0 이면 기존 Slot 배열, 1 이면 재해싱 중인 새로운 Slot 배열)
+	int containerIndex;
+	// 현재 버킷(슬롯) 위치(순회가 끝나면 HASH_FAIL)
+	int listIndex;
+	// (Chaining) 현재 버킷의 연결 리스트
+	JLinkedListPtr list;
+	// (Chaining, LockFree) 현재 노드
+	JNodePtr node;
+	// (Chaining, LockFree) 현재 데이터를 삭제했을 때 이어서 순회할 노드
+	JNodePtr nextNode;
+	// 현재 데이터를 삭제했는지 여부
+	int isDeleted;
+} JHashTableIter, *JHashTableIterPtr;
+
+// 검색한 데이터의 위치를 나타내는 핸들 구조체
+// JHashTableFindEntry 로 채우고 JHashTableEraseHandle 로 버킷을 다시 검색하지 않고 삭제한다.
+// 찾은 데이터가 다른 함수로 삭제되었으면 JHashTableEraseHandle 은 노드를 분리하지 않고 DeleteFail 을 반환한다.
+// 데이터는 노드(슬롯)로 구분하므로 JHashTableUpsert 로 데이터를 교체해도 핸들은 그대로 사용할 수 있다.
+typedef struct _jhashtable_entry_t {
+	// (Chaining, LockFree) 찾은 노드
+	JNodePtr node;
+	// 찾은 키
+	void *key;
+	// 찾은 데이터
+	void *data;
+	// 키의 해쉬값(재해싱으로 노드가 옮겨져도 버킷 위치를 바로 계산한다)
+	uint64_t hash;
+	// (Chaining, LockFree) 찾은 노드의 세대 번호, (Open Addressing) 찾은 슬롯 배열의 세대 번호
+	uint32_t generation;
+	// (Open Addressing) 찾은 슬롯 위치
+	int slotIndex;
+} JHashTableEntry, *JHashTableEntryPtr;
+
+// (샤드 테이블) 샤드 하나의 상태와 누적 통계 구조체
+typedef struct _jhashshardstats_t {
+	// 저장된 데이터 개수
+	int count;
+	// 해쉬 테이블의 전체 크기(버킷 또는 슬롯 개수)
+	int size;
+	// 추가 요청 횟수
+	uint64_t addCount;
+	// 검색 요청 횟수
+	uint64_t findCount;
+	// 삭제 요청 횟수
+	uint64_t deleteCount;
+	// 잠금을 바로 잡지 못하고 기다린 횟수
+	uint64_t contendedCount;
+} JHashShardStats, *JHashShardStatsPtr;
+
+// (샤드 테이블) 샤드 하나를 관리하는 구조체
+// 샤드끼리 캐시 라인을 공유하지 않도록 정렬한다.
+typedef struct _jhashshard_t {
+	// 읽기/쓰기 잠금(RwLock)
+	pthread_rwlock_t rwlock;
+	// 스핀 잠금 상태(SpinLock, 0 이면 해제)
+	int spinLock;
+	// 샤드의 해쉬 테이블(잠금 안에서만 사용)
+	JHashTablePtr table;
+	// 추가 요청 횟수
+	uint64_t addCount;
+	// 검색 요청 횟수
+	uint64_t findCount;
+	// 삭제 요청 횟수
+	uint64_t deleteCount;
+	// 잠금을 바로 잡지 못하고 기다린 횟수
+	uint64_t contendedCount;
+} __attribute__((aligned(JHT_CACHE_LINE_SIZE))) JHashShard, *JHashShardPtr;
+
+// 샤드 테이블 관리 구조체
+// 여러 개의 해쉬 테이블(샤드)을 두고 키의 해쉬값 상위 bit 로 샤드를 정하며, 샤드마다 잠금 하나로 보호한다.
+typedef struct _jshardedhashtable_t {
+	// 샤드 개수(2 의 거듭제곱)
+	int shardCount;
+	// 샤드 위치로 사용하는 해쉬값 상위 bit 개수(log2(shardCount))
+	int shardBits;
+	// 샤드 잠금 유형
+	LockType lockType;
+	// 샤드 배열
+	JHashShardPtr shards;
+} JShardedHashTable, *JShardedHashTablePtr, **JShardedHashTablePtrContainer;
+
+// (쓰기 버퍼) 버퍼에 모아 둔 데이터 하나의 구조체
+typedef struct _jbufferentry_t {
+	// 키
+	void *key;
+	// 데이터
+	void *value;
+	// 키의 전체 해쉬값(동시 접근 모드에서만 사용)
+	uint64_t hash;
+	// 키의 잠금 위치(동시 접근 모드에서만 사용)
+	int lockIndex;
+	// 같은 잠금 그룹의 다음 데이터 위치(마지막이면 -1)
+	int next;
+} JBufferEntry, *JBufferEntryPtr;
+
+// (쓰기 버퍼) 누적 통계 구조체
+typedef struct _jinsertbufferstats_t {
+	// 버퍼에 추가한 데이터 개수
+	uint64_t bufferedCount;
+	// 테이블에 추가된 데이터 개수(이미 저장되어 있던 데이터 제외)
+	uint64_t insertedCount;
+	// 비우기 횟수
+	uint64_t flushCount;
+	// 그 중 대기 시간을 넘어서 비운 횟수
+	uint64_t delayFlushCount;
+	// 비우면서 잡은 잠금 횟수
+	uint64_t lockCount;
+	// 비우기에 걸린 전체 시간(ns)
+	uint64_t totalFlushNs;
+	// 가장 오래 걸린 비우기 시간(ns)
+	uint64_t maxFlushNs;
+	// 데이터가 버퍼에서 기다린 가장 긴 시간(ns)
+	uint64_t maxDelayNs;
+} JInsertBufferStats, *JInsertBufferStatsPtr;
+
+// (쓰기 버퍼) 스레드 하나가 사용하는 추가 버퍼 구조체
+// 추가할 데이터를 잠금 그룹별로 모아 두었다가 한 번에 테이블에 추가하며, 비울 때 잠금 그룹마다 잠금을 한 번만 잡는다.
+// 버퍼 하나는 한 스레드만 사용해야 하고, 비우기 전까지 모아 둔 데이터는 검색되지 않는다.
+typedef struct _jinsertbuffer_t {
+	// 데이터를 추가할 해쉬 테이블
+	JHashTablePtr table;
+	// 비우기 크기(모아 둔 데이터가 이 개수가 되면 비운다)
+	int flushSize;
+	// 최대 대기 시간(ns, 처음 모아 둔 데이터가 이 시간보다 오래 기다렸으면 다음 추가 시 비운다, 0 이면 사용 안함)
+	uint64_t flushDelayNs;
+	// 모아 둔 데이터 배열(flushSize 개)
+	JBufferEntryPtr entries;
+	// 모아 둔 데이터 개수
+	int entryCount;
+	// 잠금 그룹 개수(동시 접근 모드면 잠금 개수, 아니면 1)
+	int groupCount;
+	// 잠금 그룹별 첫 데이터 위치 배열(비어 있으면 -1)
+	int *groupHeads;
+	// 잠금 그룹별 마지막 데이터 위치 배열
+	int *groupTails;
+	// 잠금 그룹별 데이터 개수 배열
+	int *groupSizes;
+	// 데이터가 있는 잠금 그룹 위치 배열(처음 데이터를 모아 둔 순서, 비울 때 이 그룹들만 확인한다)
+	int *usedGroups;
+	// 데이터가 있는 잠금 그룹 개수
+	int usedGroupCount;
+	// 처음 모아 둔 데이터의 추가 시각(ns)
+	uint64_t firstAddNs;
+	// 누적 통계
+	JInsertBufferStats stats;
+} JInsertBuffer, *JInsertBufferPtr, **JInsertBufferPtrContainer;
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for Hash
+///////////////////////////////////////////////////////////////////////////////
+
+uint64_t JHashIntModulo(int key, uint64_t seed);
+uint64_t JHashIntMix(int key, uint64_t seed);
+uint64_t JHashCharSum(char key, uint64_t seed);
+uint64_t JHashCharMix(char key, uint64_t seed);
+uint64_t JHashStringSum(const char* key, uint64_t seed);
+uint64_t JHashStringWy(const char* key, uint64_t seed);
+
 ///////////////////////////////////////////////////////////////////////////////
 // Functions for JNode
 ///////////////////////////////////////////////////////////////////////////////
@@ -109,6 +684,8 @@ JNodePtr NewJNode();
 DeleteResult DeleteJNode(JNodePtrContainer container);
 void* JNodeGetData(const JNodePtr node);
 void* JNodeSetData(JNodePtr node, void *data);
+void* JNodeGetKey(const JNodePtr node);
+void* JNodeSetKey(JNodePtr node, void *key);
 
 ///////////////////////////////////////////////////////////////////////////////
 // Functions for JLinkedList
@@ -122,6 +699,8 @@ void* JLinkedListSetData(JLinkedListPtr list, void *data);
 JLinkedListPtr JLinkedListAddNode(JLinkedListPtr list, void *data);
 void* JLinkedListGetFirstNodeData(const JLinkedListPtr list);
 void* JLinkedListGetLastNodeData(const JLinkedListPtr list);
+void* JLinkedListPopFront(JLinkedListPtr list);
+void* JLinkedListPopBack(JLinkedListPtr list);
 
 DeleteResult JLinkedListDeleteNodeData(JLinkedListPtr list, void *data);
 FindResult JLinkedListFindNodeData(const JLinkedListPtr list, void *data);
@@ -130,13 +709,30 @@ FindResult JLinkedListFindNodeData(const JLinkedListPtr list, void *data);
 // Functions for JHashTable
 ///////////////////////////////////////////////////////////////////////////////
 
+JHashTableOptionPtr JHashTableInitOption(JHashTableOptionPtr option);
 JHashTablePtr NewJHashTable(int size, HashType keyType, HashType valueType);
+JHashTablePtr NewJHashTableWithOption(int size, HashType keyType, HashType valueType, const JHashTableOptionPtr option);
 DeleteResult DeleteJHashTable(JHashTablePtrContainer container);
 
 int JHashTableGetSize(const JHashTablePtr table);
+int JHashTableGetCount(const JHashTablePtr table);
 int JHashTableGetType(const JHashTablePtr table);
+StorageType JHashTableGetStorageType(const JHashTablePtr table);
+LockType JHashTableGetLockType(const JHashTablePtr table);
+void JHashTableSynchronize(JHashTablePtr table);
+void JHashTableReleaseThread(JHashTablePtr table);
 JHashTablePtr JHashTableSetType(JHashTablePtr table, DataType dataType, HashType hashType);
+JHashTablePtr JHashTableSetIntHashFunc(JHashTablePtr table, _jhashInt_f hashFunc);
+JHashTablePtr JHashTableSetCharHashFunc(JHashTablePtr table, _jhashChar_f hashFunc);
+JHashTablePtr JHashTableSetStringHashFunc(JHashTablePtr table, _jhashString_f hashFunc);
+JHashTablePtr JHashTableSetHashSeed(JHashTablePtr table, uint64_t seed);
+uint64_t JHashTableGetHashSeed(const JHashTablePtr table);
+JHashTablePtr JHashTableSetPrefetchDistance(JHashTablePtr table, int distance);
+int JHashTableGetPrefetchDistance(const JHashTablePtr table);
 JHashTablePtr JHashTableAddData(JHashTablePtr table, void *key, void *value);
+JHashTablePtr JHashTableAddUnchecked(JHashTablePtr table, void *key, void *value);
+int JHashTableBuildParallel(JHashTablePtr table, void **keys, void **values, int count, int threadCount);
+int JHashTableAddBatch(JHashTablePtr table, void **keys, void **values, int count, int *results);
 
 void* JHashTableGetFirstData(const JHashTablePtr table);
 void* JHashTableGetLastData(const JHashTablePtr table);
@@ -144,9 +740,67 @@ void* JHashTableGetLastData(const JHashTablePtr table);
 DeleteResult JHashTableDeleteData(JHashTablePtr table, void *key, void *value);
 DeleteResult JHashTableDeleteFirstData(JHashTablePtr table);
 DeleteResult JHashTableDeleteLastData(JHashTablePtr table);
+void* JHashTablePopFirst(JHashTablePtr table);
+void* JHashTablePopLast(JHashTablePtr table);
+int JHashTableClear(JHashTablePtr table);
 FindResult JHashTableFindData(const JHashTablePtr table, void *key, void *value);
+int JHashTableFindBatch(const JHashTablePtr table, void **keys, void **values, FindResult *results, int count);
+
+void* JHashTableGet(const JHashTablePtr table, void *key);
+void* JHashTableGetOrInsert(JHashTablePtr table, void *key, void *value, InsertResult *result);
+InsertResult JHashTableUpsert(JHashTablePtr table, void *key, void *value, void **oldValue);
+DeleteResult JHashTableRemoveKey(JHashTablePtr table, void *key);
+void* JHashTableFindEntry(const JHashTablePtr table, void *key, void *value, JHashTableEntryPtr entry);
+DeleteResult JHashTableEraseHandle(JHashTablePtr table, JHashTableEntryPtr entry);
 
 void JHashTablePrintAll(const JHashTablePtr table);
+int JHashTableForEach(const JHashTablePtr table, _jhashVisit_f visitFunc, void *ctx);
+int JHashTableForEachParallel(const JHashTablePtr table, JWorkPoolPtr pool, _jhashVisit_f visitFunc, void *ctx);
+
+int JHashTableIterBegin(JHashTablePtr table, JHashTableIterPtr iter);
+int JHashTableIterNext(JHashTableIterPtr iter);
+void* JHashTableIterGet(const JHashTableIterPtr iter, void **key);
+DeleteResult JHashTableIterDelete(JHashTableIterPtr iter);
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for JShardedHashTable
+///////////////////////////////////////////////////////////////////////////////
+
+JShardedHashTablePtr NewJShardedHashTable(int shardCount, int size, HashType keyType, HashType valueType, LockType lockType, const JHashTableOptionPtr option);
+DeleteResult DeleteJShardedHashTable(JShardedHashTablePtrContainer container);
+
+int JShardedHashTableGetShardCount(const JShardedHashTablePtr table);
+int JShardedHashTableGetCount(const JShardedHashTablePtr table);
+int JShardedHashTableGetShardIndex(const JShardedHashTablePtr table, const void *key);
+JHashShardStatsPtr JShardedHashTableGetShardStats(const JShardedHashTablePtr table, int shardIndex, JHashShardStatsPtr stats);
+
+JShardedHashTablePtr JShardedHashTableAddData(JShardedHashTablePtr table, void *key, void *value);
+FindResult JShardedHashTableFindData(const JShardedHashTablePtr table, void *key, void *value);
+void* JShardedHashTableGet(const JShardedHashTablePtr table, void *key);
+DeleteResult JShardedHashTableDeleteData(JShardedHashTablePtr table, void *key, void *value);
+DeleteResult JShardedHashTableRemoveKey(JShardedHashTablePtr table, void *key);
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for JWorkPool
+///////////////////////////////////////////////////////////////////////////////
+
+JWorkPoolPtr NewJWorkPool(int threadCount);
+DeleteResult DeleteJWorkPool(JWorkPoolPtrContainer container);
+
+int JWorkPoolGetThreadCount(const JWorkPoolPtr pool);
+int JWorkPoolGetWorkerIndex(void);
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for JInsertBuffer
+///////////////////////////////////////////////////////////////////////////////
+
+JInsertBufferPtr NewJInsertBuffer(JHashTablePtr table, int flushSize, uint64_t flushDelayNs);
+DeleteResult DeleteJInsertBuffer(JInsertBufferPtrContainer container);
+
+JInsertBufferPtr JInsertBufferAdd(JInsertBufferPtr buffer, void *key, void *value);
+int JInsertBufferFlush(JInsertBufferPtr buffer);
+int JInsertBufferGetPendingCount(const JInsertBufferPtr buffer);
+JInsertBufferStatsPtr JInsertBufferGetStats(const JInsertBufferPtr buffer, JInsertBufferStatsPtr stats);
 
 #endif
 
@@ -1,18 +1,461 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <stdint.h>
+#include <limits.h>
+#include <pthread.h>
+#include <time.h>
+
+#if defined(__SSE2__) && !defined(JHASHTABLE_NO_SSE2)
+#include <emmintrin.h>
+#define JHT_USE_SSE2
+#endif
 
 #include "../include/jhashtable.h"
 
+////////////////////////////////////////////////////////////////////////////////
+/// Macros for Open Addressing Storage
+////////////////////////////////////////////////////////////////////////////////
+
+// 비어 있는 슬롯의 제어 바이트
+#define JHT_CTRL_EMPTY ((signed char)-128)
+// 삭제 표시된 슬롯의 제어 바이트
+#define JHT_CTRL_DELETED ((signed char)-2)
+// 최소 슬롯 개수(그룹 크기)
+#define JHT_MIN_CAPACITY JHT_GROUP_SIZE
+
+////////////////////////////////////////////////////////////////////////////////
+/// Macros for Concurrent Access
+////////////////////////////////////////////////////////////////////////////////
+
+// 스핀 잠금을 기다리는 동안 CPU 에 대기 중임을 알리는 명령
+#if defined(__x86_64__) || defined(__i386__)
+#define JHT_CPU_RELAX() __builtin_ia32_pause()
+#elif defined(__aarch64__)
+#define JHT_CPU_RELAX() __asm__ __volatile__("yield")
+#else
+#define JHT_CPU_RELAX()
+#endif
+
+// (잠금 없는 검색) 스레드마다 최근 사용한 테이블의 검색 상태를 기억하는 개수
+#define JHT_EPOCH_CACHE_SIZE 4
+
+// (잠금 없는 버킷) 노드의 next 최하위 bit 로 표시하는 삭제 표시
+#define JHT_LF_MARK ((uintptr_t)1)
+#define JHT_LF_IS_MARKED(node) ((((uintptr_t)(node)) & JHT_LF_MARK) != 0)
+#define JHT_LF_MARKED(node) ((JNodePtr)(((uintptr_t)(node)) | JHT_LF_MARK))
+#define JHT_LF_UNMARKED(node) ((JNodePtr)(((uintptr_t)(node)) & ~JHT_LF_MARK))
+
+// (동시 접근 모드) 재해싱 중 새로운 Slot 배열로 옮겨진 기존 Slot 의 전달 표시
+#define JHT_FORWARD_LIST (&jhtForwardList)
+
+// (잠금 없는 검색) 버킷 읽기 잠금 대신 검색 구간을 시작했음을 나타내는 잠금 유형(JHashTableLockBucket 반환값)
+#define JHT_LOCK_EPOCH 2
+
+// (쓰기 버퍼) 비우는 중 추가하지 못해서 버퍼에 남겨 둘 데이터의 표시(JBufferEntry 의 next)
+#define JHT_BUFFER_RETRY (-2)
+
+////////////////////////////////////////////////////////////////////////////////
+/// Static Variables for Concurrent Access
+////////////////////////////////////////////////////////////////////////////////
+
+// (잠금 없는 검색) 스레드별 검색 상태 캐시 항목 구조체
+typedef struct _jepochcache_t {
+	// 테이블 구분 값(0 이면 빈 항목)
+	uint64_t domainId;
+	// 테이블에 등록된 스레드의 검색 상태
+	JEpochRecordPtr record;
+} JEpochCache;
+
+// 스레드별로 최근 사용한 테이블의 검색 상태
+static __thread JEpochCache jhtEpochCache[JHT_EPOCH_CACHE_SIZE];
+// 다음에 교체할 캐시 항목 위치
+static __thread int jhtEpochCacheNext = 0;
+// 마지막으로 발급한 테이블 구분 값
+static uint64_t jhtEpochDomainCounter = 0;
+// 옮겨진 기존 Slot 에 저장하는 전달 표시 연결 리스트(모든 테이블이 함께 사용하며, 내용은 사용하지 않음)
+static JLinkedList jhtForwardList;
+// (작업 풀) 작업을 처리 중인 스레드의 작업 풀 안 위치(처리 중이 아니면 -1)
+static __thread int jhtWorkerIndex = -1;
+// 메모리 풀을 사용하지 않는 노드에 부여하는 스레드별 세대 번호(해제된 주소를 재사용한 노드를 핸들의 노드와 구분)
+static __thread uint32_t jhtNodeGeneration = 0;
+
+////////////////////////////////////////////////////////////////////////////////
+/// Definitions for Parallel Build
+////////////////////////////////////////////////////////////////////////////////
+
+// (병렬 적재) 단계 열거형
+typedef enum JBuildPhase
+{
+	// 입력 구간의 해쉬값을 계산하고 구역별 데이터 개수를 센다.
+	JBuildHashPhase = 1,
+	// 입력 구간의 데이터 위치를 구역별로 모은다.
+	JBuildScatterPhase,
+	// 구역 단위로 Slot 들에 데이터를 추가한다.
+	JBuildFillPhase
+} JBuildPhase;
+
+// (병렬 적재) 모든 스레드가 함께 사용하는 적재 작업 구조체
+typedef struct _jbuildjob_t {
+	// 적재할 해쉬 테이블(다른 스레드가 사용하지 않는 상태)
+	JHashTablePtr table;
+	// 키 배열
+	void **keys;
+	// 데이터 배열
+	void **values;
+	// 데이터 개수
+	int pairCount;
+	// 스레드 개수
+	int threadCount;
+	// 현재 단계
+	JBuildPhase phase;
+	// 데이터별 전체 해쉬값
+	uint64_t *hashes;
+	// 구역 순서로 모은 데이터 위치(같은 구역 안에서는 입력 순서 유지)
+	int *order;
+	// 구역 개수
+	int partitionCount;
+	// 구역으로 나누는 단위 개수(동시 접근 모드면 잠금 개수, 아니면 버킷 64 개 묶음 개수)
+	int unitCount;
+	// 스레드별 구역별 데이터 개수(threadCount * partitionCount), 모으는 단계에서는 스레드별 구역별 다음 저장 위치
+	int *partitionOffsets;
+	// 구역별 시작 위치(partitionCount + 1 개)
+	int *partitionStarts;
+	// 다음에 맡을 구역 위치
+	int nextPartition;
+	// 실패 여부(NULL 인 키 또는 데이터가 있거나 메모리 할당 실패)
+	int isFailed;
+} JBuildJob, *JBuildJobPtr;
+
+// (병렬 적재) 스레드 하나의 작업 상태 구조체
+typedef struct _jbuildworker_t {
+	// 적재 작업
+	JBuildJobPtr job;
+	// 스레드 위치(0 은 호출한 스레드)
+	int threadIndex;
+	// 스레드
+	pthread_t thread;
+	// 테이블 전체 메모리 풀을 사용할 때 이 스레드가 노드와 연결 리스트를 할당하는 메모리 풀(적재 후 테이블 메모리 풀로 합침)
+	JNodePool pool;
+	// 추가한 데이터 개수
+	int addedCount;
+	// 데이터를 추가한 첫 번째 bitmap word 위치
+	int lowWord;
+	// 데이터를 추가한 마지막 bitmap word 위치
+	int highWord;
+} JBuildWorker, *JBuildWorkerPtr;
+
+////////////////////////////////////////////////////////////////////////////////
+/// Definitions for Traversal
+////////////////////////////////////////////////////////////////////////////////
+
+// (병렬 순회) 모든 스레드가 함께 사용하는 순회 작업 구조체
+typedef struct _jvisitjob_t {
+	// 순회할 해쉬 테이블
+	JHashTablePtr table;
+	// 순회 함수
+	_jhashVisit_f visitFunc;
+	// 순회 함수에 전달할 사용자 데이터
+	void *ctx;
+	// 순회할 버킷(슬롯) 개수
+	int bucketCount;
+	// 순회한 데이터 개수
+	int visitedCount;
+	// 순회 함수가 멈춤을 요청했는지 여부
+	int isStopped;
+} JVisitJob, *JVisitJobPtr;
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Predefinition of Static Functions
 ////////////////////////////////////////////////////////////////////////////////
 
-static int HashInt(int key, int hashSize);
-static int HashChar(char key, int hashSize);
-static int HashString(const char* key, int hashSize);
-static int JHashTableGetHash(const JHashTablePtr table, void *key);
 static HashType CheckHashType(HashType type);
+static JLinkedListPtr JLinkedListAppendNode(JLinkedListPtr list, void *key, void *data, uint64_t hash);
+static int JHashTableIsKeyEqual(const JHashTablePtr table, const void *key1, const void *key2);
+static JNodePtr JHashTableFindNode(const JHashTablePtr table, const JLinkedListPtr list, uint64_t hash, const void *key, const void *value);
+static JHashTablePtr JHashTableInsert(JHashTablePtr table, void *key, void *value, int checkDuplicate);
+static int JHashTableInsertLocked(JHashTablePtr table, void *key, void *value, uint64_t hash, int lockIndex, int checkDuplicate, int *count);
+static void JHashTableCheckGrowth(JHashTablePtr table, int count, int addedCount);
+static void* JHashTableFindOrAdd(JHashTablePtr table, void *key, void *value, int isUpdate, InsertResult *result);
+static void JLinkedListLinkNode(JLinkedListPtr list, JNodePtr node);
+static JLinkedListPtr JLinkedListNewWithPool(int hash, JNodePoolPtr pool);
+static JNodePtr JLinkedListNewNode(const JLinkedListPtr list);
+static void JLinkedListFreeNode(const JLinkedListPtr list, JNodePtr node);
+static void JPoolInit(JPoolPtr pool, size_t objectSize);
+static void* JPoolAlloc(JPoolPtr pool);
+static int JPoolAddSlab(JPoolPtr pool, int objectCount);
+static void JPoolReserve(JPoolPtr pool, int objectCount);
+static void JPoolRelease(JPoolPtr pool, void *object);
+static void JPoolDestroy(JPoolPtr pool);
+static JNodePoolPtr NewJNodePool(void);
+static void DeleteJNodePool(JNodePoolPtr *container);
+static void JLinkedListUnlinkNode(JLinkedListPtr list, JNodePtr node);
+static int JLinkedListHasNode(const JLinkedListPtr list, const JNodePtr node);
+static int JHashTableGetBucketIndex(const JHashTablePtr table, uint64_t hash, int size);
+static JLinkedListPtrContainer JHashTableLocateList(const JHashTablePtr table, uint64_t hash, int *listIndex);
+static JLinkedListPtr JHashTableMaterializeList(const JHashTablePtr table, JLinkedListPtrContainer container, int listIndex, int lockIndex);
+static JLinkedListPtr JHashTableGetFirstList(const JHashTablePtr table, JBucketBitmapPtr *bitmap);
+static JLinkedListPtr JHashTableGetLastList(const JHashTablePtr table, JBucketBitmapPtr *bitmap);
+static JBucketBitmapPtr JHashTableGetBitmap(const JHashTablePtr table, const JLinkedListPtrContainer container);
+static int JBucketBitmapInit(JBucketBitmapPtr bitmap, int bucketCount);
+static void JBucketBitmapFree(JBucketBitmapPtr bitmap);
+static void JBucketBitmapUpdate(JBucketBitmapPtr bitmap, const JLinkedListPtr list);
+static int JBucketBitmapFindFirst(JBucketBitmapPtr bitmap);
+static int JBucketBitmapFindLast(JBucketBitmapPtr bitmap);
+static int JBucketBitmapFindNext(const JBucketBitmapPtr bitmap, int fromIndex);
+static void JBucketBitmapClear(JBucketBitmapPtr bitmap);
+static void JHashTableClearContainer(JLinkedListPtrContainer container, JBucketBitmapPtr bitmap);
+static void JHashTableStartRehash(JHashTablePtr table);
+static void JHashTableRehashStep(JHashTablePtr table, int bucketCount);
+static int JHashTableMigrateList(JHashTablePtr table, int listIndex);
+static void JHashTableDeleteListContainer(const JHashTablePtr table, JLinkedListPtrContainer container, int size);
+static void JHashTableCheckSharedGrowth(JHashTablePtr table, int stripeCount, int addedCount);
+static void JHashTableHelpRehash(JHashTablePtr table, int bucketCount);
+static void JHashTableForwardList(JHashTablePtr table, int listIndex);
+static void JHashTableRetryForward(JHashTablePtr table);
+static void JHashTableFinishSharedRehash(JHashTablePtr table);
+static int JHashTableGetLockIndex(const JHashTablePtr table, uint64_t hash);
+static int JHashTableGetBucketLockIndex(const JHashTablePtr table, int listIndex, int size);
+static int JHashTableInitLockStripes(JHashTablePtr table, LockType lockType, int stripeCount, int useNodePool);
+static void JHashTableFreeLockStripes(JHashTablePtr table);
+static JLockStripePtr JHashTableGetLockStripe(const JHashTablePtr table, int lockIndex);
+static int JHashTableLockBucket(const JHashTablePtr table, int lockIndex, int isWrite);
+static void JHashTableUnlockBucket(const JHashTablePtr table, int lockIndex, int lockMode);
+static int JHashTableLockEndList(const JHashTablePtr table, int fromFirst, int isWrite, JLinkedListPtr *list, JBucketBitmapPtr *bitmap, int *lockMode);
+static int JHashTableAddCount(JHashTablePtr table, int lockIndex, int delta);
+static JNodePoolPtr JHashTableGetNodePool(const JHashTablePtr table, int lockIndex);
+static void JHashTableRemoveNode(JHashTablePtr table, int lockIndex, JLinkedListPtr list, JNodePtr node);
+static JEpochRecordPtr JHashTableGetEpochRecord(const JHashTablePtr table, int create);
+static int JHashTableEnterEpoch(const JHashTablePtr table);
+static int JHashTableExitEpoch(const JHashTablePtr table);
+static void JHashTableTryAdvanceEpoch(const JHashTablePtr table);
+static void JHashTableRetireNode(JHashTablePtr table, int listIndex, JNodePtr node);
+static void JHashTableReclaimNodes(JRetireListPtr retired, JNodePoolPtr pool, int retiredIndex);
+static void JBucketBitmapWiden(JBucketBitmapPtr bitmap, int wordIndex);
+static int JBucketBitmapFindShared(const JBucketBitmapPtr bitmap, int fromFirst);
+static void JSpinLockAcquire(int *spinLock);
+static void JShardedHashTableLockShard(const JShardedHashTablePtr table, JHashShardPtr shard, int isWrite);
+static void JShardedHashTableUnlockShard(const JShardedHashTablePtr table, JHashShardPtr shard);
+static uint64_t JHashTableMix64(uint64_t value);
+static uint64_t JHashTableGetFullHash(const JHashTablePtr table, const void *key);
+static void JHashWyMultiply(uint64_t *a, uint64_t *b);
+static uint64_t JHashWyMix(uint64_t a, uint64_t b);
+static uint64_t JHashWyRead(const unsigned char *p, int byteCount);
+
+static uint64_t JSwissGetHash(const JHashTablePtr table, const void *key);
+static int JSwissInit(JHashTablePtr table, int capacity);
+static void JSwissFree(JHashTablePtr table);
+static unsigned int JSwissMatchByte(const signed char *group, signed char value);
+static unsigned int JSwissMatchEmpty(const signed char *group);
+static unsigned int JSwissMatchFull(const signed char *group);
+static void JSwissSetCtrl(JHashTablePtr table, int slotIndex, signed char ctrl);
+static int JSwissFindSlot(const JHashTablePtr table, uint64_t hash, const void *key, const void *value);
+static int JSwissFindInsertSlot(const JHashTablePtr table, uint64_t hash);
+static int JSwissResize(JHashTablePtr table, int capacity);
+static JHashTablePtr JSwissAddData(JHashTablePtr table, void *key, void *value, int checkDuplicate);
+static JHashTablePtr JSwissInsertHashed(JHashTablePtr table, void *key, void *value, uint64_t hash);
+static void* JSwissFindOrAdd(JHashTablePtr table, void *key, void *value, int isUpdate, InsertResult *result);
+static void JSwissEraseSlot(JHashTablePtr table, int slotIndex);
+static int JSwissGetFirstSlot(const JHashTablePtr table);
+static int JSwissGetLastSlot(const JHashTablePtr table);
+static DeleteResult JSwissRemoveKey(JHashTablePtr table, void *key);
+static void JSwissPrintAll(const JHashTablePtr table);
+
+static void JLockFreeFree(JHashTablePtr table);
+static void JLockFreeClear(JHashTablePtr table);
+static int JLockFreeSearch(const JHashTablePtr table, int listIndex, uint64_t hash, const void *key, const void *value, JNodePtr **prevLink, JNodePtr *found);
+static JNodePtr JLockFreeFindNode(const JHashTablePtr table, int listIndex, uint64_t hash, const void *key, const void *value);
+static void JLockFreeUpdateBit(JHashTablePtr table, int listIndex);
+static void JLockFreeAddCount(JHashTablePtr table, int delta);
+static void JLockFreeUnlink(JHashTablePtr table, int listIndex, JNodePtr *prevLink, JNodePtr node, JNodePtr nextNode);
+static void* JLockFreeRemove(JHashTablePtr table, int listIndex, uint64_t hash, const void *key, const void *value);
+static JHashTablePtr JLockFreeAddData(JHashTablePtr table, void *key, void *value, int checkDuplicate);
+static void* JLockFreeFindOrAdd(JHashTablePtr table, void *key, void *value, int isUpdate, InsertResult *result);
+static void* JLockFreeGet(const JHashTablePtr table, const void *key, const void *value);
+static DeleteResult JLockFreeDeleteData(JHashTablePtr table, const void *key, const void *value);
+static DeleteResult JLockFreeEraseNode(JHashTablePtr table, const JHashTableEntryPtr entry);
+static void* JLockFreeGetEndData(JHashTablePtr table, int fromFirst, int isRemove);
+static void JLockFreePrintAll(const JHashTablePtr table);
+
+static int JHashTableBuildSerial(JHashTablePtr table, void **keys, void **values, int count);
+static int JHashTableReserveForBuild(JHashTablePtr table, double expectedCount);
+static int JHashTableFinishRehash(JHashTablePtr table);
+static int JHashTableGetBuildPartition(const JBuildJobPtr job, uint64_t hash);
+static void JHashTableRunBuildPhase(JBuildJobPtr job, JBuildWorkerPtr workers, JBuildPhase phase);
+static void* JHashTableBuildWorker(void *arg);
+static void JHashTableBuildHash(JBuildWorkerPtr worker);
+static void JHashTableBuildScatter(JBuildWorkerPtr worker);
+static void JHashTableBuildFill(JBuildWorkerPtr worker);
+static int JHashTableBuildAdd(JBuildWorkerPtr worker, int pairIndex);
+static void JPoolMerge(JPoolPtr target, JPoolPtr source);
+
+static int JHashTableVisitRange(const JHashTablePtr table, int beginIndex, int endIndex, _jhashVisit_f visitFunc, void *ctx, int *isStopped);
+static int JHashTableVisitBucket(const JHashTablePtr table, int listIndex, _jhashVisit_f visitFunc, void *ctx, int *isStopped);
+static int JHashTableVisitList(const JLinkedListPtr list, _jhashVisit_f visitFunc, void *ctx, int *isStopped);
+static void JHashTableVisitTask(void *arg, int taskIndex, int workerIndex);
+static int JHashTableIterSeek(JHashTableIterPtr iter, int containerIndex, int listIndex);
+static JLinkedListPtrContainer JHashTableIterGetContainer(const JHashTableIterPtr iter);
+static JNodePtr JHashTableIterSkipMarked(JNodePtr node);
+static void JWorkPoolRun(JWorkPoolPtr pool, int taskCount, _jworkTask_f taskFunc, void *taskArg);
+static void* JWorkPoolThread(void *arg);
+static void JWorkPoolRunTasks(JWorkPoolPtr pool, int workerIndex);
+static int JWorkQueuePop(JWorkQueuePtr queue);
+static int JWorkPoolSteal(JWorkPoolPtr pool, int workerIndex);
+static int JInsertBufferFlushEntries(JInsertBufferPtr buffer, int isDelayed);
+static void JInsertBufferLinkEntry(JInsertBufferPtr buffer, int entryIndex);
+static void JInsertBufferKeepFailed(JInsertBufferPtr buffer);
+static uint64_t JInsertBufferGetNowNs(void);
+static int JHashTableFindChunk(const JHashTablePtr table, void **keys, void **values, FindResult *results, int count);
+static void JHashTableHashKeys(const JHashTablePtr table, void **keys, uint64_t *hashes, int count);
+static int JHashTableAddChunk(JHashTablePtr table, void **keys, void **values, int *results, int count);
+static int JHashTableAddBucketGroup(JHashTablePtr table, void **keys, void **values, const uint64_t *hashes, const int *nextEntries, int entryIndex, int *results);
+static int JHashTableAddLockGroup(JHashTablePtr table, void **keys, void **values, const uint64_t *hashes, const int *nextEntries, int entryIndex, int entryCount, int *results);
+
+///////////////////////////////////////////////////////////////////////////////
+// Functions for Hash
+// 모든 해싱 함수는 seed 를 반영한 64 bit 전체 해쉬값을 반환한다.
+///////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn uint64_t JHashIntModulo(int key, uint64_t seed)
+ * @brief int 형 정수를 그대로 해쉬값으로 사용하는 함수
+ * 버킷 위치가 (키 % 버킷 개수)가 되며, 음수 키는 부호 없는 32 bit 값으로 변환한다.
+ * @param key 해싱할 int 형 정수(입력)
+ * @param seed 해쉬 seed(입력)
+ * @return 항상 해쉬값 반환
+ */
+uint64_t JHashIntModulo(int key, uint64_t seed)
+{
+	return (uint64_t)(uint32_t)key ^ seed;
+}
+
+/**
+ * @fn uint64_t JHashIntMix(int key, uint64_t seed)
+ * @brief int 형 정수를 64 bit 혼합 함수(MurmurHash3 fmix64)로 해싱하는 함수
+ * 연속된 키나 일정 간격의 키도 모든 bit 에 고르게 퍼진다.
+ * @param key 해싱할 int 형 정수(입력)
+ * @param seed 해쉬 seed(입력)
+ * @return 항상 해쉬값 반환
+ */
+uint64_t JHashIntMix(int key, uint64_t seed)
+{
+	return JHashTableMix64((uint64_t)(uint32_t)key ^ seed ^ 0x9e3779b97f4a7c15ULL);
+}
+
+/**
+ * @fn uint64_t JHashCharSum(char key, uint64_t seed)
+ * @brief char 형 문자를 (1 + 2 + ... + 문자값) * 문자값으로 해싱하는 함수
+ * @param key 해싱할 char 형 문자(입력)
+ * @param seed 해쉬 seed(입력)
+ * @return 항상 해쉬값 반환
+ */
+uint64_t JHashCharSum(char key, uint64_t seed)
+{
+	uint64_t value = 0;
+	int hashIndex = 1;
+	for( ; hashIndex <= (int)key; hashIndex++)
+	{
+		value += (uint64_t)(hashIndex * (int)key);
+	}
+	return value ^ seed;
+}
+
+/**
+ * @fn uint64_t JHashCharMix(char key, uint64_t seed)
+ * @brief char 형 문자를 64 bit 혼합 함수로 해싱하는 함수
+ * @param key 해싱할 char 형 문자(입력)
+ * @param seed 해쉬 seed(입력)
+ * @return 항상 해쉬값 반환
+ */
+uint64_t JHashCharMix(char key, uint64_t seed)
+{
+	return JHashTableMix64((uint64_t)(unsigned char)key ^ seed ^ 0x9e3779b97f4a7c15ULL);
+}
+
+/**
+ * @fn uint64_t JHashStringSum(const char* key, uint64_t seed)
+ * @brief char* 형 문자열의 각 문자에 위치(첫 문자가 1)를 곱해서 더하는 함수
+ * 종료 문자는 읽지 않으며, 부호 없는 64 bit 로 계산하므로 긴 문자열에서도 넘침이나 음수 위치가 생기지 않는다.
+ * 문자의 합이라 앞부분이 같은 긴 키들은 가까운 해쉬값에 모이므로, 분포가 중요하면 JHashStringWy(기본 함수)를 사용한다.
+ * @param key 해싱할 char* 형 문자열(입력, 읽기 전용)
+ * @param seed 해쉬 seed(입력)
+ * @return 항상 해쉬값 반환
+ */
+uint64_t JHashStringSum(const char* key, uint64_t seed)
+{
+	const unsigned char *str = (const unsigned char*)key;
+	uint64_t value = seed;
+	uint64_t hashIndex = 1;
+
+	for( ; *str != '\0'; str++, hashIndex++)
+	{
+		value += hashIndex * (uint64_t)(*str);
+	}
+	return value;
+}
+
+/**
+ * @fn uint64_t JHashStringWy(const char* key, uint64_t seed)
+ * @brief char* 형 문자열을 wyhash(final4) 방식으로 해싱하는 함수
+ * 8 byte 단위로 읽고 64 x 64 -> 128 bit 곱셈으로 섞기 때문에 긴 문자열(URL 등)도 빠르고 고르게 분포한다.
+ * @param key 해싱할 char* 형 문자열(입력, 읽기 전용)
+ * @param seed 해쉬 seed(입력)
+ * @return 항상 해쉬값 반환
+ */
+uint64_t JHashStringWy(const char* key, uint64_t seed)
+{
+	static const uint64_t secret[4] = { 0x2d358dccaa6c78a5ULL, 0x8bb84b93962eacc9ULL, 0x4b33a62ed433d4a3ULL, 0x4d5a2da51de1aa47ULL };
+	const unsigned char *p = (const unsigned char*)key;
+	size_t length = strlen(key);
+	size_t remain = length;
+	uint64_t a = 0;
+	uint64_t b = 0;
+
+	seed ^= JHashWyMix(seed ^ secret[0], secret[1]);
+	if(length <= 16)
+	{
+		if(length >= 4)
+		{
+			size_t offset = (length >> 3) << 2;
+			a = (JHashWyRead(p, 4) << 32) | JHashWyRead(p + offset, 4);
+			b = (JHashWyRead(p + length - 4, 4) << 32) | JHashWyRead(p + length - 4 - offset, 4);
+		}
+		else if(length > 0)
+		{
+			a = ((uint64_t)p[0] << 16) | ((uint64_t)p[length >> 1] << 8) | (uint64_t)p[length - 1];
+		}
+	}
+	else
+	{
+		if(remain > 48)
+		{
+			uint64_t seed1 = seed;
+			uint64_t seed2 = seed;
+			do
+			{
+				seed = JHashWyMix(JHashWyRead(p, 8) ^ secret[1], JHashWyRead(p + 8, 8) ^ seed);
+				seed1 = JHashWyMix(JHashWyRead(p + 16, 8) ^ secret[2], JHashWyRead(p + 24, 8) ^ seed1);
+				seed2 = JHashWyMix(JHashWyRead(p + 32, 8) ^ secret[3], JHashWyRead(p + 40, 8) ^ seed2);
+				p += 48;
+				remain -= 48;
+			} while(remain > 48);
+			seed ^= seed1 ^ seed2;
+		}
+		while(remain > 16)
+		{
+			seed = JHashWyMix(JHashWyRead(p, 8) ^ secret[1], JHashWyRead(p + 8, 8) ^ seed);
+			p += 16;
+			remain -= 16;
+		}
+		a = JHashWyRead(p + remain - 16, 8);
+		b = JHashWyRead(p + remain - 8, 8);
+	}
+
+	a ^= secret[1];
+	b ^= seed;
+	JHashWyMultiply(&a, &b);
+	return JHashWyMix(a ^ secret[0] ^ (uint64_t)length, b ^ secret[1]);
+}
 
 ///////////////////////////////////////////////////////////////////////////////
 // Functions for JNode
@@ -30,7 +473,10 @@ JNodePtr NewJNode()
 	{
 		return NULL;
 	}
+	newNode->key = NULL;
 	newNode->data = NULL;
+	newNode->hash = 0;
+	newNode->generation = ++jhtNodeGeneration;
 	return newNode;
 }
 
@@ -57,7 +503,8 @@ DeleteResult DeleteJNode(JNodePtrContainer container)
 void* JNodeGetData(const JNodePtr node)
 {
 	if(node == NULL) return NULL;
-	return node->data;
+	// 잠금 없이 검색하는 스레드가 JHashTableUpsert 로 교체 중인 데이터를 읽을 수 있다.
+	return __atomic_load_n(&(node->data), __ATOMIC_ACQUIRE);
 }
 
 /**
@@ -74,6 +521,32 @@ void* JNodeSetData(JNodePtr node, void *data)
 	return node->data;
 }
 
+/**
+ * @fn void* JNodeGetKey(const JNodePtr node)
+ * @brief 노드에 저장된 키의 주소를 반환하는 함수
+ * @param node 노드 구조체 객체의 주소(입력, 읽기 전용)
+ * @return 성공 시 저장된 키의 주소, 실패 시 NULL 반환
+ */
+void* JNodeGetKey(const JNodePtr node)
+{
+	if(node == NULL) return NULL;
+	return node->key;
+}
+
+/**
+ * @fn void* JNodeSetKey(JNodePtr node, void *key)
+ * @brief 노드에 키의 주소를 저장하는 함수
+ * @param node 노드 구조체 객체의 주소(출력)
+ * @param key 저장할 키의 주소(입력)
+ * @return 성공 시 저장된 키의 주소, 실패 시 NULL 반환
+ */
+void* JNodeSetKey(JNodePtr node, void *key)
+{
+	if(node == NULL || key == NULL) return NULL;
+	node->key = key;
+	return node->key;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 // Functions for JLinkedList
 ///////////////////////////////////////////////////////////////////////////////
@@ -85,27 +558,45 @@ void* JNodeSetData(JNodePtr node, void *data)
  * @return 성공 시 생성된 연결 리스트 구조체 객체의 주소, 실패 시 NULL 반환
  */
 JLinkedListPtr NewJLinkedList(int hash)
+{
+	return JLinkedListNewWithPool(hash, NULL);
+}
+
+/**
+ * @fn static JLinkedListPtr JLinkedListNewWithPool(int hash, JNodePoolPtr pool)
+ * @brief 지정한 메모리 풀에서 새로운 연결 리스트 구조체 객체를 생성하는 함수
+ * 연결 리스트와 Head, Tail 노드, 이후 추가되는 노드들을 모두 메모리 풀에서 할당한다.
+ * @param hash 해쉬 테이블에서 관리하는 해쉬값(입력)
+ * @param pool 메모리 풀 구조체 객체의 주소(입력, NULL 이면 malloc 사용)
+ * @return 성공 시 생성된 연결 리스트 구조체 객체의 주소, 실패 시 NULL 반환
+ */
+static JLinkedListPtr JLinkedListNewWithPool(int hash, JNodePoolPtr pool)
 {
 	if(hash < 0) return NULL;
 
-	JLinkedListPtr newList = (JLinkedListPtr)malloc(sizeof(JLinkedList));
+	JLinkedListPtr newList = NULL;
+	if(pool != NULL) newList = (JLinkedListPtr)JPoolAlloc(&(pool->lists));
+	else newList = (JLinkedListPtr)malloc(sizeof(JLinkedList));
 	if(newList == NULL)
 	{
 		return NULL;
 	}
+	newList->pool = pool;
 
-	newList->head = NewJNode();
+	newList->head = JLinkedListNewNode(newList);
 	if(newList->head == NULL)
 	{
-		free(newList);
+		if(pool != NULL) JPoolRelease(&(pool->lists), newList);
+		else free(newList);
 		return NULL;
 	}
 
-	newList->tail = NewJNode();
+	newList->tail = JLinkedListNewNode(newList);
 	if(newList->tail == NULL)
 	{
-		free(newList->head);
-		free(newList);
+		JLinkedListFreeNode(newList, newList->head);
+		if(pool != NULL) JPoolRelease(&(pool->lists), newList);
+		else free(newList);
 		return NULL;
 	}
 
@@ -124,6 +615,7 @@ JLinkedListPtr NewJLinkedList(int hash)
 /**
  * @fn DeleteResult DeleteJLinkedList(JLinkedListPtrContainer container)
  * @brief 연결 리스트 구조체 객체를 삭제하는 함수
+ * 메모리 풀에서 할당한 연결 리스트면 노드들과 연결 리스트를 메모리 풀에 반환한다.
  * @param container 연결 리스트 구조체 객체의 주소를 저장한 이중 포인터, 컨테이너 변수(입력)
  * @return 성공 시 DeleteSuccess, 실패 시 DeleteFail 반환(DeleteResult 열거형 참고)
  */
@@ -131,26 +623,22 @@ DeleteResult DeleteJLinkedList(JLinkedListPtrContainer container)
 {
 	if(container == NULL || *container == NULL) return DeleteFail;
 
-	int nodeIndex = 0;
-	int listSize = (*container)->size;
-		
-	JNodePtr node = (*container)->head->next;
+	JLinkedListPtr list = *container;
+	JNodePtr node = list->head->next;
 	JNodePtr nextNode = NULL;
-	JNodePtr prevNode = NULL;
 
-	while(node != (*container)->tail)
+	while(node != list->tail)
 	{
 		nextNode = node->next;
-		prevNode = node->prev;
-		if(DeleteJNode(&node) == DeleteFail) return DeleteFail;
-		nextNode->prev = prevNode;
-		prevNode->next = nextNode;
+		JLinkedListFreeNode(list, node);
 		node = nextNode;
 	}
 
-	if((DeleteJNode(&((*container)->head)) == DeleteFail) || (DeleteJNode(&((*container)->tail)) == DeleteFail)) return DeleteFail;
+	JLinkedListFreeNode(list, list->head);
+	JLinkedListFreeNode(list, list->tail);
 
-	free(*container);
+	if(list->pool != NULL) JPoolRelease(&(list->pool->lists), list);
+	else free(list);
 	*container = NULL;
 
 	return DeleteSuccess;
@@ -205,32 +693,7 @@ void* JLinkedListSetData(JLinkedListPtr list, void *data)
 JLinkedListPtr JLinkedListAddNode(JLinkedListPtr list, void *data)
 {
 	if((list == NULL || data == NULL) || (JLinkedListFindNodeData(list, data) == FindSuccess)) return NULL;
-
-	JNodePtr newNode = NewJNode();
-	if(JNodeSetData(newNode, data) == NULL) return NULL;
-
-	if(list->head->next == list->tail)
-	{
-		newNode->next = list->tail;
-		newNode->prev = list->head;
-		list->head->next = newNode;
-		list->tail->prev = newNode;
-	}
-	else if((list->head->next != list->tail) && (list->tail->prev != list->head))
-	{
-		JNodePtr oldNode = list->tail->prev;
-		newNode->prev = oldNode;
-		newNode->next = list->tail;
-		oldNode->next = newNode;
-		list->tail->prev = newNode;
-	}
-	else
-	{
-		return NULL;
-	}
-
-	list->size++;
-	return list;
+	return JLinkedListAppendNode(list, NULL, data, 0);
 }
 
 /**
@@ -241,8 +704,10 @@ JLinkedListPtr JLinkedListAddNode(JLinkedListPtr list, void *data)
  */
 void* JLinkedListGetFirstNodeData(const JLinkedListPtr list)
 {
-	if((list == NULL) || (list->head->next == list->tail)) return NULL;
-	return JNodeGetData(list->head->next);
+	if(list == NULL) return NULL;
+
+	JNodePtr node = __atomic_load_n(&(list->head->next), __ATOMIC_ACQUIRE);
+	return (node == list->tail) ? NULL : JNodeGetData(node);
 }
 
 /**
@@ -252,9 +717,45 @@ void* JLinkedListGetFirstNodeData(const JLinkedListPtr list)
  * @return 성공 시 마지막 노드의 데이터의 주소, 실패 시 NULL 반환
  */
 void* JLinkedListGetLastNodeData(const JLinkedListPtr list)
+{
+	if(list == NULL) return NULL;
+
+	JNodePtr node = __atomic_load_n(&(list->tail->prev), __ATOMIC_ACQUIRE);
+	return (node == list->head) ? NULL : JNodeGetData(node);
+}
+
+/**
+ * @fn void* JLinkedListPopFront(JLinkedListPtr list)
+ * @brief 연결 리스트의 첫 번째 노드를 삭제하고 그 데이터를 반환하는 함수
+ * @param list 연결 리스트 구조체 객체의 주소(출력)
+ * @return 성공 시 삭제된 노드의 데이터의 주소, 실패 시 NULL 반환
+ */
+void* JLinkedListPopFront(JLinkedListPtr list)
+{
+	if((list == NULL) || (list->head->next == list->tail)) return NULL;
+
+	JNodePtr node = list->head->next;
+	void *data = node->data;
+	JLinkedListUnlinkNode(list, node);
+	JLinkedListFreeNode(list, node);
+	return data;
+}
+
+/**
+ * @fn void* JLinkedListPopBack(JLinkedListPtr list)
+ * @brief 연결 리스트의 마지막 노드를 삭제하고 그 데이터를 반환하는 함수
+ * @param list 연결 리스트 구조체 객체의 주소(출력)
+ * @return 성공 시 삭제된 노드의 데이터의 주소, 실패 시 NULL 반환
+ */
+void* JLinkedListPopBack(JLinkedListPtr list)
 {
 	if((list == NULL) || (list->tail->prev == list->head)) return NULL;
-	return JNodeGetData(list->tail->prev);
+
+	JNodePtr node = list->tail->prev;
+	void *data = node->data;
+	JLinkedListUnlinkNode(list, node);
+	JLinkedListFreeNode(list, node);
+	return data;
 }
 
 /**
@@ -279,7 +780,7 @@ DeleteResult JLinkedListDeleteNodeData(JLinkedListPtr list, void *data)
 		prevNode = node->prev;
 		if(node->data == data)
 		{
-			if(DeleteJNode(&node) == DeleteFail) return DeleteFail;
+			JLinkedListFreeNode(list, node);
 			nextNode->prev = prevNode;
 			prevNode->next = nextNode;
 			list->size--;
@@ -323,45 +824,201 @@ FindResult JLinkedListFindNodeData(const JLinkedListPtr list, void *data)
 /// Functions for JHashTable
 ////////////////////////////////////////////////////////////////////////////////
 
+/**
+ * @fn JHashTableOptionPtr JHashTableInitOption(JHashTableOptionPtr option)
+ * @brief Hash Table 생성 옵션 구조체를 기본값으로 초기화하는 함수
+ * @param option 초기화할 옵션 구조체 객체의 주소(출력)
+ * @return 성공 시 옵션 구조체 객체의 주소, 실패 시 NULL 반환
+ */
+JHashTableOptionPtr JHashTableInitOption(JHashTableOptionPtr option)
+{
+	if(option == NULL) return NULL;
+
+	option->storageType = ChainStorage;
+	option->loadFactor = JHT_DEFAULT_LOAD_FACTOR;
+	option->useNodePool = 1;
+	option->powerOfTwoBuckets = 0;
+	option->intHashFunc = NULL;
+	option->charHashFunc = NULL;
+	option->stringHashFunc = NULL;
+	option->hashSeed = 0;
+	option->lockType = NoLock;
+	option->lockStripeCount = JHT_DEFAULT_LOCK_STRIPES;
+	option->lockFreeRead = 0;
+	option->cooperativeResize = 0;
+	option->prefetchDistance = JHT_DEFAULT_PREFETCH_DISTANCE;
+
+	return option;
+}
+
 /**
  * @fn JHashTablePtr NewJHashTable(int size, HashType keyType, HashType valueType)
  * @brief Hash Table 관리 구조체를 새로 생성하는 함수
+ * 기본 옵션(Chaining 저장소)으로 생성한다.
  * @param size 구조체에서 관리할 hash block 크기(입력)
- * @param valueType 등록할 해쉬 함수의 유형(입력, 열거형)
+ * @param keyType 저장할 Key 데이터 유형(입력, 열거형)
+ * @param valueType 저장할 Value 데이터 유형(입력, 열거형)
  * @return 성공 시 새로 생성된 JHashTable 객체의 주소, 실패 시 NULL 반환
  */
 JHashTablePtr NewJHashTable(int size, HashType keyType, HashType valueType)
+{
+	return NewJHashTableWithOption(size, keyType, valueType, NULL);
+}
+
+/**
+ * @fn JHashTablePtr NewJHashTableWithOption(int size, HashType keyType, HashType valueType, const JHashTableOptionPtr option)
+ * @brief 지정한 옵션으로 Hash Table 관리 구조체를 새로 생성하는 함수
+ * Open Addressing 저장소는 size 를 최소 슬롯 개수로 사용하며, 2 의 거듭제곱으로 올림한다.
+ * @param size 구조체에서 관리할 hash block 크기(입력)
+ * @param keyType 저장할 Key 데이터 유형(입력, 열거형)
+ * @param valueType 저장할 Value 데이터 유형(입력, 열거형)
+ * @param option 생성 옵션(입력, 읽기 전용, NULL 이면 기본 옵션 사용)
+ * @return 성공 시 새로 생성된 JHashTable 객체의 주소, 실패 시 NULL 반환
+ */
+JHashTablePtr NewJHashTableWithOption(int size, HashType keyType, HashType valueType, const JHashTableOptionPtr option)
 {
 	if((size <= 0) || (CheckHashType(keyType) == Unknown) || (CheckHashType(valueType) == Unknown)) return NULL;
 
-    JHashTablePtr newHashTable = (JHashTablePtr)malloc(sizeof(JHashTable));
+	JHashTableOption defaultOption;
+	const JHashTableOption *tableOption = option;
+	if(tableOption == NULL) tableOption = JHashTableInitOption(&defaultOption);
+
+	if((tableOption->storageType != ChainStorage) && (tableOption->storageType != OpenAddressStorage)) return NULL;
+	if((tableOption->lockType != NoLock) && (tableOption->lockType != RwLock) && (tableOption->lockType != SpinLock)
+		&& (tableOption->lockType != LockFree))
+	{
+		return NULL;
+	}
+	if((tableOption->lockFreeRead != 0) && (tableOption->lockType == NoLock)) return NULL;
+	// 동시 접근 모드는 Chaining 저장소만 지원한다.
+	if((tableOption->lockType != NoLock) && (tableOption->storageType != ChainStorage)) return NULL;
+	if(((tableOption->lockType == RwLock) || (tableOption->lockType == SpinLock))
+		&& ((tableOption->lockStripeCount <= 0) || (tableOption->lockStripeCount > JHT_MAX_LOCK_STRIPES)))
+	{
+		return NULL;
+	}
+	// 동시 접근 모드의 자동 확장은 버킷 잠금을 사용하고 검색도 잠금을 잡을 때만 지원한다.
+	if((tableOption->cooperativeResize != 0)
+		&& (((tableOption->lockType != RwLock) && (tableOption->lockType != SpinLock)) || (tableOption->lockFreeRead != 0)))
+	{
+		return NULL;
+	}
+	if((tableOption->prefetchDistance < 0) || (tableOption->prefetchDistance > JHT_MAX_PREFETCH_DISTANCE)) return NULL;
+
+    JHashTablePtr newHashTable = (JHashTablePtr)calloc(1, sizeof(JHashTable));
     if(newHashTable == NULL)  return NULL;
-	
-	newHashTable->listContainer = (JLinkedListPtrContainer)malloc(sizeof(JLinkedListPtr) * (size_t)size);
-	if(newHashTable->listContainer == NULL)
+
+	// Chaining 저장소는 기존 버킷 배치(정수 키는 키 % 버킷 개수)를 유지하는 함수들을 기본으로 사용한다.
+	// 문자열 키는 앞부분이 같은 키(URL 등)가 몇 개의 버킷에 모이지 않도록 저장소와 관계없이 JHashStringWy 를 사용한다.
+	if(tableOption->storageType == OpenAddressStorage)
+	{
+		newHashTable->intHashFunc = JHashIntMix;
+		newHashTable->charHashFunc = JHashCharMix;
+	}
+	else
+	{
+		newHashTable->intHashFunc = JHashIntModulo;
+		newHashTable->charHashFunc = JHashCharSum;
+	}
+	newHashTable->stringHashFunc = JHashStringWy;
+	if(tableOption->intHashFunc != NULL) newHashTable->intHashFunc = tableOption->intHashFunc;
+	if(tableOption->charHashFunc != NULL) newHashTable->charHashFunc = tableOption->charHashFunc;
+	if(tableOption->stringHashFunc != NULL) newHashTable->stringHashFunc = tableOption->stringHashFunc;
+	newHashTable->hashSeed = tableOption->hashSeed;
+	newHashTable->keyType = keyType;
+	newHashTable->valueType = valueType;
+	newHashTable->storageType = tableOption->storageType;
+	newHashTable->loadFactor = tableOption->loadFactor;
+	newHashTable->prefetchDistance = tableOption->prefetchDistance;
+
+	if(newHashTable->storageType == OpenAddressStorage)
+	{
+		if(JSwissInit(newHashTable, size) == HASH_FAIL)
+		{
+			free(newHashTable);
+			return NULL;
+		}
+		return newHashTable;
+	}
+
+	if(tableOption->powerOfTwoBuckets != 0)
+	{
+		int bucketCount = 2;
+		while(bucketCount < size)
+		{
+			if(bucketCount > INT_MAX / 2)
+			{
+				free(newHashTable);
+				return NULL;
+			}
+			bucketCount *= 2;
+		}
+		size = bucketCount;
+		newHashTable->powerOfTwoBuckets = 1;
+	}
+
+	// 잠금 없는 버킷은 연결 리스트 구조체 없이 버킷마다 첫 노드 주소만 둔다.
+	if(tableOption->lockType == LockFree)
+	{
+		newHashTable->lockFreeBuckets = (JNodePtr*)calloc((size_t)size, sizeof(JNodePtr));
+	}
+	else
+	{
+		newHashTable->listContainer = (JLinkedListPtrContainer)calloc((size_t)size, sizeof(JLinkedListPtr));
+	}
+	if((newHashTable->listContainer == NULL) && (newHashTable->lockFreeBuckets == NULL))
 	{
 		free(newHashTable);
 		return NULL;
 	}
-	
-	int listIndex = 0;
-	for( ; listIndex < size; listIndex++)
+	newHashTable->size = size;
+
+	if(JBucketBitmapInit(&(newHashTable->occupied), size) == HASH_FAIL)
+	{
+		DeleteJHashTable(&newHashTable);
+		return NULL;
+	}
+
+	if(tableOption->lockType != NoLock)
+	{
+		// 자동 확장을 사용하지 않으면 재해싱하지 않는다.
+		if(tableOption->cooperativeResize == 0) newHashTable->loadFactor = 0;
+		newHashTable->occupied.isShared = 1;
+		newHashTable->lockType = tableOption->lockType;
+		newHashTable->lockBaseSize = size;
+		if(tableOption->cooperativeResize != 0)
+		{
+			if(pthread_rwlock_init(&(newHashTable->resizeLock), NULL) != 0)
+			{
+				DeleteJHashTable(&newHashTable);
+				return NULL;
+			}
+			newHashTable->cooperativeResize = 1;
+		}
+		if((tableOption->lockType != LockFree)
+			&& (JHashTableInitLockStripes(newHashTable, tableOption->lockType, tableOption->lockStripeCount, tableOption->useNodePool) == HASH_FAIL))
+		{
+			DeleteJHashTable(&newHashTable);
+			return NULL;
+		}
+		// 잠금 없는 버킷은 항상 잠금 없이 검색하고 삭제된 노드를 epoch 기반으로 해제한다.
+		if((tableOption->lockFreeRead != 0) || (tableOption->lockType == LockFree))
+		{
+			newHashTable->lockFreeRead = 1;
+			newHashTable->globalEpoch = 1;
+			newHashTable->epochDomainId = __atomic_add_fetch(&jhtEpochDomainCounter, 1, __ATOMIC_RELAXED);
+		}
+	}
+	else if(tableOption->useNodePool != 0)
 	{
-		newHashTable->listContainer[listIndex] = NewJLinkedList(listIndex);
-		if(newHashTable->listContainer[listIndex] == NULL)
+		newHashTable->nodePool = NewJNodePool();
+		if(newHashTable->nodePool == NULL)
 		{
 			DeleteJHashTable(&newHashTable);
 			return NULL;
 		}
 	}
 
-	newHashTable->intHashFunc = HashInt;
-	newHashTable->charHashFunc = HashChar;
-	newHashTable->stringHashFunc = HashString;
-	newHashTable->keyType = keyType;
-	newHashTable->valueType = valueType;
-	newHashTable->size = size;
-
     return newHashTable;
 }
 
@@ -375,19 +1032,23 @@ DeleteResult DeleteJHashTable(JHashTablePtrContainer container)
 {
 	if(container == NULL || *container == NULL) return DeleteFail;
 
-	if((*container)->listContainer != NULL)
-	{
-		int listIndex = 0;
-		int tableSize = (*container)->size;
+	JHashTableDeleteListContainer(*container, (*container)->listContainer, (*container)->size);
+	JHashTableDeleteListContainer(*container, (*container)->rehashContainer, (*container)->rehashSize);
+	JBucketBitmapFree(&((*container)->occupied));
+	JBucketBitmapFree(&((*container)->rehashOccupied));
+	DeleteJNodePool(&((*container)->nodePool));
+	JHashTableFreeLockStripes(*container);
+	if((*container)->cooperativeResize != 0) pthread_rwlock_destroy(&((*container)->resizeLock));
+	JLockFreeFree(*container);
+	JSwissFree(*container);
 
-		for( ; listIndex < tableSize; listIndex++)
-		{
-			if((*container)->listContainer[listIndex] != NULL)
-			{
-			    if(DeleteJLinkedList(&((*container)->listContainer[listIndex])) == DeleteFail) return DeleteFail;
-			}
-		}
-		free((*container)->listContainer);
+	JEpochRecordPtr record = (*container)->epochRecords;
+	JEpochRecordPtr nextRecord = NULL;
+	while(record != NULL)
+	{
+		nextRecord = record->next;
+		free(record);
+		record = nextRecord;
 	}
 
     free(*container);
@@ -405,7 +1066,37 @@ DeleteResult DeleteJHashTable(JHashTablePtrContainer container)
 int JHashTableGetSize(const JHashTablePtr table)
 {
 	if(table == NULL) return Unknown;
-	return table->size;
+	// 동시 접근 모드의 재해싱은 다른 스레드에서 크기를 바꿀 수 있다.
+	return __atomic_load_n(&(table->size), __ATOMIC_RELAXED);
+}
+
+/**
+ * @fn int JHashTableGetCount(const JHashTablePtr table)
+ * @brief 해쉬 테이블에 저장된 전체 데이터 개수를 반환하는 함수
+ * @param table 해쉬 테이블 구조체 객체의 주소(입력, 읽기 전용)
+ * @return 성공 시 저장된 데이터 개수, 실패 시 Unknown 반환(HashType 열거형 참고)
+ */
+int JHashTableGetCount(const JHashTablePtr table)
+{
+	if(table == NULL) return Unknown;
+	if(table->lockFreeBuckets != NULL)
+	{
+		int recordCount = 0;
+		JEpochRecordPtr record = __atomic_load_n(&(table->epochRecords), __ATOMIC_ACQUIRE);
+		for( ; record != NULL; record = record->next) recordCount += __atomic_load_n(&(record->count), __ATOMIC_RELAXED);
+		return recordCount;
+	}
+	if(table->lockStripes == NULL) return table->count;
+
+	// 잠금 위치는 생성 시 버킷 개수보다 작으므로, 버킷 개수가 잠금 개수보다 적으면 앞쪽 잠금들만 사용한다.
+	int count = 0;
+	int stripeIndex = 0;
+	int stripeCount = (table->lockBaseSize < table->lockStripeCount) ? table->lockBaseSize : table->lockStripeCount;
+	for( ; stripeIndex < stripeCount; stripeIndex++)
+	{
+		count += __atomic_load_n(&(table->lockStripes[stripeIndex].count), __ATOMIC_RELAXED);
+	}
+	return count;
 }
 
 /**
@@ -421,8 +1112,76 @@ HashType JHashTableGetType(const JHashTablePtr table)
 }
 
 /**
- * @fn JHashTablePtr JHashTableSetType(JHashTablePtr table, DataType dataType, HashType hashType)
- * @brief 해쉬 테이블의 해쉬 유형을 변경하는 함수
+ * @fn StorageType JHashTableGetStorageType(const JHashTablePtr table)
+ * @brief 해쉬 테이블의 저장소 유형을 반환하는 함수
+ * @param table 해쉬 테이블 구조체 객체의 주소(입력, 읽기 전용)
+ * @return 성공 시 해쉬 테이블의 저장소 유형, 실패 시 Unknown 반환(HashType 열거형 참고)
+ */
+StorageType JHashTableGetStorageType(const JHashTablePtr table)
+{
+	if(table == NULL) return (StorageType)Unknown;
+	return table->storageType;
+}
+
+/**
+ * @fn LockType JHashTableGetLockType(const JHashTablePtr table)
+ * @brief 해쉬 테이블의 동시 접근 보호 유형을 반환하는 함수
+ * @param table 해쉬 테이블 구조체 객체의 주소(입력, 읽기 전용)
+ * @return 성공 시 해쉬 테이블의 동시 접근 보호 유형, 실패 시 UnknownLock 반환(LockType 열거형 참고)
+ */
+LockType JHashTableGetLockType(const JHashTablePtr table)
+{
+	if(table == NULL) return UnknownLock;
+	return table->lockType;
+}
+
+/**
+ * @fn void JHashTableSynchronize(JHashTablePtr table)
+ * @brief (잠금 없는 검색) 호출 전에 시작된 모든 검색이 끝날 때까지 기다리는 함수
+ * 삭제한 데이터의 키와 데이터 메모리는 검색 중인 스레드가 아직 비교하고 있을 수 있으므로, 이 함수 호출 후 해제한다.
+ * 잠금 없는 검색을 사용하지 않으면 바로 반환한다.
+ * @param table 해쉬 테이블 구조체 객체의 주소(입력)
+ * @return 반환값 없음
+ */
+void JHashTableSynchronize(JHashTablePtr table)
+{
+	if((table == NULL) || (table->lockFreeRead == 0)) return;
+
+	// epoch 가 두 번 진행되면 호출 전에 시작된 검색은 모두 끝난 것이다.
+	uint64_t epoch = __atomic_fetch_add(&(table->globalEpoch), 0, __ATOMIC_SEQ_CST);
+	while(__atomic_load_n(&(table->globalEpoch), __ATOMIC_SEQ_CST) < epoch + 2)
+	{
+		JHashTableTryAdvanceEpoch(table);
+		JHT_CPU_RELAX();
+	}
+}
+
+/**
+ * @fn void JHashTableReleaseThread(JHashTablePtr table)
+ * @brief (잠금 없는 검색) 호출한 스레드의 검색 상태를 반환하는 함수
+ * 테이블을 더 이상 사용하지 않는 스레드가 종료 전에 호출하면 다른 스레드가 검색 상태를 재사용한다.
+ * 호출하지 않아도 검색 상태는 테이블 삭제 시 해제된다.
+ * @param table 해쉬 테이블 구조체 객체의 주소(입력)
+ * @return 반환값 없음
+ */
+void JHashTableReleaseThread(JHashTablePtr table)
+{
+	if((table == NULL) || (table->lockFreeRead == 0)) return;
+
+	JEpochRecordPtr record = JHashTableGetEpochRecord(table, 0);
+	if(record == NULL) return;
+
+	int cacheIndex = 0;
+	for( ; cacheIndex < JHT_EPOCH_CACHE_SIZE; cacheIndex++)
+	{
+		if(jhtEpochCache[cacheIndex].domainId == table->epochDomainId) memset(&jhtEpochCache[cacheIndex], 0, sizeof(JEpochCache));
+	}
+	__atomic_store_n(&(record->isUsed), 0, __ATOMIC_RELEASE);
+}
+
+/**
+ * @fn JHashTablePtr JHashTableSetType(JHashTablePtr table, DataType dataType, HashType hashType)
+ * @brief 해쉬 테이블의 해쉬 유형을 변경하는 함수
  * @param table 해쉬 테이블 구조체 객체의 주소(출력)
  * @param valueType 변경할 해쉬 유형(입력, HashType 열거형 참고)
  * @return 성공 시 해쉬 테이블 구조체의 주소, 실패 시 NULL 반환
@@ -445,9 +1204,110 @@ JHashTablePtr JHashTableSetType(JHashTablePtr table, DataType dataType, HashType
 	return table;
 }
 
+/**
+ * @fn JHashTablePtr JHashTableSetIntHashFunc(JHashTablePtr table, _jhashInt_f hashFunc)
+ * @brief 해쉬 테이블의 int 형(정수) 키 해싱 함수를 변경하는 함수
+ * 저장된 데이터의 위치가 바뀌므로 비어 있는 해쉬 테이블에서만 변경할 수 있다.
+ * @param table 해쉬 테이블 구조체 객체의 주소(출력)
+ * @param hashFunc 등록할 해싱 함수(입력, JHashIntModulo, JHashIntMix 또는 사용자 정의 함수)
+ * @return 성공 시 해쉬 테이블 구조체의 주소, 실패 시 NULL 반환
+ */
+JHashTablePtr JHashTableSetIntHashFunc(JHashTablePtr table, _jhashInt_f hashFunc)
+{
+	if((table == NULL) || (hashFunc == NULL) || (JHashTableGetCount(table) > 0)) return NULL;
+	table->intHashFunc = hashFunc;
+	return table;
+}
+
+/**
+ * @fn JHashTablePtr JHashTableSetCharHashFunc(JHashTablePtr table, _jhashChar_f hashFunc)
+ * @brief 해쉬 테이블의 char 형(문자) 키 해싱 함수를 변경하는 함수
+ * 저장된 데이터의 위치가 바뀌므로 비어 있는 해쉬 테이블에서만 변경할 수 있다.
+ * @param table 해쉬 테이블 구조체 객체의 주소(출력)
+ * @param hashFunc 등록할 해싱 함수(입력, JHashCharSum, JHashCharMix 또는 사용자 정의 함수)
+ * @return 성공 시 해쉬 테이블 구조체의 주소, 실패 시 NULL 반환
+ */
+JHashTablePtr JHashTableSetCharHashFunc(JHashTablePtr table, _jhashChar_f hashFunc)
+{
+	if((table == NULL) || (hashFunc == NULL) || (JHashTableGetCount(table) > 0)) return NULL;
+	table->charHashFunc = hashFunc;
+	return table;
+}
+
+/**
+ * @fn JHashTablePtr JHashTableSetStringHashFunc(JHashTablePtr table, _jhashString_f hashFunc)
+ * @brief 해쉬 테이블의 char* 형(문자열) 키 해싱 함수를 변경하는 함수
+ * 저장된 데이터의 위치가 바뀌므로 비어 있는 해쉬 테이블에서만 변경할 수 있다.
+ * @param table 해쉬 테이블 구조체 객체의 주소(출력)
+ * @param hashFunc 등록할 해싱 함수(입력, JHashStringSum, JHashStringWy 또는 사용자 정의 함수)
+ * @return 성공 시 해쉬 테이블 구조체의 주소, 실패 시 NULL 반환
+ */
+JHashTablePtr JHashTableSetStringHashFunc(JHashTablePtr table, _jhashString_f hashFunc)
+{
+	if((table == NULL) || (hashFunc == NULL) || (JHashTableGetCount(table) > 0)) return NULL;
+	table->stringHashFunc = hashFunc;
+	return table;
+}
+
+/**
+ * @fn JHashTablePtr JHashTableSetHashSeed(JHashTablePtr table, uint64_t seed)
+ * @brief 해쉬 테이블의 해쉬 seed 를 변경하는 함수
+ * 저장된 데이터의 위치가 바뀌므로 비어 있는 해쉬 테이블에서만 변경할 수 있다.
+ * @param table 해쉬 테이블 구조체 객체의 주소(출력)
+ * @param seed 해쉬 seed(입력)
+ * @return 성공 시 해쉬 테이블 구조체의 주소, 실패 시 NULL 반환
+ */
+JHashTablePtr JHashTableSetHashSeed(JHashTablePtr table, uint64_t seed)
+{
+	if((table == NULL) || (JHashTableGetCount(table) > 0)) return NULL;
+	table->hashSeed = seed;
+	return table;
+}
+
+/**
+ * @fn uint64_t JHashTableGetHashSeed(const JHashTablePtr table)
+ * @brief 해쉬 테이블의 해쉬 seed 를 반환하는 함수
+ * @param table 해쉬 테이블 구조체 객체의 주소(입력, 읽기 전용)
+ * @return 성공 시 해쉬 seed, 실패 시 0 반환
+ */
+uint64_t JHashTableGetHashSeed(const JHashTablePtr table)
+{
+	if(table == NULL) return 0;
+	return table->hashSeed;
+}
+
+/**
+ * @fn JHashTablePtr JHashTableSetPrefetchDistance(JHashTablePtr table, int distance)
+ * @brief 일괄 검색(JHashTableFindBatch)의 prefetch 거리를 변경하는 함수
+ * 메모리 지연이 길수록(테이블이 캐시보다 클수록) 거리를 늘리고, 테이블이 캐시에 들어가면 0 으로 끌 수 있다.
+ * @param table 해쉬 테이블 구조체 객체의 주소(출력)
+ * @param distance prefetch 단계 하나가 앞서는 키 개수(입력, 0 ~ JHT_MAX_PREFETCH_DISTANCE, 0 이면 prefetch 하지 않음)
+ * @return 성공 시 해쉬 테이블 구조체의 주소, 실패 시 NULL 반환
+ */
+JHashTablePtr JHashTableSetPrefetchDistance(JHashTablePtr table, int distance)
+{
+	if((table == NULL) || (distance < 0) || (distance > JHT_MAX_PREFETCH_DISTANCE)) return NULL;
+	__atomic_store_n(&(table->prefetchDistance), distance, __ATOMIC_RELAXED);
+	return table;
+}
+
+/**
+ * @fn int JHashTableGetPrefetchDistance(const JHashTablePtr table)
+ * @brief 일괄 검색(JHashTableFindBatch)의 prefetch 거리를 반환하는 함수
+ * @param table 해쉬 테이블 구조체 객체의 주소(입력, 읽기 전용)
+ * @return 성공 시 prefetch 거리, 실패 시 HASH_FAIL 반환
+ */
+int JHashTableGetPrefetchDistance(const JHashTablePtr table)
+{
+	if(table == NULL) return HASH_FAIL;
+	return __atomic_load_n(&(table->prefetchDistance), __ATOMIC_RELAXED);
+}
+
 /**
  * @fn JHashTablePtr JHashTableAddData(JHashTablePtr table, void *key, void *value)
  * @brief 해쉬 테이블에 새로운 데이터를 추가하는 함수
+ * 같은 키와 데이터가 이미 저장되어 있으면 추가하지 않는다.
+ * Chaining 저장소는 데이터 개수가 적재율 기준을 넘으면 2 배 크기로 점진적 재해싱을 시작한다.
  * @param table 해쉬 테이블 구조체 객체의 주소(출력)
  * @param key 저장할 키(입력)
  * @param value 저장할 데이터(입력)
@@ -455,13 +1315,208 @@ JHashTablePtr JHashTableSetType(JHashTablePtr table, DataType dataType, HashType
  */
 JHashTablePtr JHashTableAddData(JHashTablePtr table, void *key, void *value)
 {
-	if(table == NULL || key == NULL || value == NULL) return NULL;
+	return JHashTableInsert(table, key, value, 1);
+}
 
-	int listIndex = JHashTableGetHash(table, key);
-	if(listIndex == HASH_FAIL) return NULL;
+/**
+ * @fn JHashTablePtr JHashTableAddUnchecked(JHashTablePtr table, void *key, void *value)
+ * @brief 중복 검사 없이 해쉬 테이블에 새로운 데이터를 추가하는 함수
+ * 대량 적재처럼 호출하는 쪽에서 키와 데이터가 중복되지 않음을 보장할 때 사용한다.
+ * 중복된 키와 데이터를 추가하면 같은 데이터가 여러 번 저장된다.
+ * @param table 해쉬 테이블 구조체 객체의 주소(출력)
+ * @param key 저장할 키(입력)
+ * @param value 저장할 데이터(입력)
+ * @return 성공 시 해쉬 테이블 구조체의 주소, 실패 시 NULL 반환
+ */
+JHashTablePtr JHashTableAddUnchecked(JHashTablePtr table, void *key, void *value)
+{
+	return JHashTableInsert(table, key, value, 0);
+}
 
-	if(JLinkedListAddNode(table->listContainer[listIndex], value) == NULL) return NULL;
-	return table;
+/**
+ * @fn int JHashTableBuildParallel(JHashTablePtr table, void **keys, void **values, int count, int threadCount)
+ * @brief 키 배열과 데이터 배열의 데이터들을 여러 스레드로 나누어 해쉬 테이블에 한 번에 추가하는 함수
+ * 모든 키의 해쉬값을 병렬로 계산한 후 데이터들을 버킷 구역별로 모으고, 각 스레드가 맡은 구역의 Slot 들에 잠금 없이 추가한다.
+ * 구역은 64 개 버킷 묶음 단위(동시 접근 모드는 버킷 잠금 단위)로 나누므로 스레드끼리 같은 Slot, bitmap word, 메모리 풀을 사용하지 않는다.
+ * 같은 버킷 안에서는 입력 순서대로 추가하므로 JHashTableAddData 를 순서대로 호출한 결과와 같다(같은 키와 데이터는 처음 것만 추가).
+ * Chaining 저장소는 추가 전에 최종 데이터 개수에 맞게 미리 확장하며, Open Addressing 저장소와 LockFree 는 호출한 스레드에서 순서대로 추가한다.
+ * 적재 중에는 다른 스레드가 테이블을 사용하면 안 된다.
+ * @param table 해쉬 테이블 구조체 객체의 주소(출력)
+ * @param keys 저장할 키 배열(입력, count 개, NULL 인 키가 있으면 아무것도 추가하지 않음)
+ * @param values 저장할 데이터 배열(입력, count 개, NULL 인 데이터가 있으면 아무것도 추가하지 않음)
+ * @param count 저장할 데이터 개수(입력)
+ * @param threadCount 사용할 스레드 개수(입력, 호출한 스레드 포함, 최대 JHT_MAX_BUILD_THREADS)
+ * @return 성공 시 추가된 데이터 개수, 실패 시 HASH_FAIL 반환(메모리 할당에 실패하면 이미 추가된 데이터는 유지)
+ */
+int JHashTableBuildParallel(JHashTablePtr table, void **keys, void **values, int count, int threadCount)
+{
+	if((table == NULL) || (keys == NULL) || (values == NULL) || (count < 0) || (threadCount <= 0)) return HASH_FAIL;
+	if(count == 0) return 0;
+
+	if(threadCount > JHT_MAX_BUILD_THREADS) threadCount = JHT_MAX_BUILD_THREADS;
+	if(threadCount > count / JHT_BUILD_MIN_PAIRS_PER_THREAD) threadCount = count / JHT_BUILD_MIN_PAIRS_PER_THREAD;
+	if((threadCount <= 1) || (table->storageType == OpenAddressStorage) || (table->lockFreeBuckets != NULL)
+		|| (JHashTableReserveForBuild(table, (double)JHashTableGetCount(table) + (double)count) == HASH_FAIL))
+	{
+		return JHashTableBuildSerial(table, keys, values, count);
+	}
+
+	JBuildJob job;
+	memset(&job, 0, sizeof(JBuildJob));
+	job.table = table;
+	job.keys = keys;
+	job.values = values;
+	job.pairCount = count;
+	job.threadCount = threadCount;
+	job.unitCount = (table->lockStripes != NULL) ? table->lockStripeCount : ((table->size + 63) >> 6);
+	job.partitionCount = (job.unitCount < threadCount * JHT_BUILD_PARTITIONS_PER_THREAD) ? job.unitCount : threadCount * JHT_BUILD_PARTITIONS_PER_THREAD;
+
+	job.hashes = (uint64_t*)malloc(sizeof(uint64_t) * (size_t)count);
+	job.order = (int*)malloc(sizeof(int) * (size_t)count);
+	job.partitionOffsets = (int*)calloc((size_t)threadCount * (size_t)job.partitionCount, sizeof(int));
+	job.partitionStarts = (int*)malloc(sizeof(int) * (size_t)(job.partitionCount + 1));
+	JBuildWorkerPtr workers = (JBuildWorkerPtr)calloc((size_t)threadCount, sizeof(JBuildWorker));
+	if((job.hashes == NULL) || (job.order == NULL) || (job.partitionOffsets == NULL) || (job.partitionStarts == NULL) || (workers == NULL))
+	{
+		free(job.hashes);
+		free(job.order);
+		free(job.partitionOffsets);
+		free(job.partitionStarts);
+		free(workers);
+		return HASH_FAIL;
+	}
+
+	int threadIndex = 0;
+	for( ; threadIndex < threadCount; threadIndex++)
+	{
+		workers[threadIndex].job = &job;
+		workers[threadIndex].threadIndex = threadIndex;
+		workers[threadIndex].lowWord = table->occupied.wordCount;
+		workers[threadIndex].highWord = -1;
+		JPoolInit(&(workers[threadIndex].pool.nodes), sizeof(JNode));
+		JPoolInit(&(workers[threadIndex].pool.lists), sizeof(JLinkedList));
+	}
+
+	JHashTableRunBuildPhase(&job, workers, JBuildHashPhase);
+	if(job.isFailed == 0)
+	{
+		// 구역 순서, 같은 구역 안에서는 스레드 순서(입력 순서)로 저장 위치를 정한다.
+		int partitionIndex = 0;
+		int offset = 0;
+		int partitionCount = 0;
+		for( ; partitionIndex < job.partitionCount; partitionIndex++)
+		{
+			job.partitionStarts[partitionIndex] = offset;
+			for(threadIndex = 0; threadIndex < threadCount; threadIndex++)
+			{
+				partitionCount = job.partitionOffsets[threadIndex * job.partitionCount + partitionIndex];
+				job.partitionOffsets[threadIndex * job.partitionCount + partitionIndex] = offset;
+				offset += partitionCount;
+			}
+		}
+		job.partitionStarts[job.partitionCount] = offset;
+
+		JHashTableRunBuildPhase(&job, workers, JBuildScatterPhase);
+		JHashTableRunBuildPhase(&job, workers, JBuildFillPhase);
+	}
+
+	int addedCount = 0;
+	for(threadIndex = 0; threadIndex < threadCount; threadIndex++)
+	{
+		addedCount += workers[threadIndex].addedCount;
+		if(table->lockStripes != NULL) continue;
+
+		table->count += workers[threadIndex].addedCount;
+		if(workers[threadIndex].lowWord < table->occupied.lowWord) table->occupied.lowWord = workers[threadIndex].lowWord;
+		if(workers[threadIndex].highWord > table->occupied.highWord) table->occupied.highWord = workers[threadIndex].highWord;
+		if(table->nodePool != NULL)
+		{
+			JPoolMerge(&(table->nodePool->nodes), &(workers[threadIndex].pool.nodes));
+			JPoolMerge(&(table->nodePool->lists), &(workers[threadIndex].pool.lists));
+		}
+	}
+
+	int isFailed = job.isFailed;
+	free(job.hashes);
+	free(job.order);
+	free(job.partitionOffsets);
+	free(job.partitionStarts);
+	free(workers);
+
+	return (isFailed != 0) ? HASH_FAIL : addedCount;
+}
+
+/**
+ * @fn int JHashTableAddBatch(JHashTablePtr table, void **keys, void **values, int count, int *results)
+ * @brief 키 배열과 데이터 배열의 데이터들을 호출한 스레드에서 한 번에 추가하는 함수
+ * JHT_ADD_BATCH_SIZE 개씩 키 유형별 반복문으로 해쉬값을 먼저 모두 계산하고, 버킷(동시 접근 모드는 잠금 그룹)별로 묶어서 추가한다.
+ * 동시 접근 모드가 아니고 추가할 데이터가 현재 버킷 개수 이상이면, 추가 전에 최종 데이터 개수(NULL 인 키 또는 데이터 제외, 중복 포함)에 맞게
+ * 미리 확장하고, 노드 메모리 풀을 사용하면 필요한 노드를 한 번에 할당한다.
+ * 그보다 적으면 JHashTableAddData 와 같이 묶음마다 진행 중인 재해싱을 돕고 추가 후 확장을 검사한다.
+ * 동시 접근 모드에서는 묶음마다 잠금을 한 번만 잡으며, Open Addressing 저장소와 LockFree 는 데이터마다 JHashTableAddData 로 추가한다.
+ * 같은 버킷 안에서는 입력 순서대로 추가하므로 JHashTableAddData 를 순서대로 호출한 결과와 같다(같은 키와 데이터는 처음 것만 추가).
+ * @param table 해쉬 테이블 구조체 객체의 주소(출력)
+ * @param keys 저장할 키 배열(입력, count 개)
+ * @param values 저장할 데이터 배열(입력, count 개)
+ * @param count 저장할 데이터 개수(입력)
+ * @param results 데이터별 결과를 저장할 배열(출력, 추가하면 1, 이미 저장되어 있으면 0, NULL 인 키 또는 데이터이거나 메모리 할당에 실패하면 HASH_FAIL, NULL 이면 저장하지 않음)
+ * @return 성공 시 추가된 데이터 개수, 실패 시 HASH_FAIL 반환
+ */
+int JHashTableAddBatch(JHashTablePtr table, void **keys, void **values, int count, int *results)
+{
+	if((table == NULL) || (keys == NULL) || (values == NULL) || (count < 0)) return HASH_FAIL;
+
+	int addedCount = 0;
+	int pairIndex = 0;
+	int result = 0;
+
+	if((table->storageType == OpenAddressStorage) || (table->lockFreeBuckets != NULL))
+	{
+		for( ; pairIndex < count; pairIndex++)
+		{
+			if(JHashTableInsert(table, keys[pairIndex], values[pairIndex], 1) != NULL) result = 1;
+			else if((keys[pairIndex] != NULL) && (values[pairIndex] != NULL) && (JHashTableFindData(table, keys[pairIndex], values[pairIndex]) == FindSuccess)) result = 0;
+			else result = HASH_FAIL;
+
+			if(results != NULL) results[pairIndex] = result;
+			if(result == 1) addedCount++;
+		}
+		return addedCount;
+	}
+
+	int isReserved = 0;
+	if(table->lockStripes == NULL)
+	{
+		int validCount = 0;
+		for( ; pairIndex < count; pairIndex++)
+		{
+			if((keys[pairIndex] != NULL) && (values[pairIndex] != NULL)) validCount++;
+		}
+		pairIndex = 0;
+
+		// 작은 묶음마다 미리 확장하면 진행 중인 재해싱을 매번 한 번에 끝내야 하므로, 버킷 개수 이상을 추가할 때만 미리 확장한다.
+		if(validCount >= table->size)
+		{
+			if(JHashTableReserveForBuild(table, (double)table->count + (double)validCount) == HASH_FAIL) return HASH_FAIL;
+			if(table->nodePool != NULL) JPoolReserve(&(table->nodePool->nodes), validCount);
+			isReserved = 1;
+		}
+	}
+
+	int chunkCount = 0;
+	int chunkAdded = 0;
+	for( ; pairIndex < count; pairIndex += JHT_ADD_BATCH_SIZE)
+	{
+		chunkCount = (count - pairIndex < JHT_ADD_BATCH_SIZE) ? count - pairIndex : JHT_ADD_BATCH_SIZE;
+		if((table->lockStripes == NULL) && (isReserved == 0)) JHashTableRehashStep(table, JHT_REHASH_STEP * chunkCount);
+
+		chunkAdded = JHashTableAddChunk(table, keys + pairIndex, values + pairIndex, (results == NULL) ? NULL : results + pairIndex, chunkCount);
+		addedCount += chunkAdded;
+
+		// 미리 확장하지 않았거나 하지 못했으면(최대 크기) 데이터 하나씩 추가할 때와 같이 확장을 검사한다.
+		if((table->lockStripes == NULL) && (chunkAdded > 0)) JHashTableCheckGrowth(table, table->count, chunkAdded);
+	}
+	return addedCount;
 }
 
 /**
@@ -473,17 +1528,20 @@ JHashTablePtr JHashTableAddData(JHashTablePtr table, void *key, void *value)
 void* JHashTableGetFirstData(const JHashTablePtr table)
 {
 	if(table == NULL) return NULL;
-
-	void *data = NULL;
-	int tableSize = table->size;
-	int listIndex = 0;
-
-	for( ; listIndex < tableSize; listIndex++)
+	if(table->storageType == OpenAddressStorage)
 	{
-		data = JLinkedListGetFirstNodeData(table->listContainer[listIndex]);
-		if(data != NULL) break;
+		int slotIndex = JSwissGetFirstSlot(table);
+		return (slotIndex < 0) ? NULL : table->slots[slotIndex].data;
 	}
+	if(table->lockFreeBuckets != NULL) return JLockFreeGetEndData(table, 1, 0);
 
+	JLinkedListPtr list = NULL;
+	int lockMode = 0;
+	int lockIndex = JHashTableLockEndList(table, 1, 0, &list, NULL, &lockMode);
+	if(lockIndex < 0) return NULL;
+
+	void *data = JLinkedListGetFirstNodeData(list);
+	JHashTableUnlockBucket(table, lockIndex, lockMode);
 	return data;
 }
 
@@ -496,16 +1554,20 @@ void* JHashTableGetFirstData(const JHashTablePtr table)
 void* JHashTableGetLastData(const JHashTablePtr table)
 {
 	if(table == NULL) return NULL;
-
-	void *data = NULL;
-	int listIndex = table->size - 1;
-
-	for( ; listIndex >= 0; listIndex--)
+	if(table->storageType == OpenAddressStorage)
 	{
-		data = JLinkedListGetLastNodeData(table->listContainer[listIndex]);
-		if(data != NULL) break;
+		int slotIndex = JSwissGetLastSlot(table);
+		return (slotIndex < 0) ? NULL : table->slots[slotIndex].data;
 	}
+	if(table->lockFreeBuckets != NULL) return JLockFreeGetEndData(table, 0, 0);
 
+	JLinkedListPtr list = NULL;
+	int lockMode = 0;
+	int lockIndex = JHashTableLockEndList(table, 0, 0, &list, NULL, &lockMode);
+	if(lockIndex < 0) return NULL;
+
+	void *data = JLinkedListGetLastNodeData(list);
+	JHashTableUnlockBucket(table, lockIndex, lockMode);
 	return data;
 }
 
@@ -520,12 +1582,35 @@ void* JHashTableGetLastData(const JHashTablePtr table)
 DeleteResult JHashTableDeleteData(JHashTablePtr table, void *key, void *value)
 {
 	if(table == NULL || key == NULL || value == NULL) return DeleteFail;
+	if(table->storageType == OpenAddressStorage)
+	{
+		int slotIndex = JSwissFindSlot(table, JSwissGetHash(table, key), key, value);
+		if(slotIndex < 0) return DeleteFail;
+		JSwissEraseSlot(table, slotIndex);
+		return DeleteSuccess;
+	}
+	if(table->lockFreeBuckets != NULL) return JLockFreeDeleteData(table, key, value);
 
-	DeleteResult result = DeleteFail;
-	int listIndex = JHashTableGetHash(table, key);
-	if(listIndex == HASH_FAIL) return DeleteFail;
+	JHashTableRehashStep(table, JHT_REHASH_STEP);
+
+	int listIndex = 0;
+	uint64_t hash = JHashTableGetFullHash(table, key);
+	int lockIndex = JHashTableGetLockIndex(table, hash);
+
+	JHashTableLockBucket(table, lockIndex, 1);
+	JLinkedListPtrContainer container = JHashTableLocateList(table, hash, &listIndex);
+	JNodePtr node = JHashTableFindNode(table, container[listIndex], hash, key, value);
+	if(node == NULL)
+	{
+		JHashTableUnlockBucket(table, lockIndex, 1);
+		return DeleteFail;
+	}
 
-	return JLinkedListDeleteNodeData(table->listContainer[listIndex], value);
+	JHashTableRemoveNode(table, lockIndex, container[listIndex], node);
+	JBucketBitmapUpdate(JHashTableGetBitmap(table, container), container[listIndex]);
+	JHashTableAddCount(table, lockIndex, -1);
+	JHashTableUnlockBucket(table, lockIndex, 1);
+	return DeleteSuccess;
 }
 
 /**
@@ -536,26 +1621,7 @@ DeleteResult JHashTableDeleteData(JHashTablePtr table, void *key, void *value)
  */
 DeleteResult JHashTableDeleteFirstData(JHashTablePtr table)
 {
-	if(table == NULL) return DeleteFail;
-
-	DeleteResult result = DeleteFail;
-	void *data = NULL;
-	int tableSize = table->size;
-	int listIndex = 0;
-
-	for( ; listIndex < tableSize; listIndex++)
-	{
-		data = JLinkedListGetFirstNodeData(table->listContainer[listIndex]);
-		if(data != NULL)
-		{
-			//printf("Prev listSize:%d\n", JLinkedListGetSize(table->listContainer[listIndex]));
-			result = JLinkedListDeleteNodeData(table->listContainer[listIndex], data);
-			//printf("After listSize:%d\n", JLinkedListGetSize(table->listContainer[listIndex]));
-			break;
-		}
-	}
-
-	return result;
+	return (JHashTablePopFirst(table) == NULL) ? DeleteFail : DeleteSuccess;
 }
 
 /**
@@ -566,25 +1632,122 @@ DeleteResult JHashTableDeleteFirstData(JHashTablePtr table)
  */
 DeleteResult JHashTableDeleteLastData(JHashTablePtr table)
 {
-	if(table == NULL) return DeleteFail;
+	return (JHashTablePopLast(table) == NULL) ? DeleteFail : DeleteSuccess;
+}
 
-	DeleteResult result = DeleteFail;
-	void *data = NULL;
-	int listIndex = table->size - 1;
+/**
+ * @fn void* JHashTablePopFirst(JHashTablePtr table)
+ * @brief 해쉬 테이블에 저장된 첫 번째 데이터를 삭제하고 반환하는 함수
+ * 첫 번째 버킷의 Head 다음 노드를 바로 분리하므로 버킷을 다시 검색하지 않는다.
+ * @param table 해쉬 테이블 구조체 객체의 주소(출력)
+ * @return 성공 시 삭제된 데이터의 주소, 실패 시 NULL 반환
+ */
+void* JHashTablePopFirst(JHashTablePtr table)
+{
+	if(table == NULL) return NULL;
+	if(table->storageType == OpenAddressStorage)
+	{
+		int slotIndex = JSwissGetFirstSlot(table);
+		if(slotIndex < 0) return NULL;
+		void *slotData = table->slots[slotIndex].data;
+		JSwissEraseSlot(table, slotIndex);
+		return slotData;
+	}
+	if(table->lockFreeBuckets != NULL) return JLockFreeGetEndData(table, 1, 1);
 
-	for( ; listIndex >= 0; listIndex--)
+	JBucketBitmapPtr bitmap = NULL;
+	JLinkedListPtr list = NULL;
+	int lockMode = 1;
+	int lockIndex = JHashTableLockEndList(table, 1, 1, &list, &bitmap, &lockMode);
+	if(lockIndex < 0) return NULL;
+
+	JNodePtr node = list->head->next;
+	void *data = node->data;
+	JHashTableRemoveNode(table, lockIndex, list, node);
+	JBucketBitmapUpdate(bitmap, list);
+	JHashTableAddCount(table, lockIndex, -1);
+	JHashTableUnlockBucket(table, lockIndex, 1);
+	return data;
+}
+
+/**
+ * @fn void* JHashTablePopLast(JHashTablePtr table)
+ * @brief 해쉬 테이블에 저장된 마지막 데이터를 삭제하고 반환하는 함수
+ * 마지막 버킷의 Tail 이전 노드를 바로 분리하므로 버킷을 다시 검색하지 않는다.
+ * @param table 해쉬 테이블 구조체 객체의 주소(출력)
+ * @return 성공 시 삭제된 데이터의 주소, 실패 시 NULL 반환
+ */
+void* JHashTablePopLast(JHashTablePtr table)
+{
+	if(table == NULL) return NULL;
+	if(table->storageType == OpenAddressStorage)
 	{
-		data = JLinkedListGetLastNodeData(table->listContainer[listIndex]);
-		if(data != NULL)
-		{
-			//printf("Prev listSize:%d\n", JLinkedListGetSize(table->listContainer[listIndex]));
-			result = JLinkedListDeleteNodeData(table->listContainer[listIndex], data);
-			//printf("After listSize:%d\n", JLinkedListGetSize(table->listContainer[listIndex]));
-			break;
-		}
+		int slotIndex = JSwissGetLastSlot(table);
+		if(slotIndex < 0) return NULL;
+		void *slotData = table->slots[slotIndex].data;
+		JSwissEraseSlot(table, slotIndex);
+		return slotData;
 	}
+	if(table->lockFreeBuckets != NULL) return JLockFreeGetEndData(table, 0, 1);
 
-	return result;
+	JBucketBitmapPtr bitmap = NULL;
+	JLinkedListPtr list = NULL;
+	int lockMode = 1;
+	int lockIndex = JHashTableLockEndList(table, 0, 1, &list, &bitmap, &lockMode);
+	if(lockIndex < 0) return NULL;
+
+	JNodePtr node = list->tail->prev;
+	void *data = node->data;
+	JHashTableRemoveNode(table, lockIndex, list, node);
+	JBucketBitmapUpdate(bitmap, list);
+	JHashTableAddCount(table, lockIndex, -1);
+	JHashTableUnlockBucket(table, lockIndex, 1);
+	return data;
+}
+
+/**
+ * @fn int JHashTableClear(JHashTablePtr table)
+ * @brief 해쉬 테이블의 모든 데이터를 삭제하고 버킷(슬롯) 메모리는 재사용하도록 남겨 두는 함수
+ * DeleteJHashTable 후 NewJHashTable 을 호출하는 것과 달리 Slot 배열, 연결 리스트와 Head/Tail 노드를 해제하지 않고 비운다.
+ * 데이터 노드는 메모리 풀의 free list 에 반환하므로 다음에 추가할 때 메모리를 새로 할당하지 않는다(메모리 풀을 사용하지 않거나 LockFree 면 해제).
+ * 데이터가 있는 버킷만 bitmap 으로 찾아 비우므로, 데이터가 적은 테이블은 bitmap 을 지우는 비용 정도만 든다.
+ * 재해싱 중이면 데이터를 먼저 비운 후 빈 Slot 들을 옮겨 재해싱을 끝낸다.
+ * @param table 해쉬 테이블 구조체 객체의 주소(출력, 다른 스레드가 사용하지 않는 상태)
+ * @return 성공 시 삭제한 데이터 개수, 실패 시 HASH_FAIL 반환
+ */
+int JHashTableClear(JHashTablePtr table)
+{
+	if(table == NULL) return HASH_FAIL;
+
+	int clearedCount = JHashTableGetCount(table);
+	if(table->storageType == OpenAddressStorage)
+	{
+		memset(table->ctrlBytes, JHT_CTRL_EMPTY, (size_t)(table->size + JHT_GROUP_SIZE));
+		table->count = 0;
+		table->deletedSlots = 0;
+		return clearedCount;
+	}
+	if(table->lockFreeBuckets != NULL)
+	{
+		JLockFreeClear(table);
+		return clearedCount;
+	}
+
+	JHashTableClearContainer(table->listContainer, &(table->occupied));
+	if(table->rehashContainer != NULL)
+	{
+		JHashTableClearContainer(table->rehashContainer, &(table->rehashOccupied));
+		// 옮길 노드가 없으므로 메모리를 할당하지 않고, 끝내지 못해도 빈 테이블로 계속 사용할 수 있다.
+		JHashTableFinishRehash(table);
+	}
+
+	table->count = 0;
+	if(table->lockStripes != NULL)
+	{
+		int stripeIndex = 0;
+		for( ; stripeIndex < table->lockStripeCount; stripeIndex++) table->lockStripes[stripeIndex].count = 0;
+	}
+	return clearedCount;
 }
 
 /**
@@ -599,157 +1762,5389 @@ DeleteResult JHashTableDeleteLastData(JHashTablePtr table)
 FindResult JHashTableFindData(const JHashTablePtr table, void *key, void *value)
 {
 	if(table == NULL || key == NULL || value == NULL) return FindFail;
+	if(table->storageType == OpenAddressStorage)
+	{
+		return (JSwissFindSlot(table, JSwissGetHash(table, key), key, value) < 0) ? FindFail : FindSuccess;
+	}
+	if(table->lockFreeBuckets != NULL) return (JLockFreeGet(table, key, value) == NULL) ? FindFail : FindSuccess;
+
+	JHashTableRehashStep(table, JHT_REHASH_STEP);
+
+	int listIndex = 0;
+	uint64_t hash = JHashTableGetFullHash(table, key);
+	int lockIndex = JHashTableGetLockIndex(table, hash);
 
-	int listIndex = JHashTableGetHash(table, key);
-	if(listIndex == HASH_FAIL) return FindFail;
+	int lockMode = JHashTableLockBucket(table, lockIndex, 0);
+	JLinkedListPtrContainer container = JHashTableLocateList(table, hash, &listIndex);
+	JNodePtr node = JHashTableFindNode(table, __atomic_load_n(&(container[listIndex]), __ATOMIC_ACQUIRE), hash, key, value);
+	JHashTableUnlockBucket(table, lockIndex, lockMode);
 
-	return JLinkedListFindNodeData(table->listContainer[listIndex], value);
+	return (node == NULL) ? FindFail : FindSuccess;
 }
 
 /**
- * @fn void JHashTablePrintAll(const JHashTablePtr table)
- * @brief 해쉬 테이블에 저장된 모든 데이터들을 출력하는 함수
+ * @fn int JHashTableFindBatch(const JHashTablePtr table, void **keys, void **values, FindResult *results, int count)
+ * @brief 여러 개의 키(와 데이터)를 한 번에 검색하는 함수(JHashTableFindData 참고)
+ * JHT_FIND_BATCH_SIZE 개씩 키 묶음의 해쉬값을 먼저 모두 계산한 후, 검색할 키보다 prefetch 거리만큼씩 앞선 키들의
+ * Slot, 연결 리스트, Head 노드, 첫 노드를 단계별로 prefetch 하면서 순서대로 검색한다.
+ * (Open Addressing 은 제어 바이트 그룹과 슬롯, cooperativeResize 테이블과 LockFree 버킷은 prefetch 없이 검색)
  * @param table 해쉬 테이블 구조체 객체의 주소(입력, 읽기 전용)
- * @return 반환값 없음
+ * @param keys 검색할 키 배열(입력, NULL 인 키는 FindFail)
+ * @param values 검색할 데이터 배열(입력, NULL 이면 키만 검색)
+ * @param results 키별 검색 결과를 저장할 배열(출력, count 개)
+ * @param count 키 개수(입력)
+ * @return 성공 시 찾은 키 개수, 실패 시 HASH_FAIL 반환
  */
-void JHashTablePrintAll(const JHashTablePtr table)
+int JHashTableFindBatch(const JHashTablePtr table, void **keys, void **values, FindResult *results, int count)
 {
-    if(table == NULL) return;
+	if(table == NULL || keys == NULL || results == NULL || count < 0) return HASH_FAIL;
 
-    int listIndex = 0;
-    int tableSize = table->size;
-    JNodePtr head = NULL;
-    JNodePtr tail = NULL;
-    JNodePtr node = NULL;
+	int foundCount = 0;
+	int beginIndex = 0;
+	int chunkCount = 0;
 
-    printf("------------------\n");
-    for( ; listIndex < tableSize; listIndex++)
-    {
-        head = table->listContainer[listIndex]->head;
-        tail = table->listContainer[listIndex]->tail;
-        node = head->next;
-        if(node == tail) continue;
+	for( ; beginIndex < count; beginIndex += JHT_FIND_BATCH_SIZE)
+	{
+		chunkCount = (count - beginIndex < JHT_FIND_BATCH_SIZE) ? count - beginIndex : JHT_FIND_BATCH_SIZE;
+		foundCount += JHashTableFindChunk(table, keys + beginIndex, (values == NULL) ? NULL : values + beginIndex, results + beginIndex, chunkCount);
+	}
 
-        printf("(%d) [ ", table->listContainer[listIndex]->hash);
-        while(node != tail)
-        {
-            switch(table->valueType)
-            {
-                case IntType:
-                    printf("%d ", *((int*)node->data));
-                    break;
-                case CharType:
-                    printf("%c ", *((char*)node->data));
-                    break;
-                case StringType:
-                    printf("%s ", ((char*)node->data));
-                    break;
-                default: return;
-            }
-            node = node->next;
-        }
-        printf("]\n");
-    }
-    printf("------------------\n");
+	return foundCount;
 }
 
-////////////////////////////////////////////////////////////////////////////////
-/// Static Functions
-////////////////////////////////////////////////////////////////////////////////
-
 /**
- * @fn static int HashInt(int key, int hashSize)
- * @brief int 형 정수값을 해쉬 테이블의 크기로 해싱한 값을 반환하는 함수
- * @param key 해싱할 int 형 정수(입력)
- * @param hashSize 해쉬 테이블의 전체 크기(입력)
- * @return 항상 해싱된 값 반환
+ * @fn void* JHashTableGet(const JHashTablePtr table, void *key)
+ * @brief 해쉬 테이블에서 지정한 키에 저장된 데이터를 반환하는 함수
+ * 같은 키로 여러 데이터가 저장된 경우, 먼저 저장된 데이터를 반환한다.
+ * 키는 해쉬 테이블의 키 유형(keyType)에 따라 값으로 비교한다.
+ * @param table 해쉬 테이블 구조체 객체의 주소(입력, 읽기 전용)
+ * @param key 검색할 키(입력)
+ * @return 성공 시 키에 저장된 데이터의 주소, 실패 시 NULL 반환
  */
-static int HashInt(int key, int hashSize)
+void* JHashTableGet(const JHashTablePtr table, void *key)
 {
-	return key % hashSize;
+	if(table == NULL || key == NULL) return NULL;
+	if(table->storageType == OpenAddressStorage)
+	{
+		int slotIndex = JSwissFindSlot(table, JSwissGetHash(table, key), key, NULL);
+		return (slotIndex < 0) ? NULL : table->slots[slotIndex].data;
+	}
+	if(table->lockFreeBuckets != NULL) return JLockFreeGet(table, key, NULL);
+
+	JHashTableRehashStep(table, JHT_REHASH_STEP);
+
+	int listIndex = 0;
+	uint64_t hash = JHashTableGetFullHash(table, key);
+	int lockIndex = JHashTableGetLockIndex(table, hash);
+
+	int lockMode = JHashTableLockBucket(table, lockIndex, 0);
+	JLinkedListPtrContainer container = JHashTableLocateList(table, hash, &listIndex);
+	void *data = JNodeGetData(JHashTableFindNode(table, __atomic_load_n(&(container[listIndex]), __ATOMIC_ACQUIRE), hash, key, NULL));
+	JHashTableUnlockBucket(table, lockIndex, lockMode);
+
+	return data;
+}
+
+/**
+ * @fn void* JHashTableGetOrInsert(JHashTablePtr table, void *key, void *value, InsertResult *result)
+ * @brief 지정한 키에 저장된 데이터를 반환하고, 없으면 새로운 데이터를 추가하는 함수
+ * JHashTableGet 후 JHashTableAddData 를 호출하는 것과 같지만, 키를 한 번만 해싱하고 버킷도 한 번만 검색한다.
+ * 동시 접근 모드에서는 버킷 쓰기 잠금 안에서 검색과 추가를 함께 하므로 같은 키를 여러 스레드가 동시에 추가해도 하나만 추가된다.
+ * @param table 해쉬 테이블 구조체 객체의 주소(출력)
+ * @param key 검색하거나 저장할 키(입력)
+ * @param value 키가 없을 때 저장할 데이터(입력)
+ * @param result 추가했으면 InsertAdded, 이미 저장되어 있으면 InsertExisting, 실패하면 InsertFail(출력, NULL 허용)
+ * @return 성공 시 키에 저장된 데이터(추가했으면 value), 실패 시 NULL 반환
+ */
+void* JHashTableGetOrInsert(JHashTablePtr table, void *key, void *value, InsertResult *result)
+{
+	InsertResult insertResult = InsertFail;
+	void *data = NULL;
+
+	if(table != NULL && key != NULL && value != NULL)
+	{
+		data = JHashTableFindOrAdd(table, key, value, 0, &insertResult);
+		if(insertResult == InsertAdded) data = value;
+	}
+
+	if(result != NULL) *result = insertResult;
+	return data;
+}
+
+/**
+ * @fn InsertResult JHashTableUpsert(JHashTablePtr table, void *key, void *value, void **oldValue)
+ * @brief 지정한 키에 저장된 데이터를 새로운 데이터로 교체하고, 없으면 추가하는 함수
+ * 키를 한 번만 해싱하고 버킷도 한 번만 검색하며, 같은 키의 데이터가 여러 개면 처음 찾은 데이터만 교체한다.
+ * (LockFree) 같은 키를 동시에 삭제하면 삭제되는 데이터를 교체할 수 있으며, 이때는 교체 후 삭제된 것으로 본다.
+ * @param table 해쉬 테이블 구조체 객체의 주소(출력)
+ * @param key 저장할 키(입력)
+ * @param value 저장할 데이터(입력)
+ * @param oldValue 교체했으면 기존 데이터, 추가했거나 실패하면 NULL(출력, NULL 허용)
+ * @return 추가했으면 InsertAdded, 교체했으면 InsertExisting, 실패하면 InsertFail 반환(InsertResult 열거형 참고)
+ */
+InsertResult JHashTableUpsert(JHashTablePtr table, void *key, void *value, void **oldValue)
+{
+	InsertResult result = InsertFail;
+	void *data = NULL;
+
+	if(table != NULL && key != NULL && value != NULL) data = JHashTableFindOrAdd(table, key, value, 1, &result);
+
+	if(oldValue != NULL) *oldValue = (result == InsertExisting) ? data : NULL;
+	return result;
+}
+
+/**
+ * @fn DeleteResult JHashTableRemoveKey(JHashTablePtr table, void *key)
+ * @brief 해쉬 테이블에서 지정한 키에 저장된 모든 데이터를 삭제하는 함수
+ * 키는 해쉬 테이블의 키 유형(keyType)에 따라 값으로 비교한다.
+ * @param table 해쉬 테이블 구조체 객체의 주소(출력)
+ * @param key 삭제할 키(입력)
+ * @return 성공 시 DeleteSuccess, 실패 시 DeleteFail 반환(DeleteResult 열거형 참고)
+ */
+DeleteResult JHashTableRemoveKey(JHashTablePtr table, void *key)
+{
+	if(table == NULL || key == NULL) return DeleteFail;
+	if(table->storageType == OpenAddressStorage) return JSwissRemoveKey(table, key);
+	if(table->lockFreeBuckets != NULL) return JLockFreeDeleteData(table, key, NULL);
+
+	JHashTableRehashStep(table, JHT_REHASH_STEP);
+
+	int listIndex = 0;
+	uint64_t hash = JHashTableGetFullHash(table, key);
+	int lockIndex = JHashTableGetLockIndex(table, hash);
+
+	JHashTableLockBucket(table, lockIndex, 1);
+	JLinkedListPtrContainer container = JHashTableLocateList(table, hash, &listIndex);
+	if(container[listIndex] == NULL)
+	{
+		JHashTableUnlockBucket(table, lockIndex, 1);
+		return DeleteFail;
+	}
+
+	DeleteResult result = DeleteFail;
+	JLinkedListPtr list = container[listIndex];
+	JNodePtr node = list->head->next;
+	JNodePtr nextNode = NULL;
+
+	while(node != list->tail)
+	{
+		nextNode = node->next;
+		if((node->hash == hash) && (JHashTableIsKeyEqual(table, node->key, key) == 1))
+		{
+			JHashTableRemoveNode(table, lockIndex, list, node);
+			JHashTableAddCount(table, lockIndex, -1);
+			result = DeleteSuccess;
+		}
+		node = nextNode;
+	}
+	JBucketBitmapUpdate(JHashTableGetBitmap(table, container), list);
+	JHashTableUnlockBucket(table, lockIndex, 1);
+
+	return result;
+}
+
+/**
+ * @fn void* JHashTableFindEntry(const JHashTablePtr table, void *key, void *value, JHashTableEntryPtr entry)
+ * @brief 해쉬 테이블에서 데이터를 검색하고, 찾은 위치를 핸들에 저장하는 함수
+ * 핸들을 JHashTableEraseHandle 에 전달하면 버킷을 다시 검색하지 않고 찾은 데이터를 삭제한다.
+ * 핸들은 찾은 데이터가 삭제되기 전까지만 사용할 수 있으므로, 동시 접근 모드에서는 다른 스레드가 같은 데이터를 삭제하지 않는 경우에만 사용한다.
+ * @param table 해쉬 테이블 구조체 객체의 주소(입력, 읽기 전용)
+ * @param key 검색할 키(입력)
+ * @param value 검색할 데이터(입력, NULL 이면 키에 먼저 저장된 데이터)
+ * @param entry 찾은 데이터의 핸들(출력, 찾지 못하면 빈 핸들)
+ * @return 성공 시 찾은 데이터의 주소, 실패 시 NULL 반환
+ */
+void* JHashTableFindEntry(const JHashTablePtr table, void *key, void *value, JHashTableEntryPtr entry)
+{
+	if(table == NULL || key == NULL || entry == NULL) return NULL;
+
+	memset(entry, 0, sizeof(JHashTableEntry));
+	entry->slotIndex = HASH_FAIL;
+
+	if(table->storageType == OpenAddressStorage)
+	{
+		uint64_t swissHash = JSwissGetHash(table, key);
+		int slotIndex = JSwissFindSlot(table, swissHash, key, value);
+		if(slotIndex < 0) return NULL;
+
+		entry->key = table->slots[slotIndex].key;
+		entry->data = table->slots[slotIndex].data;
+		entry->hash = swissHash;
+		entry->generation = table->slotsGeneration;
+		entry->slotIndex = slotIndex;
+		return entry->data;
+	}
+
+	uint64_t hash = JHashTableGetFullHash(table, key);
+	JNodePtr node = NULL;
+	if(table->lockFreeBuckets != NULL)
+	{
+		if(JHashTableEnterEpoch(table) == HASH_FAIL) return NULL;
+		node = JLockFreeFindNode(table, JHashTableGetBucketIndex(table, hash, table->size), hash, key, value);
+		if(node != NULL)
+		{
+			entry->node = node;
+			entry->key = node->key;
+			entry->data = __atomic_load_n(&(node->data), __ATOMIC_ACQUIRE);
+			entry->generation = __atomic_load_n(&(node->generation), __ATOMIC_RELAXED);
+		}
+		JHashTableExitEpoch(table);
+	}
+	else
+	{
+		JHashTableRehashStep(table, JHT_REHASH_STEP);
+
+		int listIndex = 0;
+		int lockIndex = JHashTableGetLockIndex(table, hash);
+
+		int lockMode = JHashTableLockBucket(table, lockIndex, 0);
+		JLinkedListPtrContainer container = JHashTableLocateList(table, hash, &listIndex);
+		node = JHashTableFindNode(table, __atomic_load_n(&(container[listIndex]), __ATOMIC_ACQUIRE), hash, key, value);
+		if(node != NULL)
+		{
+			entry->node = node;
+			entry->key = node->key;
+			entry->data = __atomic_load_n(&(node->data), __ATOMIC_ACQUIRE);
+			entry->generation = __atomic_load_n(&(node->generation), __ATOMIC_RELAXED);
+		}
+		JHashTableUnlockBucket(table, lockIndex, lockMode);
+	}
+
+	if(node == NULL) return NULL;
+	entry->hash = hash;
+	return entry->data;
+}
+
+/**
+ * @fn DeleteResult JHashTableEraseHandle(JHashTablePtr table, JHashTableEntryPtr entry)
+ * @brief JHashTableFindEntry 로 찾은 데이터를 버킷을 다시 검색하지 않고 삭제하는 함수
+ * (Chaining) 이중 연결 리스트의 prev/next 로 노드를 바로 분리한다.
+ * 재해싱으로 노드가 새로운 Slot 으로 옮겨졌을 수 있으므로(노드는 옮겨져도 주소가 같다), 저장된 해쉬값으로 현재 연결 리스트를 다시 계산한다.
+ * (Open Addressing) 슬롯 배열이 그대로면 슬롯 위치로 바로 삭제하고, 재배치로 슬롯이 바뀌었으면 저장된 키와 데이터로 다시 검색한다.
+ * (LockFree) 노드에 바로 삭제 표시하고, 앞 노드를 알 수 없으므로 분리는 버킷을 노드의 해쉬값 위치까지 검사하면서 한다.
+ * 삭제한 핸들은 비워지므로 다시 전달하면 DeleteFail 을 반환한다.
+ * 핸들을 찾은 후 다른 함수로 데이터가 삭제되었으면(노드의 세대 번호가 바뀌었거나 슬롯이 비었으면) DeleteFail 을 반환한다.
+ * 데이터는 노드(슬롯)로 구분하므로 JHashTableUpsert 로 데이터만 교체되었으면 그대로 삭제한다.
+ * 단, Open Addressing 에서 교체 후 재배치까지 되었으면 슬롯을 구분할 수 없어서 DeleteFail 을 반환한다.
+ * @param table 해쉬 테이블 구조체 객체의 주소(출력)
+ * @param entry 삭제할 데이터의 핸들(입력, 출력)
+ * @return 성공 시 DeleteSuccess, 실패 시 DeleteFail 반환(DeleteResult 열거형 참고)
+ */
+DeleteResult JHashTableEraseHandle(JHashTablePtr table, JHashTableEntryPtr entry)
+{
+	if(table == NULL || entry == NULL) return DeleteFail;
+
+	DeleteResult result = DeleteSuccess;
+	if(table->storageType == OpenAddressStorage)
+	{
+		int slotIndex = entry->slotIndex;
+		if(slotIndex < 0) return DeleteFail;
+		if(entry->generation == table->slotsGeneration)
+		{
+			// 슬롯 배열이 그대로면 같은 키가 남아 있는 슬롯이 핸들의 슬롯이다(데이터는 교체되었을 수 있다).
+			if((table->ctrlBytes[slotIndex] < 0) || (table->slots[slotIndex].key != entry->key)) slotIndex = HASH_FAIL;
+		}
+		else
+		{
+			slotIndex = JSwissFindSlot(table, entry->hash, entry->key, entry->data);
+		}
+
+		if(slotIndex >= 0) JSwissEraseSlot(table, slotIndex);
+		else result = DeleteFail;
+	}
+	else
+	{
+		if(entry->node == NULL) return DeleteFail;
+
+		if(table->lockFreeBuckets != NULL)
+		{
+			result = JLockFreeEraseNode(table, entry);
+		}
+		else
+		{
+			int listIndex = 0;
+			int lockIndex = JHashTableGetLockIndex(table, entry->hash);
+
+			JHashTableLockBucket(table, lockIndex, 1);
+			JLinkedListPtrContainer container = JHashTableLocateList(table, entry->hash, &listIndex);
+			JNodePtr node = entry->node;
+			// 메모리 풀의 노드는 해제되어도 슬랩이 남아 있으므로 세대 번호만 비교한다(O(1)).
+			// 메모리 풀을 사용하지 않는 노드는 이미 해제되었을 수 있으므로 연결 리스트에 연결되어 있는지 먼저 검사한다.
+			int isLinked = (JHashTableGetNodePool(table, lockIndex) != NULL) || (JLinkedListHasNode(container[listIndex], node) == 1);
+			if((isLinked == 1) && (node->generation == entry->generation))
+			{
+				JHashTableRemoveNode(table, lockIndex, container[listIndex], node);
+				JBucketBitmapUpdate(JHashTableGetBitmap(table, container), container[listIndex]);
+				JHashTableAddCount(table, lockIndex, -1);
+			}
+			else
+			{
+				result = DeleteFail;
+			}
+			JHashTableUnlockBucket(table, lockIndex, 1);
+		}
+	}
+
+	memset(entry, 0, sizeof(JHashTableEntry));
+	entry->slotIndex = HASH_FAIL;
+	return result;
+}
+
+/**
+ * @fn void JHashTablePrintAll(const JHashTablePtr table)
+ * @brief 해쉬 테이블에 저장된 모든 데이터들을 출력하는 함수
+ * 재해싱 중이면 아직 옮기지 않은 기존 Slot 들을 먼저 출력하고 새로운 Slot 들을 출력한다.
+ * @param table 해쉬 테이블 구조체 객체의 주소(입력, 읽기 전용)
+ * @return 반환값 없음
+ */
+void JHashTablePrintAll(const JHashTablePtr table)
+{
+    if(table == NULL) return;
+    if(table->storageType == OpenAddressStorage)
+    {
+        JSwissPrintAll(table);
+        return;
+    }
+    if(table->lockFreeBuckets != NULL)
+    {
+        JLockFreePrintAll(table);
+        return;
+    }
+
+    int containerIndex = 0;
+    int listIndex = 0;
+    int tableSize = 0;
+    JLinkedListPtrContainer container = NULL;
+    JNodePtr head = NULL;
+    JNodePtr tail = NULL;
+    JNodePtr node = NULL;
+
+    printf("------------------\n");
+    for( ; containerIndex < 2; containerIndex++)
+    {
+        if(containerIndex == 0)
+        {
+            container = table->listContainer;
+            tableSize = table->size;
+            listIndex = (table->rehashContainer != NULL) ? table->rehashIndex : 0;
+        }
+        else
+        {
+            container = table->rehashContainer;
+            tableSize = table->rehashSize;
+            listIndex = 0;
+        }
+        if(container == NULL) continue;
+
+        for( ; listIndex < tableSize; listIndex++)
+        {
+            if((container[listIndex] == NULL) || (container[listIndex] == JHT_FORWARD_LIST)) continue;
+
+            head = container[listIndex]->head;
+            tail = container[listIndex]->tail;
+            node = head->next;
+            if(node == tail) continue;
+
+            printf("(%d) [ ", container[listIndex]->hash);
+            while(node != tail)
+            {
+                switch(table->valueType)
+                {
+                    case IntType:
+                        printf("%d ", *((int*)node->data));
+                        break;
+                    case CharType:
+                        printf("%c ", *((char*)node->data));
+                        break;
+                    case StringType:
+                        printf("%s ", ((char*)node->data));
+                        break;
+                    default: return;
+                }
+                node = node->next;
+            }
+            printf("]\n");
+        }
+    }
+    printf("------------------\n");
+}
+
+/**
+ * @fn int JHashTableForEach(const JHashTablePtr table, _jhashVisit_f visitFunc, void *ctx)
+ * @brief 해쉬 테이블에 저장된 모든 데이터마다 순회 함수를 호출하는 함수
+ * 버킷(슬롯) 순서로 순회하며, 순회 함수가 0 이 아닌 값을 반환하면 멈춘다.
+ * 재해싱 중이면 이미 옮겨진 기존 Slot 대신 그 Slot 의 데이터를 옮겨 받은 새로운 Slot 들을 순회하므로 데이터마다 한 번씩 순회한다.
+ * 동시 접근 모드에서는 버킷마다 읽기 잠금을 잡은 상태에서 순회 함수를 호출하므로, 순회 함수에서 테이블을 변경하면 안 된다.
+ * 순회 함수에서 같은 테이블의 함수(검색 포함)를 호출할 수 있는 테이블은 잠금 없는 검색(lockFreeRead, cooperativeResize 미사용),
+ * LockFree, Open Addressing 저장소뿐이며, 그 경우에도 검색 함수만 호출할 수 있다.
+ * 그 밖의 테이블에서는 어떤 테이블 함수도 호출하면 안 된다.
+ * (버킷 잠금은 재진입할 수 없어 SpinLock 은 이미 잡은 잠금을 계속 기다리고, RwLock 은 쓰기 잠금을 기다리는 스레드가 있으면 교착되며,
+ * 동시 접근 모드가 아닌 Chaining 저장소와 cooperativeResize 테이블은 검색이 재해싱을 진행해서 순회 중인 Slot 을 옮긴다.)
+ * @param table 해쉬 테이블 구조체 객체의 주소(입력, 읽기 전용)
+ * @param visitFunc 순회 함수(입력, 키, 데이터, ctx 를 전달)
+ * @param ctx 순회 함수에 전달할 사용자 데이터(입력, NULL 허용)
+ * @return 성공 시 순회 함수를 호출한 횟수, 실패 시 HASH_FAIL 반환
+ */
+int JHashTableForEach(const JHashTablePtr table, _jhashVisit_f visitFunc, void *ctx)
+{
+	if(table == NULL || visitFunc == NULL) return HASH_FAIL;
+
+	int isStopped = 0;
+	if(table->cooperativeResize != 0) pthread_rwlock_rdlock(&(table->resizeLock));
+	int visitedCount = JHashTableVisitRange(table, 0, table->size, visitFunc, ctx, &isStopped);
+	if(table->cooperativeResize != 0) pthread_rwlock_unlock(&(table->resizeLock));
+	return visitedCount;
+}
+
+/**
+ * @fn int JHashTableForEachParallel(const JHashTablePtr table, JWorkPoolPtr pool, _jhashVisit_f visitFunc, void *ctx)
+ * @brief 해쉬 테이블의 버킷(슬롯)들을 JHT_FOREACH_CHUNK_BUCKETS 개씩 나누어 작업 풀의 스레드들이 함께 순회하는 함수
+ * 먼저 끝난 스레드는 다른 스레드가 남긴 버킷 묶음을 가져와 순회하므로 Slot 마다 데이터 개수가 달라도 스레드들이 고르게 일한다.
+ * 순회 함수는 여러 스레드에서 동시에 호출되므로 ctx 를 함께 변경하려면 동기화하거나 JWorkPoolGetWorkerIndex 로 스레드별 공간을 사용한다.
+ * 순회 함수가 0 이 아닌 값을 반환하면 모든 스레드가 다음 데이터부터 순회를 멈춘다.
+ * 순회 중에 테이블을 변경할 때의 조건은 JHashTableForEach 와 같다.
+ * @param table 해쉬 테이블 구조체 객체의 주소(입력, 읽기 전용)
+ * @param pool 작업 풀 구조체 객체의 주소(입력, 다른 작업을 처리 중이 아닌 상태)
+ * @param visitFunc 순회 함수(입력, 키, 데이터, ctx 를 전달)
+ * @param ctx 순회 함수에 전달할 사용자 데이터(입력, NULL 허용)
+ * @return 성공 시 순회 함수를 호출한 횟수, 실패 시 HASH_FAIL 반환
+ */
+int JHashTableForEachParallel(const JHashTablePtr table, JWorkPoolPtr pool, _jhashVisit_f visitFunc, void *ctx)
+{
+	if(table == NULL || pool == NULL || visitFunc == NULL) return HASH_FAIL;
+
+	JVisitJob job;
+	memset(&job, 0, sizeof(JVisitJob));
+	job.table = table;
+	job.visitFunc = visitFunc;
+	job.ctx = ctx;
+
+	// 순회하는 동안 Slot 배열이 교체되지 않도록 요청한 스레드가 재해싱 잠금(읽기)을 잡는다.
+	if(table->cooperativeResize != 0) pthread_rwlock_rdlock(&(table->resizeLock));
+	job.bucketCount = table->size;
+	JWorkPoolRun(pool, (int)(((int64_t)job.bucketCount + JHT_FOREACH_CHUNK_BUCKETS - 1) / JHT_FOREACH_CHUNK_BUCKETS), JHashTableVisitTask, &job);
+	if(table->cooperativeResize != 0) pthread_rwlock_unlock(&(table->resizeLock));
+
+	return job.visitedCount;
+}
+
+/**
+ * @fn int JHashTableIterBegin(JHashTablePtr table, JHashTableIterPtr iter)
+ * @brief 순회 커서를 해쉬 테이블의 첫 번째 데이터로 옮기는 함수
+ * 비어 있는 버킷은 bitmap 에서 64 개씩 건너뛰므로(Open Addressing 은 제어 바이트 그룹 단위) 데이터가 적은 테이블도 빠르게 순회한다.
+ * 재해싱 중이면 아직 옮기지 않은 기존 Slot 들을 먼저 순회하고 새로운 Slot 들을 순회하므로 데이터마다 한 번씩 순회한다.
+ * 커서는 잠금을 잡지 않으므로, 순회하는 동안 다른 스레드가 테이블을 변경하면 안 된다.
+ * 순회 중에는 JHashTableIterDelete 로 현재 데이터만 삭제할 수 있으며, 다른 추가/삭제 함수를 호출하면 커서를 다시 시작해야 한다.
+ * @param table 해쉬 테이블 구조체 객체의 주소(입력)
+ * @param iter 순회 커서 구조체 객체의 주소(출력)
+ * @return 첫 번째 데이터가 있으면 1, 비어 있으면 0, 실패 시 HASH_FAIL 반환
+ */
+int JHashTableIterBegin(JHashTablePtr table, JHashTableIterPtr iter)
+{
+	if(table == NULL || iter == NULL) return HASH_FAIL;
+
+	memset(iter, 0, sizeof(JHashTableIter));
+	iter->table = table;
+	return JHashTableIterSeek(iter, 0, 0);
+}
+
+/**
+ * @fn int JHashTableIterNext(JHashTableIterPtr iter)
+ * @brief 순회 커서를 다음 데이터로 옮기는 함수
+ * 현재 데이터를 JHashTableIterDelete 로 삭제했으면 삭제 전에 기억한 다음 노드부터 이어서 순회한다.
+ * @param iter 순회 커서 구조체 객체의 주소(입력, 출력)
+ * @return 다음 데이터가 있으면 1, 순회가 끝났으면 0 반환
+ */
+int JHashTableIterNext(JHashTableIterPtr iter)
+{
+	if(iter == NULL || iter->table == NULL || iter->listIndex < 0) return 0;
+
+	JNodePtr node = iter->nextNode;
+	int isDeleted = iter->isDeleted;
+	iter->isDeleted = 0;
+
+	// (Chaining) 같은 버킷의 다음 노드가 있으면 버킷을 다시 찾지 않는다.
+	if(iter->list != NULL)
+	{
+		if(isDeleted == 0) node = iter->node->next;
+		if(node != iter->list->tail)
+		{
+			iter->node = node;
+			return 1;
+		}
+		return JHashTableIterSeek(iter, iter->containerIndex, iter->listIndex + 1);
+	}
+
+	if(iter->table->storageType == OpenAddressStorage) return JHashTableIterSeek(iter, 0, iter->listIndex + 1);
+
+	if(isDeleted == 0) node = JHT_LF_UNMARKED(__atomic_load_n(&(iter->node->next), __ATOMIC_ACQUIRE));
+	node = JHashTableIterSkipMarked(node);
+	if(node != NULL)
+	{
+		iter->node = node;
+		return 1;
+	}
+	return JHashTableIterSeek(iter, 0, iter->listIndex + 1);
+}
+
+/**
+ * @fn void* JHashTableIterGet(const JHashTableIterPtr iter, void **key)
+ * @brief 순회 커서가 가리키는 데이터를 반환하는 함수
+ * @param iter 순회 커서 구조체 객체의 주소(입력, 읽기 전용)
+ * @param key 데이터의 키(출력, NULL 허용)
+ * @return 성공 시 데이터, 순회가 끝났거나 현재 데이터를 삭제했으면 NULL 반환
+ */
+void* JHashTableIterGet(const JHashTableIterPtr iter, void **key)
+{
+	if(iter == NULL || iter->table == NULL || iter->listIndex < 0 || iter->isDeleted != 0) return NULL;
+
+	if(iter->table->storageType == OpenAddressStorage)
+	{
+		if(key != NULL) *key = iter->table->slots[iter->listIndex].key;
+		return iter->table->slots[iter->listIndex].data;
+	}
+
+	if(key != NULL) *key = iter->node->key;
+	return __atomic_load_n(&(iter->node->data), __ATOMIC_ACQUIRE);
+}
+
+/**
+ * @fn DeleteResult JHashTableIterDelete(JHashTableIterPtr iter)
+ * @brief 순회 커서가 가리키는 데이터를 삭제하는 함수
+ * 노드를 다시 검색하지 않고 바로 분리하며, 다음 노드를 기억하므로 JHashTableIterNext 로 처음부터 다시 순회하지 않고 이어서 순회한다.
+ * (LockFree) 잠금 없는 버킷은 이전 노드를 알 수 없으므로 키와 데이터로 버킷을 검색해서 삭제한다.
+ * @param iter 순회 커서 구조체 객체의 주소(입력, 출력)
+ * @return 성공 시 DeleteSuccess, 실패 시 DeleteFail 반환(DeleteResult 열거형 참고)
+ */
+DeleteResult JHashTableIterDelete(JHashTableIterPtr iter)
+{
+	if(iter == NULL || iter->table == NULL || iter->listIndex < 0 || iter->isDeleted != 0) return DeleteFail;
+
+	JHashTablePtr table = iter->table;
+	if(table->storageType == OpenAddressStorage)
+	{
+		JSwissEraseSlot(table, iter->listIndex);
+		iter->isDeleted = 1;
+		return DeleteSuccess;
+	}
+
+	JNodePtr node = iter->node;
+	if(table->lockFreeBuckets != NULL)
+	{
+		iter->nextNode = JHT_LF_UNMARKED(__atomic_load_n(&(node->next), __ATOMIC_ACQUIRE));
+		if(JLockFreeDeleteData(table, node->key, __atomic_load_n(&(node->data), __ATOMIC_ACQUIRE)) == DeleteFail) return DeleteFail;
+	}
+	else
+	{
+		int lockIndex = JHashTableGetLockIndex(table, node->hash);
+
+		JHashTableLockBucket(table, lockIndex, 1);
+		iter->nextNode = node->next;
+		JHashTableRemoveNode(table, lockIndex, iter->list, node);
+		JBucketBitmapUpdate(JHashTableGetBitmap(table, JHashTableIterGetContainer(iter)), iter->list);
+		JHashTableAddCount(table, lockIndex, -1);
+		JHashTableUnlockBucket(table, lockIndex, 1);
+	}
+
+	iter->node = NULL;
+	iter->isDeleted = 1;
+	return DeleteSuccess;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Functions for JShardedHashTable
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn JShardedHashTablePtr NewJShardedHashTable(int shardCount, int size, HashType keyType, HashType valueType, LockType lockType, const JHashTableOptionPtr option)
+ * @brief 샤드 테이블 관리 구조체를 새로 할당하는 함수
+ * 샤드 개수는 2 의 거듭제곱으로 올림하고, 샤드마다 (size / 샤드 개수) 크기의 해쉬 테이블을 option 으로 생성한다.
+ * 샤드는 잠금 하나로 보호하므로 샤드의 해쉬 테이블은 동시 접근 모드 없이 생성하며, 자동 확장과 Open Addressing 저장소를 그대로 사용할 수 있다.
+ * @param shardCount 샤드 개수(입력, 1 ~ JHT_MAX_SHARDS)
+ * @param size 전체 해쉬 테이블 크기(입력)
+ * @param keyType 저장할 Key 데이터 유형(입력, 열거형)
+ * @param valueType 저장할 Value 데이터 유형(입력, 열거형)
+ * @param lockType 샤드 잠금 유형(입력, NoLock 이면 한 스레드에서만 사용)
+ * @param option 샤드별 해쉬 테이블 생성 옵션(입력, 읽기 전용, NULL 이면 기본 옵션 사용, lockType 은 NoLock 이어야 함)
+ * @return 성공 시 새로 생성된 JShardedHashTable 객체의 주소, 실패 시 NULL 반환
+ */
+JShardedHashTablePtr NewJShardedHashTable(int shardCount, int size, HashType keyType, HashType valueType, LockType lockType, const JHashTableOptionPtr option)
+{
+	if((shardCount <= 0) || (shardCount > JHT_MAX_SHARDS) || (size <= 0)) return NULL;
+	if((lockType != NoLock) && (lockType != RwLock) && (lockType != SpinLock)) return NULL;
+	if((option != NULL) && (option->lockType != NoLock)) return NULL;
+
+	JShardedHashTablePtr newTable = (JShardedHashTablePtr)calloc(1, sizeof(JShardedHashTable));
+	if(newTable == NULL) return NULL;
+
+	while((1 << newTable->shardBits) < shardCount) newTable->shardBits++;
+	newTable->shardCount = 1 << newTable->shardBits;
+	newTable->lockType = lockType;
+
+	void *memory = NULL;
+	if(posix_memalign(&memory, JHT_CACHE_LINE_SIZE, sizeof(JHashShard) * (size_t)newTable->shardCount) != 0)
+	{
+		free(newTable);
+		return NULL;
+	}
+	newTable->shards = (JHashShardPtr)memory;
+	memset(newTable->shards, 0, sizeof(JHashShard) * (size_t)newTable->shardCount);
+
+	int shardSize = (size + newTable->shardCount - 1) / newTable->shardCount;
+	int shardIndex = 0;
+	for( ; shardIndex < newTable->shardCount; shardIndex++)
+	{
+		// 실패하면 잠금을 초기화한 샤드까지만 삭제하도록 샤드 개수를 줄인다.
+		if(pthread_rwlock_init(&(newTable->shards[shardIndex].rwlock), NULL) != 0)
+		{
+			newTable->shardCount = shardIndex;
+			DeleteJShardedHashTable(&newTable);
+			return NULL;
+		}
+
+		newTable->shards[shardIndex].table = NewJHashTableWithOption(shardSize, keyType, valueType, option);
+		if(newTable->shards[shardIndex].table == NULL)
+		{
+			newTable->shardCount = shardIndex + 1;
+			DeleteJShardedHashTable(&newTable);
+			return NULL;
+		}
+	}
+
+	return newTable;
+}
+
+/**
+ * @fn DeleteResult DeleteJShardedHashTable(JShardedHashTablePtrContainer container)
+ * @brief 샤드 테이블 관리 구조체를 삭제하는 함수
+ * @param container JShardedHashTable 구조체의 포인터(주소)들을 관리하는 이중 포인터(입력)
+ * @return 성공 시 DeleteSuccess, 실패 시 DeleteFail 반환
+ */
+DeleteResult DeleteJShardedHashTable(JShardedHashTablePtrContainer container)
+{
+	if(container == NULL || *container == NULL) return DeleteFail;
+
+	int shardIndex = 0;
+	for( ; shardIndex < (*container)->shardCount; shardIndex++)
+	{
+		if((*container)->shards[shardIndex].table != NULL) DeleteJHashTable(&((*container)->shards[shardIndex].table));
+		pthread_rwlock_destroy(&((*container)->shards[shardIndex].rwlock));
+	}
+
+	free((*container)->shards);
+	free(*container);
+	*container = NULL;
+
+	return DeleteSuccess;
+}
+
+/**
+ * @fn int JShardedHashTableGetShardCount(const JShardedHashTablePtr table)
+ * @brief 샤드 테이블의 샤드 개수를 반환하는 함수
+ * @param table 샤드 테이블 구조체 객체의 주소(입력, 읽기 전용)
+ * @return 성공 시 샤드 개수, 실패 시 Unknown 반환(HashType 열거형 참고)
+ */
+int JShardedHashTableGetShardCount(const JShardedHashTablePtr table)
+{
+	if(table == NULL) return Unknown;
+	return table->shardCount;
+}
+
+/**
+ * @fn int JShardedHashTableGetCount(const JShardedHashTablePtr table)
+ * @brief 샤드 테이블에 저장된 전체 데이터 개수를 반환하는 함수
+ * 다른 스레드가 동시에 변경하는 동안에는 샤드별 개수를 차례로 더한 근사값이다.
+ * @param table 샤드 테이블 구조체 객체의 주소(입력, 읽기 전용)
+ * @return 성공 시 전체 데이터 개수, 실패 시 Unknown 반환(HashType 열거형 참고)
+ */
+int JShardedHashTableGetCount(const JShardedHashTablePtr table)
+{
+	if(table == NULL) return Unknown;
+
+	int count = 0;
+	int shardIndex = 0;
+	for( ; shardIndex < table->shardCount; shardIndex++)
+	{
+		JHashShardPtr shard = &(table->shards[shardIndex]);
+		JShardedHashTableLockShard(table, shard, 0);
+		count += JHashTableGetCount(shard->table);
+		JShardedHashTableUnlockShard(table, shard);
+	}
+
+	return count;
+}
+
+/**
+ * @fn int JShardedHashTableGetShardIndex(const JShardedHashTablePtr table, const void *key)
+ * @brief 지정한 키가 저장될 샤드 위치를 반환하는 함수
+ * 키의 전체 해쉬값을 한 번 더 섞은 값의 상위 log2(샤드 개수) bit 를 사용하므로,
+ * 샤드 안의 버킷 위치(나머지 연산 또는 Fibonacci 곱셈 상위 bit)와 Open Addressing 의 슬롯 위치(하위 bit)에 영향을 주지 않는다.
+ * @param table 샤드 테이블 구조체 객체의 주소(입력, 읽기 전용)
+ * @param key 키(입력, 읽기 전용)
+ * @return 성공 시 샤드 위치, 실패 시 HASH_FAIL 반환
+ */
+int JShardedHashTableGetShardIndex(const JShardedHashTablePtr table, const void *key)
+{
+	if(table == NULL || key == NULL) return HASH_FAIL;
+	if(table->shardBits == 0) return 0;
+
+	// 샤드마다 해싱 함수와 seed 가 같으므로 첫 번째 샤드로 해쉬값을 계산한다.
+	uint64_t hash = JHashTableMix64(JHashTableGetFullHash(table->shards[0].table, key));
+	return (int)(hash >> (64 - table->shardBits));
+}
+
+/**
+ * @fn JHashShardStatsPtr JShardedHashTableGetShardStats(const JShardedHashTablePtr table, int shardIndex, JHashShardStatsPtr stats)
+ * @brief 지정한 샤드의 데이터 개수, 크기와 누적 요청/잠금 대기 횟수를 반환하는 함수
+ * @param table 샤드 테이블 구조체 객체의 주소(입력, 읽기 전용)
+ * @param shardIndex 샤드 위치(입력)
+ * @param stats 샤드 통계를 저장할 구조체(출력)
+ * @return 성공 시 stats, 실패 시 NULL 반환
+ */
+JHashShardStatsPtr JShardedHashTableGetShardStats(const JShardedHashTablePtr table, int shardIndex, JHashShardStatsPtr stats)
+{
+	if(table == NULL || stats == NULL || shardIndex < 0 || shardIndex >= table->shardCount) return NULL;
+
+	JHashShardPtr shard = &(table->shards[shardIndex]);
+	JShardedHashTableLockShard(table, shard, 0);
+	stats->count = JHashTableGetCount(shard->table);
+	stats->size = JHashTableGetSize(shard->table);
+	JShardedHashTableUnlockShard(table, shard);
+
+	stats->addCount = __atomic_load_n(&(shard->addCount), __ATOMIC_RELAXED);
+	stats->findCount = __atomic_load_n(&(shard->findCount), __ATOMIC_RELAXED);
+	stats->deleteCount = __atomic_load_n(&(shard->deleteCount), __ATOMIC_RELAXED);
+	stats->contendedCount = __atomic_load_n(&(shard->contendedCount), __ATOMIC_RELAXED);
+
+	return stats;
+}
+
+/**
+ * @fn JShardedHashTablePtr JShardedHashTableAddData(JShardedHashTablePtr table, void *key, void *value)
+ * @brief 키가 속한 샤드에 새로운 데이터를 추가하는 함수(JHashTableAddData 참고)
+ * @param table 샤드 테이블 구조체 객체의 주소(출력)
+ * @param key 저장할 키(입력)
+ * @param value 저장할 데이터(입력)
+ * @return 성공 시 샤드 테이블 구조체의 주소, 실패 시 NULL 반환
+ */
+JShardedHashTablePtr JShardedHashTableAddData(JShardedHashTablePtr table, void *key, void *value)
+{
+	int shardIndex = JShardedHashTableGetShardIndex(table, key);
+	if(shardIndex == HASH_FAIL) return NULL;
+
+	JHashShardPtr shard = &(table->shards[shardIndex]);
+	JShardedHashTableLockShard(table, shard, 1);
+	JHashTablePtr result = JHashTableAddData(shard->table, key, value);
+	JShardedHashTableUnlockShard(table, shard);
+	__atomic_fetch_add(&(shard->addCount), 1, __ATOMIC_RELAXED);
+
+	return (result == NULL) ? NULL : table;
+}
+
+/**
+ * @fn FindResult JShardedHashTableFindData(const JShardedHashTablePtr table, void *key, void *value)
+ * @brief 키가 속한 샤드에서 데이터를 검색하는 함수(JHashTableFindData 참고)
+ * @param table 샤드 테이블 구조체 객체의 주소(입력, 읽기 전용)
+ * @param key 검색할 키(입력)
+ * @param value 검색할 데이터(입력)
+ * @return 성공 시 FindSuccess, 실패 시 FindFail 반환(FindResult 열거형 참고)
+ */
+FindResult JShardedHashTableFindData(const JShardedHashTablePtr table, void *key, void *value)
+{
+	int shardIndex = JShardedHashTableGetShardIndex(table, key);
+	if(shardIndex == HASH_FAIL) return FindFail;
+
+	JHashShardPtr shard = &(table->shards[shardIndex]);
+	JShardedHashTableLockShard(table, shard, 0);
+	FindResult result = JHashTableFindData(shard->table, key, value);
+	JShardedHashTableUnlockShard(table, shard);
+	__atomic_fetch_add(&(shard->findCount), 1, __ATOMIC_RELAXED);
+
+	return result;
+}
+
+/**
+ * @fn void* JShardedHashTableGet(const JShardedHashTablePtr table, void *key)
+ * @brief 키가 속한 샤드에서 지정한 키에 저장된 데이터를 반환하는 함수(JHashTableGet 참고)
+ * @param table 샤드 테이블 구조체 객체의 주소(입력, 읽기 전용)
+ * @param key 검색할 키(입력)
+ * @return 성공 시 키에 저장된 데이터의 주소, 실패 시 NULL 반환
+ */
+void* JShardedHashTableGet(const JShardedHashTablePtr table, void *key)
+{
+	int shardIndex = JShardedHashTableGetShardIndex(table, key);
+	if(shardIndex == HASH_FAIL) return NULL;
+
+	JHashShardPtr shard = &(table->shards[shardIndex]);
+	JShardedHashTableLockShard(table, shard, 0);
+	void *data = JHashTableGet(shard->table, key);
+	JShardedHashTableUnlockShard(table, shard);
+	__atomic_fetch_add(&(shard->findCount), 1, __ATOMIC_RELAXED);
+
+	return data;
+}
+
+/**
+ * @fn DeleteResult JShardedHashTableDeleteData(JShardedHashTablePtr table, void *key, void *value)
+ * @brief 키가 속한 샤드에서 데이터를 삭제하는 함수(JHashTableDeleteData 참고)
+ * @param table 샤드 테이블 구조체 객체의 주소(출력)
+ * @param key 삭제할 키(입력)
+ * @param value 삭제할 데이터(입력)
+ * @return 성공 시 DeleteSuccess, 실패 시 DeleteFail 반환(DeleteResult 열거형 참고)
+ */
+DeleteResult JShardedHashTableDeleteData(JShardedHashTablePtr table, void *key, void *value)
+{
+	int shardIndex = JShardedHashTableGetShardIndex(table, key);
+	if(shardIndex == HASH_FAIL) return DeleteFail;
+
+	JHashShardPtr shard = &(table->shards[shardIndex]);
+	JShardedHashTableLockShard(table, shard, 1);
+	DeleteResult result = JHashTableDeleteData(shard->table, key, value);
+	JShardedHashTableUnlockShard(table, shard);
+	__atomic_fetch_add(&(shard->deleteCount), 1, __ATOMIC_RELAXED);
+
+	return result;
+}
+
+/**
+ * @fn DeleteResult JShardedHashTableRemoveKey(JShardedHashTablePtr table, void *key)
+ * @brief 키가 속한 샤드에서 지정한 키에 저장된 모든 데이터를 삭제하는 함수(JHashTableRemoveKey 참고)
+ * @param table 샤드 테이블 구조체 객체의 주소(출력)
+ * @param key 삭제할 키(입력)
+ * @return 성공 시 DeleteSuccess, 실패 시 DeleteFail 반환(DeleteResult 열거형 참고)
+ */
+DeleteResult JShardedHashTableRemoveKey(JShardedHashTablePtr table, void *key)
+{
+	int shardIndex = JShardedHashTableGetShardIndex(table, key);
+	if(shardIndex == HASH_FAIL) return DeleteFail;
+
+	JHashShardPtr shard = &(table->shards[shardIndex]);
+	JShardedHashTableLockShard(table, shard, 1);
+	DeleteResult result = JHashTableRemoveKey(shard->table, key);
+	JShardedHashTableUnlockShard(table, shard);
+	__atomic_fetch_add(&(shard->deleteCount), 1, __ATOMIC_RELAXED);
+
+	return result;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Functions for JWorkPool
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn JWorkPoolPtr NewJWorkPool(int threadCount)
+ * @brief 작업 풀을 생성하는 함수
+ * 작업을 요청한 스레드도 작업을 처리하므로 threadCount - 1 개의 스레드를 생성하고, 작업이 없으면 스레드들은 대기한다.
+ * @param threadCount 작업을 처리할 스레드 개수(입력, 작업을 요청한 스레드 포함, 1 ~ JHT_MAX_WORK_THREADS)
+ * @return 성공 시 새로 생성된 작업 풀 구조체 객체의 주소, 실패 시 NULL 반환
+ */
+JWorkPoolPtr NewJWorkPool(int threadCount)
+{
+	if((threadCount <= 0) || (threadCount > JHT_MAX_WORK_THREADS)) return NULL;
+
+	JWorkPoolPtr newPool = (JWorkPoolPtr)calloc(1, sizeof(JWorkPool));
+	if(newPool == NULL) return NULL;
+
+	void *memory = NULL;
+	if(posix_memalign(&memory, JHT_CACHE_LINE_SIZE, sizeof(JWorkQueue) * (size_t)threadCount) != 0)
+	{
+		free(newPool);
+		return NULL;
+	}
+	memset(memory, 0, sizeof(JWorkQueue) * (size_t)threadCount);
+	newPool->queues = (JWorkQueuePtr)memory;
+
+	newPool->threads = (pthread_t*)calloc((size_t)threadCount, sizeof(pthread_t));
+	if(newPool->threads == NULL)
+	{
+		free(newPool->queues);
+		free(newPool);
+		return NULL;
+	}
+
+	pthread_mutex_init(&(newPool->mutex), NULL);
+	pthread_cond_init(&(newPool->startCond), NULL);
+	pthread_cond_init(&(newPool->doneCond), NULL);
+
+	int threadIndex = 0;
+	for( ; threadIndex < threadCount; threadIndex++)
+	{
+		newPool->queues[threadIndex].pool = newPool;
+		newPool->queues[threadIndex].workerIndex = threadIndex;
+	}
+
+	// 스레드를 생성하지 못하면 생성한 스레드까지만 사용한다.
+	newPool->threadCount = 1;
+	for(threadIndex = 1; threadIndex < threadCount; threadIndex++)
+	{
+		if(pthread_create(&(newPool->threads[threadIndex - 1]), NULL, JWorkPoolThread, &(newPool->queues[threadIndex])) != 0) break;
+		newPool->threadCount++;
+	}
+
+	return newPool;
+}
+
+/**
+ * @fn DeleteResult DeleteJWorkPool(JWorkPoolPtrContainer container)
+ * @brief 작업 풀의 스레드들을 종료하고 작업 풀을 삭제하는 함수
+ * @param container 작업 풀 구조체 객체의 주소를 저장한 이중 포인터(입력)
+ * @return 성공 시 DeleteSuccess, 실패 시 DeleteFail 반환(DeleteResult 열거형 참고)
+ */
+DeleteResult DeleteJWorkPool(JWorkPoolPtrContainer container)
+{
+	if(container == NULL || *container == NULL) return DeleteFail;
+
+	JWorkPoolPtr pool = *container;
+	pthread_mutex_lock(&(pool->mutex));
+	pool->isStopping = 1;
+	pthread_cond_broadcast(&(pool->startCond));
+	pthread_mutex_unlock(&(pool->mutex));
+
+	int threadIndex = 0;
+	for( ; threadIndex < pool->threadCount - 1; threadIndex++) pthread_join(pool->threads[threadIndex], NULL);
+
+	pthread_mutex_destroy(&(pool->mutex));
+	pthread_cond_destroy(&(pool->startCond));
+	pthread_cond_destroy(&(pool->doneCond));
+	free(pool->threads);
+	free(pool->queues);
+	free(pool);
+	*container = NULL;
+
+	return DeleteSuccess;
+}
+
+/**
+ * @fn int JWorkPoolGetThreadCount(const JWorkPoolPtr pool)
+ * @brief 작업을 처리하는 스레드 개수를 반환하는 함수(작업을 요청한 스레드 포함)
+ * @param pool 작업 풀 구조체 객체의 주소(입력, 읽기 전용)
+ * @return 성공 시 스레드 개수, 실패 시 HASH_FAIL 반환
+ */
+int JWorkPoolGetThreadCount(const JWorkPoolPtr pool)
+{
+	if(pool == NULL) return HASH_FAIL;
+	return pool->threadCount;
+}
+
+/**
+ * @fn int JWorkPoolGetWorkerIndex(void)
+ * @brief 작업 풀의 작업을 처리 중인 스레드에서 작업 풀 안의 스레드 위치를 반환하는 함수
+ * 순회 함수처럼 작업 중에 호출되는 함수에서 스레드별 공간(0 ~ JWorkPoolGetThreadCount - 1)을 고를 때 사용한다.
+ * @return 작업을 처리 중이면 스레드 위치(작업을 요청한 스레드는 0), 아니면 HASH_FAIL 반환
+ */
+int JWorkPoolGetWorkerIndex(void)
+{
+	return jhtWorkerIndex;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Functions for JInsertBuffer
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn JInsertBufferPtr NewJInsertBuffer(JHashTablePtr table, int flushSize, uint64_t flushDelayNs)
+ * @brief 해쉬 테이블에 데이터를 모아서 추가하는 쓰기 버퍼를 생성하는 함수
+ * 동시 접근 모드(Chaining)면 데이터를 추가할 때 잠금 그룹별로 나누어 두고, 비울 때 잠금 그룹마다 잠금을 한 번만 잡는다.
+ * 그 외의 테이블은 모아 둔 순서대로 JHashTableAddData 와 같이 추가한다.
+ * @param table 데이터를 추가할 해쉬 테이블 구조체 객체의 주소(입력, 버퍼보다 먼저 삭제하면 안됨)
+ * @param flushSize 비우기 크기(입력, 0 이하면 JHT_DEFAULT_FLUSH_SIZE)
+ * @param flushDelayNs 최대 대기 시간(입력, ns, 0 이면 개수로만 비움)
+ * @return 성공 시 새로 생성된 쓰기 버퍼 구조체 객체의 주소, 실패 시 NULL 반환
+ */
+JInsertBufferPtr NewJInsertBuffer(JHashTablePtr table, int flushSize, uint64_t flushDelayNs)
+{
+	if(table == NULL) return NULL;
+	if(flushSize <= 0) flushSize = JHT_DEFAULT_FLUSH_SIZE;
+
+	JInsertBufferPtr newBuffer = (JInsertBufferPtr)calloc(1, sizeof(JInsertBuffer));
+	if(newBuffer == NULL) return NULL;
+
+	newBuffer->table = table;
+	newBuffer->flushSize = flushSize;
+	newBuffer->flushDelayNs = flushDelayNs;
+	newBuffer->entries = (JBufferEntryPtr)malloc(sizeof(JBufferEntry) * (size_t)flushSize);
+	if(newBuffer->entries == NULL)
+	{
+		free(newBuffer);
+		return NULL;
+	}
+
+	// 잠금 그룹으로 나누지 않는 테이블은 그룹 배열 없이 모아 둔 순서대로 추가한다.
+	if((table->lockStripes == NULL) || (table->storageType == OpenAddressStorage) || (table->lockFreeBuckets != NULL))
+	{
+		newBuffer->groupCount = 1;
+		return newBuffer;
+	}
+
+	newBuffer->groupCount = table->lockStripeCount;
+	newBuffer->groupHeads = (int*)malloc(sizeof(int) * (size_t)newBuffer->groupCount);
+	newBuffer->groupTails = (int*)malloc(sizeof(int) * (size_t)newBuffer->groupCount);
+	newBuffer->groupSizes = (int*)calloc((size_t)newBuffer->groupCount, sizeof(int));
+	newBuffer->usedGroups = (int*)malloc(sizeof(int) * (size_t)newBuffer->groupCount);
+	if((newBuffer->groupHeads == NULL) || (newBuffer->groupTails == NULL) || (newBuffer->groupSizes == NULL) || (newBuffer->usedGroups == NULL))
+	{
+		free(newBuffer->groupHeads);
+		free(newBuffer->groupTails);
+		free(newBuffer->groupSizes);
+		free(newBuffer->usedGroups);
+		free(newBuffer->entries);
+		free(newBuffer);
+		return NULL;
+	}
+	memset(newBuffer->groupHeads, 0xFF, sizeof(int) * (size_t)newBuffer->groupCount);
+
+	return newBuffer;
+}
+
+/**
+ * @fn DeleteResult DeleteJInsertBuffer(JInsertBufferPtrContainer container)
+ * @brief 모아 둔 데이터를 테이블에 추가한 후 쓰기 버퍼를 삭제하는 함수
+ * 메모리 할당 실패로 모아 둔 데이터를 모두 추가하지 못하면, 남은 데이터를 버리지 않도록 버퍼를 삭제하지 않는다.
+ * @param container 쓰기 버퍼 구조체 객체의 주소를 저장한 이중 포인터(입력)
+ * @return 성공 시 DeleteSuccess, 실패 시 DeleteFail 반환(DeleteResult 열거형 참고)
+ */
+DeleteResult DeleteJInsertBuffer(JInsertBufferPtrContainer container)
+{
+	if(container == NULL || *container == NULL) return DeleteFail;
+
+	JInsertBufferPtr buffer = *container;
+	if(JInsertBufferFlushEntries(buffer, 0) == HASH_FAIL) return DeleteFail;
+
+	free(buffer->groupHeads);
+	free(buffer->groupTails);
+	free(buffer->groupSizes);
+	free(buffer->usedGroups);
+	free(buffer->entries);
+	free(buffer);
+	*container = NULL;
+
+	return DeleteSuccess;
+}
+
+/**
+ * @fn JInsertBufferPtr JInsertBufferAdd(JInsertBufferPtr buffer, void *key, void *value)
+ * @brief 쓰기 버퍼에 추가할 데이터를 모아 두는 함수
+ * 모아 둔 데이터가 비우기 크기가 되거나, 처음 모아 둔 데이터가 최대 대기 시간보다 오래 기다렸으면 테이블에 추가한다.
+ * 대기 시간은 이 함수를 호출할 때만 검사하므로, 더 추가할 데이터가 없으면 JInsertBufferFlush 를 호출해야 한다.
+ * 비우는 중 추가하지 못한 데이터는 버퍼에 남으므로(JInsertBufferFlush 참고), 남은 데이터로 버퍼가 가득 차 있으면 먼저 다시 비워 보고
+ * 그래도 가득 차 있으면 모아 두지 않고 실패한다.
+ * @param buffer 쓰기 버퍼 구조체 객체의 주소(출력)
+ * @param key 저장할 키(입력)
+ * @param value 저장할 데이터(입력)
+ * @return 성공 시 쓰기 버퍼 구조체의 주소, 실패 시(비우는 중 메모리 할당 실패 포함) NULL 반환
+ */
+JInsertBufferPtr JInsertBufferAdd(JInsertBufferPtr buffer, void *key, void *value)
+{
+	if(buffer == NULL || key == NULL || value == NULL) return NULL;
+	if(buffer->entryCount >= buffer->flushSize)
+	{
+		JInsertBufferFlushEntries(buffer, 0);
+		if(buffer->entryCount >= buffer->flushSize) return NULL;
+	}
+
+	uint64_t nowNs = 0;
+	if((buffer->entryCount == 0) || (buffer->flushDelayNs > 0)) nowNs = JInsertBufferGetNowNs();
+	if(buffer->entryCount == 0) buffer->firstAddNs = nowNs;
+
+	int entryIndex = buffer->entryCount;
+	JBufferEntryPtr entry = &(buffer->entries[entryIndex]);
+	entry->key = key;
+	entry->value = value;
+	entry->next = -1;
+
+	if(buffer->groupHeads != NULL)
+	{
+		entry->hash = JHashTableGetFullHash(buffer->table, key);
+		entry->lockIndex = JHashTableGetLockIndex(buffer->table, entry->hash);
+		JInsertBufferLinkEntry(buffer, entryIndex);
+	}
+
+	buffer->entryCount++;
+	buffer->stats.bufferedCount++;
+
+	int result = 0;
+	if(buffer->entryCount >= buffer->flushSize)
+	{
+		result = JInsertBufferFlushEntries(buffer, 0);
+	}
+	else if((buffer->flushDelayNs > 0) && (nowNs - buffer->firstAddNs >= buffer->flushDelayNs))
+	{
+		result = JInsertBufferFlushEntries(buffer, 1);
+	}
+
+	if(result == HASH_FAIL) return NULL;
+	return buffer;
+}
+
+/**
+ * @fn int JInsertBufferFlush(JInsertBufferPtr buffer)
+ * @brief 쓰기 버퍼에 모아 둔 데이터를 테이블에 모두 추가하는 함수
+ * 이미 저장되어 있는 데이터(같은 키와 데이터)는 추가하지 않는다.
+ * 메모리 할당 실패로 추가하지 못한 데이터는 버려지지 않고 버퍼에 남아서 다음 비우기에서 다시 추가한다(JInsertBufferGetPendingCount 로 확인).
+ * @param buffer 쓰기 버퍼 구조체 객체의 주소(출력)
+ * @return 성공 시 테이블에 추가된 데이터 개수, 실패 시(메모리 할당 실패 포함) HASH_FAIL 반환
+ */
+int JInsertBufferFlush(JInsertBufferPtr buffer)
+{
+	if(buffer == NULL) return HASH_FAIL;
+	return JInsertBufferFlushEntries(buffer, 0);
+}
+
+/**
+ * @fn int JInsertBufferGetPendingCount(const JInsertBufferPtr buffer)
+ * @brief 쓰기 버퍼에 모아 두고 아직 테이블에 추가하지 않은 데이터 개수를 반환하는 함수
+ * @param buffer 쓰기 버퍼 구조체 객체의 주소(입력, 읽기 전용)
+ * @return 성공 시 모아 둔 데이터 개수, 실패 시 HASH_FAIL 반환
+ */
+int JInsertBufferGetPendingCount(const JInsertBufferPtr buffer)
+{
+	if(buffer == NULL) return HASH_FAIL;
+	return buffer->entryCount;
+}
+
+/**
+ * @fn JInsertBufferStatsPtr JInsertBufferGetStats(const JInsertBufferPtr buffer, JInsertBufferStatsPtr stats)
+ * @brief 쓰기 버퍼의 누적 통계를 반환하는 함수
+ * @param buffer 쓰기 버퍼 구조체 객체의 주소(입력, 읽기 전용)
+ * @param stats 통계를 저장할 구조체 객체의 주소(출력)
+ * @return 성공 시 stats, 실패 시 NULL 반환
+ */
+JInsertBufferStatsPtr JInsertBufferGetStats(const JInsertBufferPtr buffer, JInsertBufferStatsPtr stats)
+{
+	if(buffer == NULL || stats == NULL) return NULL;
+	*stats = buffer->stats;
+	return stats;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Static Functions
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static HashType CheckHashType(HashType type)
+ * @brief 지정한 해쉬 유형이 등록되어 있는지 검사하는 함수
+ * @param type 검사할 해쉬 유형(입력)
+ * @return 성공 시 지정한 해쉬 유형, 실패 시 Unknown 반환(HashType 열거형 참고)
+ */
+static HashType CheckHashType(HashType type)
+{
+	switch(type)
+	{
+		case IntType:
+		case CharType:
+		case StringType:
+		return type;
+	}
+	return Unknown;
+}
+
+/**
+ * @fn static JLinkedListPtr JLinkedListAppendNode(JLinkedListPtr list, void *key, void *data, uint64_t hash)
+ * @brief 연결 리스트의 마지막에 키와 데이터를 저장한 새로운 노드를 추가하는 함수
+ * 중복 검사는 호출하는 함수에서 수행한다.
+ * @param list 연결 리스트 구조체 객체의 주소(출력)
+ * @param key 저장할 노드의 키 주소(입력, NULL 허용)
+ * @param data 저장할 노드의 데이터 주소(입력)
+ * @param hash 키의 전체 해쉬값(입력)
+ * @return 성공 시 연결 리스트 구조체의 주소, 실패 시 NULL 반환
+ */
+static JLinkedListPtr JLinkedListAppendNode(JLinkedListPtr list, void *key, void *data, uint64_t hash)
+{
+	if(list == NULL || data == NULL) return NULL;
+
+	JNodePtr newNode = JLinkedListNewNode(list);
+	if(newNode == NULL) return NULL;
+	newNode->key = key;
+	newNode->data = data;
+	newNode->hash = hash;
+
+	JLinkedListLinkNode(list, newNode);
+	return list;
+}
+
+/**
+ * @fn static JNodePtr JLinkedListNewNode(const JLinkedListPtr list)
+ * @brief 연결 리스트에서 사용할 새로운 노드를 할당하는 함수
+ * @param list 연결 리스트 구조체 객체의 주소(입력, 읽기 전용)
+ * @return 성공 시 생성된 노드 구조체 객체의 주소, 실패 시 NULL 반환
+ */
+static JNodePtr JLinkedListNewNode(const JLinkedListPtr list)
+{
+	if(list->pool == NULL) return NewJNode();
+
+	JNodePtr newNode = (JNodePtr)JPoolAlloc(&(list->pool->nodes));
+	if(newNode == NULL) return NULL;
+	newNode->key = NULL;
+	newNode->data = NULL;
+	newNode->hash = 0;
+	return newNode;
+}
+
+/**
+ * @fn static void JLinkedListFreeNode(const JLinkedListPtr list, JNodePtr node)
+ * @brief 연결 리스트에서 사용한 노드를 해제하는 함수(메모리 풀 사용 시 메모리 풀에 반환)
+ * @param list 연결 리스트 구조체 객체의 주소(입력, 읽기 전용)
+ * @param node 해제할 노드의 주소(입력)
+ * @return 반환값 없음
+ */
+static void JLinkedListFreeNode(const JLinkedListPtr list, JNodePtr node)
+{
+	if(list->pool == NULL)
+	{
+		free(node);
+		return;
+	}
+
+	// 슬랩은 테이블을 삭제할 때까지 남아 있으므로, 세대 번호를 바꿔서 이 노드를 가리키는 핸들을 무효화한다.
+	node->generation++;
+	JPoolRelease(&(list->pool->nodes), node);
+}
+
+/**
+ * @fn static void JLinkedListLinkNode(JLinkedListPtr list, JNodePtr node)
+ * @brief 이미 생성된 노드를 연결 리스트의 마지막에 연결하는 함수
+ * @param list 연결 리스트 구조체 객체의 주소(출력)
+ * @param node 연결할 노드의 주소(입력)
+ * @return 반환값 없음
+ */
+static void JLinkedListLinkNode(JLinkedListPtr list, JNodePtr node)
+{
+	JNodePtr oldNode = list->tail->prev;
+	node->prev = oldNode;
+	node->next = list->tail;
+	// 노드를 모두 초기화한 후 연결해야 잠금 없이 순회하는 스레드가 초기화된 노드만 본다.
+	__atomic_store_n(&(oldNode->next), node, __ATOMIC_RELEASE);
+	__atomic_store_n(&(list->tail->prev), node, __ATOMIC_RELEASE);
+	list->size++;
+}
+
+/**
+ * @fn static void JLinkedListUnlinkNode(JLinkedListPtr list, JNodePtr node)
+ * @brief 노드를 삭제하지 않고 연결 리스트에서 분리하는 함수
+ * 분리된 노드의 next 는 분리 전의 다음 노드를 가리킨다.
+ * @param list 연결 리스트 구조체 객체의 주소(출력)
+ * @param node 분리할 노드의 주소(입력)
+ * @return 반환값 없음
+ */
+static void JLinkedListUnlinkNode(JLinkedListPtr list, JNodePtr node)
+{
+	__atomic_store_n(&(node->prev->next), node->next, __ATOMIC_RELEASE);
+	__atomic_store_n(&(node->next->prev), node->prev, __ATOMIC_RELEASE);
+	// next 는 유지해서 잠금 없이 이 노드를 순회 중인 스레드가 다음 노드로 이동할 수 있게 한다.
+	node->prev = NULL;
+	list->size--;
+}
+
+/**
+ * @fn static int JLinkedListHasNode(const JLinkedListPtr list, const JNodePtr node)
+ * @brief 노드가 연결 리스트에 연결되어 있는지 검사하는 함수
+ * 노드의 주소만 비교하므로 이미 해제된 노드의 주소를 전달해도 된다.
+ * @param list 연결 리스트 구조체 객체의 주소(입력, 읽기 전용, NULL 이면 연결되지 않은 것으로 처리)
+ * @param node 검사할 노드의 주소(입력, 읽기 전용)
+ * @return 연결되어 있으면 1, 아니면 0 반환
+ */
+static int JLinkedListHasNode(const JLinkedListPtr list, const JNodePtr node)
+{
+	if(list == NULL) return 0;
+
+	JNodePtr curNode = list->head->next;
+	while(curNode != list->tail)
+	{
+		if(curNode == node) return 1;
+		curNode = curNode->next;
+	}
+	return 0;
+}
+
+/**
+ * @fn static int JHashTableIsKeyEqual(const JHashTablePtr table, const void *key1, const void *key2)
+ * @brief 해쉬 테이블의 키 유형에 따라 두 키가 같은지 비교하는 함수
+ * @param table 해쉬 테이블 구조체 객체의 주소(입력, 읽기 전용)
+ * @param key1 비교할 첫 번째 키(입력, 읽기 전용)
+ * @param key2 비교할 두 번째 키(입력, 읽기 전용)
+ * @return 같으면 1, 다르면 0 반환
+ */
+static int JHashTableIsKeyEqual(const JHashTablePtr table, const void *key1, const void *key2)
+{
+	if(key1 == NULL || key2 == NULL) return 0;
+	if(key1 == key2) return 1;
+
+	switch(table->keyType)
+	{
+		case IntType:
+			return (*((const int*)key1) == *((const int*)key2)) ? 1 : 0;
+		case CharType:
+			return (*((const char*)key1) == *((const char*)key2)) ? 1 : 0;
+		case StringType:
+			return (strcmp((const char*)key1, (const char*)key2) == 0) ? 1 : 0;
+		default: return 0;
+	}
+}
+
+/**
+ * @fn static JHashTablePtr JHashTableInsert(JHashTablePtr table, void *key, void *value, int checkDuplicate)
+ * @brief 해쉬 테이블에 새로운 데이터를 추가하는 함수(JHashTableAddData, JHashTableAddUnchecked 공용)
+ * @param table 해쉬 테이블 구조체 객체의 주소(출력)
+ * @param key 저장할 키(입력)
+ * @param value 저장할 데이터(입력)
+ * @param checkDuplicate 같은 키와 데이터가 저장되어 있는지 검사할지 여부(입력)
+ * @return 성공 시 해쉬 테이블 구조체의 주소, 실패 시 NULL 반환
+ */
+static JHashTablePtr JHashTableInsert(JHashTablePtr table, void *key, void *value, int checkDuplicate)
+{
+	if(table == NULL || key == NULL || value == NULL) return NULL;
+	if(table->storageType == OpenAddressStorage) return JSwissAddData(table, key, value, checkDuplicate);
+	if(table->lockFreeBuckets != NULL) return JLockFreeAddData(table, key, value, checkDuplicate);
+
+	JHashTableRehashStep(table, JHT_REHASH_STEP);
+
+	uint64_t hash = JHashTableGetFullHash(table, key);
+	int lockIndex = JHashTableGetLockIndex(table, hash);
+	int count = 0;
+
+	// 재해싱 중에는 잠금을 잡은 후에 Slot 을 찾아야 옮겨지는 중인 Slot 을 사용하지 않는다.
+	JHashTableLockBucket(table, lockIndex, 1);
+	int result = JHashTableInsertLocked(table, key, value, hash, lockIndex, checkDuplicate, &count);
+	JHashTableUnlockBucket(table, lockIndex, 1);
+	if(result != 1) return NULL;
+
+	JHashTableCheckGrowth(table, count, 1);
+	return table;
+}
+
+/**
+ * @fn static int JHashTableInsertLocked(JHashTablePtr table, void *key, void *value, uint64_t hash, int lockIndex, int checkDuplicate, int *count)
+ * @brief (Chaining) 키를 보호하는 잠금을 잡은 상태에서 데이터를 추가하는 함수
+ * @param table 해쉬 테이블 구조체 객체의 주소(출력, 동시 접근 모드면 lockIndex 의 쓰기 잠금을 잡은 상태)
+ * @param key 저장할 키(입력)
+ * @param value 저장할 데이터(입력)
+ * @param hash 키의 전체 해쉬값(입력)
+ * @param lockIndex 키의 잠금 위치(입력)
+ * @param checkDuplicate 같은 키와 데이터가 저장되어 있는지 검사할지 여부(입력)
+ * @param count 추가 후 데이터 개수(출력, 동시 접근 모드에서는 잠금별 데이터 개수)
+ * @return 추가하면 1, 이미 저장되어 있으면 0, 메모리 할당에 실패하면 HASH_FAIL 반환
+ */
+static int JHashTableInsertLocked(JHashTablePtr table, void *key, void *value, uint64_t hash, int lockIndex, int checkDuplicate, int *count)
+{
+	int listIndex = 0;
+	JLinkedListPtrContainer container = JHashTableLocateList(table, hash, &listIndex);
+	if((checkDuplicate != 0) && (JHashTableFindNode(table, container[listIndex], hash, key, value) != NULL)) return 0;
+
+	JLinkedListPtr list = JHashTableMaterializeList(table, container, listIndex, lockIndex);
+	if(JLinkedListAppendNode(list, key, value, hash) == NULL) return HASH_FAIL;
+
+	JBucketBitmapUpdate(JHashTableGetBitmap(table, container), list);
+	*count = JHashTableAddCount(table, lockIndex, 1);
+	return 1;
+}
+
+/**
+ * @fn static void* JHashTableFindOrAdd(JHashTablePtr table, void *key, void *value, int isUpdate, InsertResult *result)
+ * @brief 키를 한 번 해싱하고 버킷을 한 번 검색해서 저장된 데이터를 찾거나(교체하거나) 새로운 데이터를 추가하는 함수
+ * (JHashTableGetOrInsert, JHashTableUpsert 공용)
+ * Chaining 저장소는 키의 쓰기 잠금 안에서 검색하고, 찾지 못하면 이미 찾은 연결 리스트의 끝에 바로 연결한다.
+ * @param table 해쉬 테이블 구조체 객체의 주소(출력)
+ * @param key 검색하거나 저장할 키(입력)
+ * @param value 저장할 데이터(입력)
+ * @param isUpdate 키를 찾으면 데이터를 value 로 교체할지 여부(입력)
+ * @param result 추가했으면 InsertAdded, 찾았으면 InsertExisting, 실패하면 InsertFail(출력)
+ * @return 키를 찾았으면 찾은 데이터(교체했으면 교체 전 데이터), 아니면 NULL 반환
+ */
+static void* JHashTableFindOrAdd(JHashTablePtr table, void *key, void *value, int isUpdate, InsertResult *result)
+{
+	if(table->storageType == OpenAddressStorage) return JSwissFindOrAdd(table, key, value, isUpdate, result);
+	if(table->lockFreeBuckets != NULL) return JLockFreeFindOrAdd(table, key, value, isUpdate, result);
+
+	JHashTableRehashStep(table, JHT_REHASH_STEP);
+
+	uint64_t hash = JHashTableGetFullHash(table, key);
+	int lockIndex = JHashTableGetLockIndex(table, hash);
+	int listIndex = 0;
+	int count = 0;
+	void *data = NULL;
+
+	*result = InsertFail;
+	JHashTableLockBucket(table, lockIndex, 1);
+	JLinkedListPtrContainer container = JHashTableLocateList(table, hash, &listIndex);
+	JNodePtr node = JHashTableFindNode(table, container[listIndex], hash, key, NULL);
+	if(node != NULL)
+	{
+		// 잠금 없이 검색하는 스레드가 있을 수 있으므로 데이터는 release 로 교체한다.
+		if(isUpdate != 0) data = __atomic_exchange_n(&(node->data), value, __ATOMIC_ACQ_REL);
+		else data = node->data;
+		*result = InsertExisting;
+	}
+	else
+	{
+		JLinkedListPtr list = JHashTableMaterializeList(table, container, listIndex, lockIndex);
+		if(JLinkedListAppendNode(list, key, value, hash) != NULL)
+		{
+			JBucketBitmapUpdate(JHashTableGetBitmap(table, container), list);
+			count = JHashTableAddCount(table, lockIndex, 1);
+			*result = InsertAdded;
+		}
+	}
+	JHashTableUnlockBucket(table, lockIndex, 1);
+
+	if(*result == InsertAdded) JHashTableCheckGrowth(table, count, 1);
+	return data;
+}
+
+/**
+ * @fn static void JHashTableCheckGrowth(JHashTablePtr table, int count, int addedCount)
+ * @brief (Chaining) 데이터를 추가한 후 적재율 기준을 넘었으면 재해싱을 시작하는 함수
+ * @param table 해쉬 테이블 구조체 객체의 주소(출력, 버킷 잠금을 잡지 않은 상태)
+ * @param count 추가 후 데이터 개수(입력, 동시 접근 모드에서는 잠금별 데이터 개수)
+ * @param addedCount 이번에 추가한 데이터 개수(입력)
+ * @return 반환값 없음
+ */
+static void JHashTableCheckGrowth(JHashTablePtr table, int count, int addedCount)
+{
+	if(table->lockStripes != NULL)
+	{
+		if(table->cooperativeResize != 0) JHashTableCheckSharedGrowth(table, count, addedCount);
+	}
+	else if((table->rehashContainer == NULL) && (table->loadFactor > 0)
+		&& ((double)table->count > table->loadFactor * (double)table->size))
+	{
+		JHashTableStartRehash(table);
+	}
+}
+
+/**
+ * @fn static JNodePtr JHashTableFindNode(const JHashTablePtr table, const JLinkedListPtr list, uint64_t hash, const void *key, const void *value)
+ * @brief 연결 리스트에서 지정한 키(와 데이터)를 저장한 노드를 검색하는 함수
+ * 노드에 저장된 전체 해쉬값이 같은 노드만 데이터 주소와 키를 비교한다.
+ * 잠금 없는 검색에서도 사용하므로 다음 노드 주소는 acquire 로 읽는다.
+ * @param table 해쉬 테이블 구조체 객체의 주소(입력, 읽기 전용)
+ * @param list 검색할 연결 리스트 구조체 객체의 주소(입력, 읽기 전용)
+ * @param hash 검색할 키의 전체 해쉬값(입력)
+ * @param key 검색할 키(입력, 읽기 전용)
+ * @param value 검색할 데이터(입력, 읽기 전용, NULL 이면 키만 비교)
+ * @return 성공 시 검색된 노드의 주소, 실패 시 NULL 반환
+ */
+static JNodePtr JHashTableFindNode(const JHashTablePtr table, const JLinkedListPtr list, uint64_t hash, const void *key, const void *value)
+{
+	if(list == NULL || key == NULL) return NULL;
+
+	JNodePtr node = __atomic_load_n(&(list->head->next), __ATOMIC_ACQUIRE);
+	while(node != list->tail)
+	{
+		if((node->hash == hash) && ((value == NULL) || (__atomic_load_n(&(node->data), __ATOMIC_RELAXED) == value))
+			&& (JHashTableIsKeyEqual(table, node->key, key) == 1))
+		{
+			return node;
+		}
+		node = __atomic_load_n(&(node->next), __ATOMIC_ACQUIRE);
+	}
+
+	return NULL;
+}
+
+/**
+ * @fn static int JHashTableGetBucketIndex(const JHashTablePtr table, uint64_t hash, int size)
+ * @brief 전체 해쉬값으로 버킷 위치를 계산하는 함수
+ * 2 의 거듭제곱 버킷이면 Fibonacci 곱셈 후 상위 log2(size) bit 를 사용하고, 아니면 나머지 연산을 사용한다.
+ * @param table 해쉬 테이블 구조체 객체의 주소(입력, 읽기 전용)
+ * @param hash 키의 전체 해쉬값(입력)
+ * @param size 버킷 개수(입력, 2 의 거듭제곱 버킷이면 2 이상의 2 의 거듭제곱)
+ * @return 항상 버킷 위치 반환
+ */
+static int JHashTableGetBucketIndex(const JHashTablePtr table, uint64_t hash, int size)
+{
+	if(table->powerOfTwoBuckets != 0)
+	{
+		// size = 2^k 이면 __builtin_clzll(size) + 1 = 64 - k
+		return (int)((hash * JHT_FIBONACCI_MULTIPLIER) >> (__builtin_clzll((unsigned long long)size) + 1));
+	}
+	return (int)(hash % (uint64_t)size);
+}
+
+/**
+ * @fn static JLinkedListPtrContainer JHashTableLocateList(const JHashTablePtr table, uint64_t hash, int *listIndex)
+ * @brief 지정한 전체 해쉬값의 키가 저장될 Slot 을 찾는 함수
+ * 재해싱 중이면 이미 옮겨진 기존 Slot 대신 새로운 Slot 을 반환한다.
+ * 동시 접근 모드에서는 키의 버킷 잠금을 잡은 후 호출하며, 기존 Slot 의 전달 표시로 옮겨졌는지 확인한다.
+ * @param table 해쉬 테이블 구조체 객체의 주소(입력, 읽기 전용)
+ * @param hash 키의 전체 해쉬값(입력)
+ * @param listIndex 찾은 Slot 의 위치(출력)
+ * @return 항상 Slot 이 속한 Slot 배열의 주소 반환
+ */
+static JLinkedListPtrContainer JHashTableLocateList(const JHashTablePtr table, uint64_t hash, int *listIndex)
+{
+	int index = JHashTableGetBucketIndex(table, hash, table->size);
+
+	if(table->cooperativeResize != 0)
+	{
+		if(__atomic_load_n(&(table->listContainer[index]), __ATOMIC_ACQUIRE) == JHT_FORWARD_LIST)
+		{
+			*listIndex = JHashTableGetBucketIndex(table, hash, table->rehashSize);
+			return table->rehashContainer;
+		}
+		*listIndex = index;
+		return table->listContainer;
+	}
+
+	if((table->rehashContainer != NULL) && (index < table->rehashIndex))
+	{
+		*listIndex = JHashTableGetBucketIndex(table, hash, table->rehashSize);
+		return table->rehashContainer;
+	}
+
+	*listIndex = index;
+	return table->listContainer;
+}
+
+/**
+ * @fn static JLinkedListPtr JHashTableMaterializeList(const JHashTablePtr table, JLinkedListPtrContainer container, int listIndex, int lockIndex)
+ * @brief Slot 의 연결 리스트를 반환하는 함수
+ * 아직 연결 리스트가 생성되지 않은 Slot 이면 테이블의 메모리 풀에서 새로 생성해서 저장한다.
+ * @param table 해쉬 테이블 구조체 객체의 주소(입력, 읽기 전용)
+ * @param container Slot 배열의 주소(출력)
+ * @param listIndex Slot 의 위치(입력)
+ * @param lockIndex Slot 을 보호하는 잠금 위치(입력, 동시 접근 모드가 아니면 사용하지 않음)
+ * @return 성공 시 연결 리스트 구조체 객체의 주소, 실패 시 NULL 반환
+ */
+static JLinkedListPtr JHashTableMaterializeList(const JHashTablePtr table, JLinkedListPtrContainer container, int listIndex, int lockIndex)
+{
+	if(container[listIndex] == NULL)
+	{
+		// 잠금 없이 검색하는 스레드가 초기화된 연결 리스트만 보도록 release 로 저장한다.
+		__atomic_store_n(&(container[listIndex]), JLinkedListNewWithPool(listIndex, JHashTableGetNodePool(table, lockIndex)), __ATOMIC_RELEASE);
+	}
+	return container[listIndex];
+}
+
+/**
+ * @fn static JLinkedListPtr JHashTableGetFirstList(const JHashTablePtr table, JBucketBitmapPtr *bitmap)
+ * @brief 데이터가 저장된 첫 번째 연결 리스트를 반환하는 함수
+ * 재해싱 중이면 아직 옮기지 않은 기존 Slot 들을 먼저 검사하고 새로운 Slot 들을 검사한다.
+ * 옮겨진 기존 Slot 은 bitmap 에서 지워지므로 bitmap 검사만으로 순서가 유지된다.
+ * @param table 해쉬 테이블 구조체 객체의 주소(입력, 읽기 전용)
+ * @param bitmap 찾은 연결 리스트가 속한 Slot 배열의 bitmap(출력, NULL 허용)
+ * @return 성공 시 연결 리스트 구조체 객체의 주소, 실패 시 NULL 반환
+ */
+static JLinkedListPtr JHashTableGetFirstList(const JHashTablePtr table, JBucketBitmapPtr *bitmap)
+{
+	if(table->count <= 0) return NULL;
+
+	int listIndex = JBucketBitmapFindFirst(&(table->occupied));
+	if(listIndex >= 0)
+	{
+		if(bitmap != NULL) *bitmap = &(table->occupied);
+		return table->listContainer[listIndex];
+	}
+
+	if(table->rehashContainer == NULL) return NULL;
+
+	listIndex = JBucketBitmapFindFirst(&(table->rehashOccupied));
+	if(listIndex < 0) return NULL;
+	if(bitmap != NULL) *bitmap = &(table->rehashOccupied);
+	return table->rehashContainer[listIndex];
+}
+
+/**
+ * @fn static JLinkedListPtr JHashTableGetLastList(const JHashTablePtr table, JBucketBitmapPtr *bitmap)
+ * @brief 데이터가 저장된 마지막 연결 리스트를 반환하는 함수
+ * JHashTableGetFirstList 와 반대 순서(새로운 Slot 들의 끝부터)로 검사한다.
+ * @param table 해쉬 테이블 구조체 객체의 주소(입력, 읽기 전용)
+ * @param bitmap 찾은 연결 리스트가 속한 Slot 배열의 bitmap(출력, NULL 허용)
+ * @return 성공 시 연결 리스트 구조체 객체의 주소, 실패 시 NULL 반환
+ */
+static JLinkedListPtr JHashTableGetLastList(const JHashTablePtr table, JBucketBitmapPtr *bitmap)
+{
+	if(table->count <= 0) return NULL;
+
+	int listIndex = 0;
+	if(table->rehashContainer != NULL)
+	{
+		listIndex = JBucketBitmapFindLast(&(table->rehashOccupied));
+		if(listIndex >= 0)
+		{
+			if(bitmap != NULL) *bitmap = &(table->rehashOccupied);
+			return table->rehashContainer[listIndex];
+		}
+	}
+
+	listIndex = JBucketBitmapFindLast(&(table->occupied));
+	if(listIndex < 0) return NULL;
+	if(bitmap != NULL) *bitmap = &(table->occupied);
+	return table->listContainer[listIndex];
+}
+
+/**
+ * @fn static JBucketBitmapPtr JHashTableGetBitmap(const JHashTablePtr table, const JLinkedListPtrContainer container)
+ * @brief Slot 배열에 해당하는 bitmap 을 반환하는 함수
+ * @param table 해쉬 테이블 구조체 객체의 주소(입력, 읽기 전용)
+ * @param container Slot 배열의 주소(입력, 읽기 전용)
+ * @return 항상 bitmap 의 주소 반환
+ */
+static JBucketBitmapPtr JHashTableGetBitmap(const JHashTablePtr table, const JLinkedListPtrContainer container)
+{
+	// 동시 접근 모드에서 재해싱이 시작되는 중에도 바뀌지 않는 기존 Slot 배열과 비교한다.
+	if(container == table->listContainer) return &(table->occupied);
+	return &(table->rehashOccupied);
+}
+
+/**
+ * @fn static int JBucketBitmapInit(JBucketBitmapPtr bitmap, int bucketCount)
+ * @brief 모든 버킷이 비어 있는 bitmap 을 할당하는 함수
+ * @param bitmap bitmap 구조체 객체의 주소(출력)
+ * @param bucketCount 버킷 개수(입력)
+ * @return 성공 시 word 개수, 실패 시 HASH_FAIL 반환
+ */
+static int JBucketBitmapInit(JBucketBitmapPtr bitmap, int bucketCount)
+{
+	int wordCount = (bucketCount + 63) / 64;
+	uint64_t *words = (uint64_t*)calloc((size_t)wordCount, sizeof(uint64_t));
+	if(words == NULL) return HASH_FAIL;
+
+	bitmap->words = words;
+	bitmap->wordCount = wordCount;
+	bitmap->lowWord = wordCount;
+	bitmap->highWord = -1;
+	return wordCount;
+}
+
+/**
+ * @fn static void JBucketBitmapFree(JBucketBitmapPtr bitmap)
+ * @brief bitmap 을 해제하는 함수
+ * @param bitmap bitmap 구조체 객체의 주소(출력)
+ * @return 반환값 없음
+ */
+static void JBucketBitmapFree(JBucketBitmapPtr bitmap)
+{
+	free(bitmap->words);
+	memset(bitmap, 0, sizeof(JBucketBitmap));
+}
+
+/**
+ * @fn static void JBucketBitmapUpdate(JBucketBitmapPtr bitmap, const JLinkedListPtr list)
+ * @brief 연결 리스트의 데이터 유무에 따라 해당 버킷의 bit 를 설정하거나 지우는 함수
+ * 버킷 위치는 연결 리스트의 해쉬값(Slot 위치)을 사용한다.
+ * @param bitmap bitmap 구조체 객체의 주소(출력)
+ * @param list 변경된 연결 리스트 구조체 객체의 주소(입력, 읽기 전용)
+ * @return 반환값 없음
+ */
+static void JBucketBitmapUpdate(JBucketBitmapPtr bitmap, const JLinkedListPtr list)
+{
+	int wordIndex = list->hash >> 6;
+	uint64_t bit = 1ULL << (list->hash & 63);
+
+	if(bitmap->isShared != 0)
+	{
+		// 다른 잠금이 보호하는 버킷과 word 를 공유하므로 bit 가 바뀔 때만 원자적으로 갱신한다.
+		uint64_t word = __atomic_load_n(&(bitmap->words[wordIndex]), __ATOMIC_RELAXED);
+		if(list->size > 0)
+		{
+			if((word & bit) == 0) __atomic_fetch_or(&(bitmap->words[wordIndex]), bit, __ATOMIC_RELEASE);
+			JBucketBitmapWiden(bitmap, wordIndex);
+		}
+		else if((word & bit) != 0)
+		{
+			__atomic_fetch_and(&(bitmap->words[wordIndex]), ~bit, __ATOMIC_RELEASE);
+		}
+		return;
+	}
+
+	if(list->size > 0)
+	{
+		bitmap->words[wordIndex] |= bit;
+		if(wordIndex < bitmap->lowWord) bitmap->lowWord = wordIndex;
+		if(wordIndex > bitmap->highWord) bitmap->highWord = wordIndex;
+	}
+	else
+	{
+		bitmap->words[wordIndex] &= ~bit;
+	}
+}
+
+/**
+ * @fn static int JBucketBitmapFindFirst(JBucketBitmapPtr bitmap)
+ * @brief 데이터가 있는 첫 번째 버킷 위치를 찾는 함수
+ * 검사하면서 지나간 0 인 word 만큼 lowWord 를 앞으로 옮기므로, 앞에서부터 반복 삭제해도 전체 검사 비용은 word 개수에 비례한다.
+ * @param bitmap bitmap 구조체 객체의 주소(출력)
+ * @return 성공 시 버킷 위치, 실패 시 HASH_FAIL 반환
+ */
+static int JBucketBitmapFindFirst(JBucketBitmapPtr bitmap)
+{
+	if(bitmap->isShared != 0) return JBucketBitmapFindShared(bitmap, 1);
+
+	int wordIndex = bitmap->lowWord;
+	for( ; wordIndex <= bitmap->highWord; wordIndex++)
+	{
+		if(bitmap->words[wordIndex] != 0)
+		{
+			bitmap->lowWord = wordIndex;
+			return (wordIndex << 6) + __builtin_ctzll(bitmap->words[wordIndex]);
+		}
+	}
+
+	bitmap->lowWord = bitmap->wordCount;
+	bitmap->highWord = -1;
+	return HASH_FAIL;
+}
+
+/**
+ * @fn static int JBucketBitmapFindLast(JBucketBitmapPtr bitmap)
+ * @brief 데이터가 있는 마지막 버킷 위치를 찾는 함수
+ * 검사하면서 지나간 0 인 word 만큼 highWord 를 뒤로 옮긴다.
+ * @param bitmap bitmap 구조체 객체의 주소(출력)
+ * @return 성공 시 버킷 위치, 실패 시 HASH_FAIL 반환
+ */
+static int JBucketBitmapFindLast(JBucketBitmapPtr bitmap)
+{
+	if(bitmap->isShared != 0) return JBucketBitmapFindShared(bitmap, 0);
+
+	int wordIndex = bitmap->highWord;
+	for( ; wordIndex >= bitmap->lowWord; wordIndex--)
+	{
+		if(bitmap->words[wordIndex] != 0)
+		{
+			bitmap->highWord = wordIndex;
+			return (wordIndex << 6) + 63 - __builtin_clzll(bitmap->words[wordIndex]);
+		}
+	}
+
+	bitmap->lowWord = bitmap->wordCount;
+	bitmap->highWord = -1;
+	return HASH_FAIL;
+}
+
+/**
+ * @fn static void JBucketBitmapWiden(JBucketBitmapPtr bitmap, int wordIndex)
+ * @brief (여러 스레드가 함께 갱신하는 bitmap) 검사 범위에 word 위치가 포함되도록 원자적으로 넓히는 함수
+ * @param bitmap bitmap 구조체 객체의 주소(출력)
+ * @param wordIndex 포함할 word 위치(입력)
+ * @return 반환값 없음
+ */
+static void JBucketBitmapWiden(JBucketBitmapPtr bitmap, int wordIndex)
+{
+	int lowWord = __atomic_load_n(&(bitmap->lowWord), __ATOMIC_RELAXED);
+	while((wordIndex < lowWord)
+		&& (__atomic_compare_exchange_n(&(bitmap->lowWord), &lowWord, wordIndex, 1, __ATOMIC_RELAXED, __ATOMIC_RELAXED) == 0));
+
+	int highWord = __atomic_load_n(&(bitmap->highWord), __ATOMIC_RELAXED);
+	while((wordIndex > highWord)
+		&& (__atomic_compare_exchange_n(&(bitmap->highWord), &highWord, wordIndex, 1, __ATOMIC_RELAXED, __ATOMIC_RELAXED) == 0));
+}
+
+/**
+ * @fn static int JBucketBitmapFindShared(const JBucketBitmapPtr bitmap, int fromFirst)
+ * @brief (여러 스레드가 함께 갱신하는 bitmap) 데이터가 있는 첫 번째 또는 마지막 버킷 위치를 찾는 함수
+ * 다른 스레드가 bit 를 설정하는 중일 수 있으므로 검사 범위는 줄이지 않는다.
+ * 찾은 버킷은 잠금을 잡은 후 다시 확인해야 한다.
+ * @param bitmap bitmap 구조체 객체의 주소(입력)
+ * @param fromFirst 1 이면 첫 번째, 0 이면 마지막 버킷 위치 검색(입력)
+ * @return 성공 시 버킷 위치, 실패 시 HASH_FAIL 반환
+ */
+static int JBucketBitmapFindShared(const JBucketBitmapPtr bitmap, int fromFirst)
+{
+	int lowWord = __atomic_load_n(&(bitmap->lowWord), __ATOMIC_RELAXED);
+	int highWord = __atomic_load_n(&(bitmap->highWord), __ATOMIC_RELAXED);
+	int wordIndex = (fromFirst != 0) ? lowWord : highWord;
+	uint64_t word = 0;
+
+	for( ; (wordIndex >= lowWord) && (wordIndex <= highWord); wordIndex += (fromFirst != 0) ? 1 : -1)
+	{
+		word = __atomic_load_n(&(bitmap->words[wordIndex]), __ATOMIC_ACQUIRE);
+		if(word == 0) continue;
+		if(fromFirst != 0) return (wordIndex << 6) + __builtin_ctzll(word);
+		return (wordIndex << 6) + 63 - __builtin_clzll(word);
+	}
+
+	return HASH_FAIL;
+}
+
+/**
+ * @fn static void JBucketBitmapClear(JBucketBitmapPtr bitmap)
+ * @brief 모든 버킷이 비어 있는 상태로 bitmap 을 되돌리는 함수
+ * 0 이 아닐 수 있는 word 범위(lowWord ~ highWord)만 지운다.
+ * @param bitmap bitmap 구조체 객체의 주소(출력)
+ * @return 반환값 없음
+ */
+static void JBucketBitmapClear(JBucketBitmapPtr bitmap)
+{
+	if(bitmap->highWord >= bitmap->lowWord)
+	{
+		memset(bitmap->words + bitmap->lowWord, 0, sizeof(uint64_t) * (size_t)(bitmap->highWord - bitmap->lowWord + 1));
+	}
+	bitmap->lowWord = bitmap->wordCount;
+	bitmap->highWord = -1;
+}
+
+/**
+ * @fn static int JBucketBitmapFindNext(const JBucketBitmapPtr bitmap, int fromIndex)
+ * @brief 지정한 위치부터 데이터가 있는 첫 번째 버킷 위치를 찾는 함수
+ * 순회 커서가 사용하며, 위치 범위를 줄이지 않으므로 bitmap 을 변경하지 않는다.
+ * @param bitmap bitmap 구조체 객체의 주소(입력, 읽기 전용)
+ * @param fromIndex 검사를 시작할 버킷 위치(입력)
+ * @return 성공 시 버킷 위치, 실패 시 HASH_FAIL 반환
+ */
+static int JBucketBitmapFindNext(const JBucketBitmapPtr bitmap, int fromIndex)
+{
+	int lowWord = __atomic_load_n(&(bitmap->lowWord), __ATOMIC_RELAXED);
+	int highWord = __atomic_load_n(&(bitmap->highWord), __ATOMIC_RELAXED);
+	int wordIndex = fromIndex >> 6;
+	uint64_t word = 0;
+
+	if(wordIndex < lowWord)
+	{
+		wordIndex = lowWord;
+		fromIndex = lowWord << 6;
+	}
+	if(wordIndex > highWord) return HASH_FAIL;
+
+	word = __atomic_load_n(&(bitmap->words[wordIndex]), __ATOMIC_ACQUIRE) & (~0ULL << (fromIndex & 63));
+	while(word == 0)
+	{
+		if(++wordIndex > highWord) return HASH_FAIL;
+		word = __atomic_load_n(&(bitmap->words[wordIndex]), __ATOMIC_ACQUIRE);
+	}
+
+	return (wordIndex << 6) + __builtin_ctzll(word);
+}
+
+/**
+ * @fn static void JHashTableStartRehash(JHashTablePtr table)
+ * @brief 2 배 크기의 새로운 Slot 배열을 할당하고 점진적 재해싱을 시작하는 함수
+ * 연결 리스트는 데이터가 옮겨질 때 생성하므로 Slot 배열 할당 외의 비용은 이후 연산들로 나누어진다.
+ * 할당에 실패하면 재해싱을 시작하지 않는다.
+ * 동시 접근 모드에서는 재해싱 잠금(쓰기)을 잡은 상태에서 호출한다.
+ * @param table 해쉬 테이블 구조체 객체의 주소(출력)
+ * @return 반환값 없음
+ */
+static void JHashTableStartRehash(JHashTablePtr table)
+{
+	if(table->size > INT_MAX / 2) return;
+
+	int rehashSize = table->size * 2;
+	JLinkedListPtrContainer rehashContainer = (JLinkedListPtrContainer)calloc((size_t)rehashSize, sizeof(JLinkedListPtr));
+	if(rehashContainer == NULL) return;
+	if(JBucketBitmapInit(&(table->rehashOccupied), rehashSize) == HASH_FAIL)
+	{
+		free(rehashContainer);
+		return;
+	}
+
+	// 동시 접근 모드에서는 재해싱 상태를 잠금 없이 확인하므로 새로운 Slot 배열을 마지막에 release 로 저장한다.
+	table->rehashOccupied.isShared = table->occupied.isShared;
+	__atomic_store_n(&(table->rehashSize), rehashSize, __ATOMIC_RELAXED);
+	__atomic_store_n(&(table->rehashIndex), 0, __ATOMIC_RELAXED);
+	__atomic_store_n(&(table->rehashDoneCount), 0, __ATOMIC_RELAXED);
+	__atomic_store_n(&(table->rehashRetry), 0, __ATOMIC_RELAXED);
+	__atomic_store_n(&(table->rehashContainer), rehashContainer, __ATOMIC_RELEASE);
+}
+
+/**
+ * @fn static void JHashTableRehashStep(JHashTablePtr table, int bucketCount)
+ * @brief 재해싱 중이면 기존 Slot 들 중 일부를 새로운 Slot 배열로 옮기는 함수
+ * 데이터가 있는 Slot 을 최대 bucketCount 개, 빈 Slot 은 최대 bucketCount * 10 개까지 처리한다.
+ * 모든 Slot 을 옮기면 기존 Slot 배열을 해제하고 새로운 Slot 배열로 교체한다.
+ * 동시 접근 모드에서는 JHashTableHelpRehash 로 다른 스레드들과 나누어 옮긴다.
+ * @param table 해쉬 테이블 구조체 객체의 주소(출력)
+ * @param bucketCount 옮길 Slot 개수(입력)
+ * @return 반환값 없음
+ */
+static void JHashTableRehashStep(JHashTablePtr table, int bucketCount)
+{
+	if(table->lockStripes != NULL)
+	{
+		if(table->cooperativeResize != 0) JHashTableHelpRehash(table, bucketCount);
+		return;
+	}
+	if(table->rehashContainer == NULL) return;
+
+	int emptyVisits = bucketCount * 10;
+	JLinkedListPtr list = NULL;
+
+	while((bucketCount > 0) && (table->rehashIndex < table->size))
+	{
+		list = table->listContainer[table->rehashIndex];
+		if(JLinkedListGetSize(list) > 0)
+		{
+			if(JHashTableMigrateList(table, table->rehashIndex) == HASH_FAIL) return;
+			bucketCount--;
+		}
+		else
+		{
+			emptyVisits--;
+		}
+
+		if(list != NULL)
+		{
+			JBucketBitmapUpdate(&(table->occupied), list);
+			DeleteJLinkedList(&(table->listContainer[table->rehashIndex]));
+		}
+		table->rehashIndex++;
+		if(emptyVisits <= 0) break;
+	}
+
+	if(table->rehashIndex >= table->size)
+	{
+		free(table->listContainer);
+		JBucketBitmapFree(&(table->occupied));
+		table->listContainer = table->rehashContainer;
+		table->occupied = table->rehashOccupied;
+		memset(&(table->rehashOccupied), 0, sizeof(JBucketBitmap));
+		table->size = table->rehashSize;
+		table->rehashContainer = NULL;
+		table->rehashSize = 0;
+		table->rehashIndex = 0;
+	}
+}
+
+/**
+ * @fn static int JHashTableMigrateList(JHashTablePtr table, int listIndex)
+ * @brief 기존 Slot 하나의 모든 노드를 새로운 Slot 배열로 옮기는 함수
+ * 노드는 새로 할당하지 않고 연결만 바꾸며, 새로운 위치는 노드에 저장된 전체 해쉬값으로 계산한다.
+ * 옮길 Slot 들의 연결 리스트를 먼저 모두 생성하므로, 실패하면 아무 노드도 옮기지 않는다.
+ * 동시 접근 모드에서 옮겨 받는 Slot 들은 기존 Slot 과 같은 잠금이 보호하므로 잠금 하나만 잡은 상태에서 호출한다.
+ * @param table 해쉬 테이블 구조체 객체의 주소(출력)
+ * @param listIndex 옮길 기존 Slot 의 위치(입력)
+ * @return 성공 시 옮긴 노드 개수, 실패 시 HASH_FAIL 반환
+ */
+static int JHashTableMigrateList(JHashTablePtr table, int listIndex)
+{
+	JLinkedListPtr list = table->listContainer[listIndex];
+	JNodePtr node = list->head->next;
+	JNodePtr nextNode = NULL;
+	int newIndex = 0;
+	int movedCount = 0;
+	int lockIndex = JHashTableGetBucketLockIndex(table, listIndex, table->size);
+
+	for( ; node != list->tail; node = node->next)
+	{
+		newIndex = JHashTableGetBucketIndex(table, node->hash, table->rehashSize);
+		if(JHashTableMaterializeList(table, table->rehashContainer, newIndex, lockIndex) == NULL) return HASH_FAIL;
+	}
+
+	node = list->head->next;
+	while(node != list->tail)
+	{
+		nextNode = node->next;
+		newIndex = JHashTableGetBucketIndex(table, node->hash, table->rehashSize);
+		JLinkedListUnlinkNode(list, node);
+		JLinkedListLinkNode(table->rehashContainer[newIndex], node);
+		JBucketBitmapUpdate(&(table->rehashOccupied), table->rehashContainer[newIndex]);
+		movedCount++;
+		node = nextNode;
+	}
+
+	return movedCount;
+}
+
+/**
+ * @fn static void JHashTableDeleteListContainer(const JHashTablePtr table, JLinkedListPtrContainer container, int size)
+ * @brief Slot 배열과 Slot 들의 연결 리스트를 모두 삭제하는 함수
+ * 메모리 풀을 사용하면 연결 리스트와 노드는 메모리 풀과 함께 한 번에 해제되므로 Slot 배열만 해제한다.
+ * @param table 해쉬 테이블 구조체 객체의 주소(입력, 읽기 전용)
+ * @param container 삭제할 Slot 배열의 주소(입력, NULL 허용)
+ * @param size Slot 배열의 크기(입력)
+ * @return 반환값 없음
+ */
+static void JHashTableDeleteListContainer(const JHashTablePtr table, JLinkedListPtrContainer container, int size)
+{
+	if(container == NULL) return;
+
+	int listIndex = 0;
+	int usePool = (table->nodePool != NULL) || ((table->lockStripes != NULL) && (table->lockStripes[0].usePool != 0));
+	for( ; (usePool == 0) && (listIndex < size); listIndex++)
+	{
+		if((container[listIndex] != NULL) && (container[listIndex] != JHT_FORWARD_LIST)) DeleteJLinkedList(&(container[listIndex]));
+	}
+	free(container);
+}
+
+/**
+ * @fn static void JHashTableCheckSharedGrowth(JHashTablePtr table, int stripeCount, int addedCount)
+ * @brief (동시 접근 모드) 데이터를 추가한 후 적재율 기준을 넘었으면 재해싱을 시작하는 함수
+ * 전체 데이터 개수를 구하려면 모든 잠금의 데이터 개수를 읽어야 하므로,
+ * 추가한 잠금의 데이터 개수가 잠금 하나의 평균 몫을 넘을 때만(몫이 크면 16 개마다) 전체 데이터 개수를 확인한다.
+ * @param table 해쉬 테이블 구조체 객체의 주소(출력, 버킷 잠금을 잡지 않은 상태)
+ * @param stripeCount 데이터를 추가한 잠금의 데이터 개수(입력)
+ * @param addedCount 이번에 추가한 데이터 개수(입력, 여러 개를 한 번에 추가했으면 그 사이에 16 의 배수를 지났는지 본다)
+ * @return 반환값 없음
+ */
+static void JHashTableCheckSharedGrowth(JHashTablePtr table, int stripeCount, int addedCount)
+{
+	double limit = table->loadFactor * (double)__atomic_load_n(&(table->size), __ATOMIC_RELAXED);
+	double stripeShare = limit / (double)((table->lockBaseSize < table->lockStripeCount) ? table->lockBaseSize : table->lockStripeCount);
+
+	if((double)stripeCount <= stripeShare) return;
+	if((stripeShare >= 16) && ((stripeCount & 15) >= addedCount)) return;
+	if(__atomic_load_n(&(table->rehashContainer), __ATOMIC_ACQUIRE) != NULL) return;
+	if((double)JHashTableGetCount(table) <= limit) return;
+
+	// 다른 스레드가 재해싱을 시작하거나 마치는 중이면 그 스레드에 맡긴다.
+	if(pthread_rwlock_trywrlock(&(table->resizeLock)) != 0) return;
+	if((table->rehashContainer == NULL) && ((double)JHashTableGetCount(table) > table->loadFactor * (double)table->size))
+	{
+		JHashTableStartRehash(table);
+	}
+	pthread_rwlock_unlock(&(table->resizeLock));
+}
+
+/**
+ * @fn static void JHashTableHelpRehash(JHashTablePtr table, int bucketCount)
+ * @brief (동시 접근 모드) 재해싱 중이면 아직 맡지 않은 기존 Slot 들 중 bucketCount 개를 맡아 새로운 Slot 배열로 옮기는 함수
+ * 맡을 위치는 원자적으로 증가시키므로 여러 스레드가 서로 다른 Slot 들을 동시에 옮긴다.
+ * 모든 Slot 을 맡은 후에는 메모리 할당 실패로 옮기지 못한 Slot 들을 다시 옮긴다.
+ * 모든 Slot 이 옮겨지면 Slot 배열을 교체한다.
+ * @param table 해쉬 테이블 구조체 객체의 주소(출력, 버킷 잠금을 잡지 않은 상태)
+ * @param bucketCount 옮길 Slot 개수(입력)
+ * @return 반환값 없음
+ */
+static void JHashTableHelpRehash(JHashTablePtr table, int bucketCount)
+{
+	if(__atomic_load_n(&(table->rehashContainer), __ATOMIC_ACQUIRE) == NULL) return;
+
+	// 맡을 Slot 이 남아 있을 때만 재해싱 잠금(읽기)을 잡는다. 재해싱을 시작하거나 마치는 중이면 돕지 않는다.
+	if((__atomic_load_n(&(table->rehashIndex), __ATOMIC_RELAXED) * 2 < __atomic_load_n(&(table->rehashSize), __ATOMIC_RELAXED))
+		&& (pthread_rwlock_tryrdlock(&(table->resizeLock)) == 0))
+	{
+		if((table->rehashContainer != NULL) && (__atomic_load_n(&(table->rehashIndex), __ATOMIC_RELAXED) < table->size))
+		{
+			int listIndex = __atomic_fetch_add(&(table->rehashIndex), bucketCount, __ATOMIC_RELAXED);
+			int endIndex = (listIndex > table->size - bucketCount) ? table->size : listIndex + bucketCount;
+			for( ; listIndex < endIndex; listIndex++) JHashTableForwardList(table, listIndex);
+		}
+		pthread_rwlock_unlock(&(table->resizeLock));
+	}
+	// 모든 Slot 을 맡은 후에도 옮기지 못한 Slot 이 남아 있으면 다시 옮긴다.
+	else if((__atomic_load_n(&(table->rehashRetry), __ATOMIC_ACQUIRE) != 0)
+		&& (pthread_rwlock_tryrdlock(&(table->resizeLock)) == 0))
+	{
+		if(table->rehashContainer != NULL) JHashTableRetryForward(table);
+		pthread_rwlock_unlock(&(table->resizeLock));
+	}
+
+	int rehashSize = __atomic_load_n(&(table->rehashSize), __ATOMIC_RELAXED);
+	if((rehashSize > 0) && (__atomic_load_n(&(table->rehashDoneCount), __ATOMIC_ACQUIRE) * 2 == rehashSize))
+	{
+		JHashTableFinishSharedRehash(table);
+	}
+}
+
+/**
+ * @fn static void JHashTableForwardList(JHashTablePtr table, int listIndex)
+ * @brief (동시 접근 모드) 기존 Slot 하나의 모든 노드를 새로운 Slot 배열로 옮기고 전달 표시를 남기는 함수
+ * 기존 Slot 의 잠금을 잡은 상태에서 옮기며, 이후 이 Slot 의 키를 찾는 연산은 전달 표시를 보고 새로운 Slot 배열을 사용한다.
+ * 새로운 연결 리스트를 생성하지 못하면 옮기지 않고 다시 시도 표시를 남기며, 이 Slot 은 다시 옮겨질 때까지 기존 Slot 을 사용한다.
+ * 이미 옮겨진 Slot 이면 아무것도 하지 않는다.
+ * @param table 해쉬 테이블 구조체 객체의 주소(출력, 재해싱 잠금(읽기)을 잡은 상태)
+ * @param listIndex 옮길 기존 Slot 의 위치(입력)
+ * @return 반환값 없음
+ */
+static void JHashTableForwardList(JHashTablePtr table, int listIndex)
+{
+	int lockIndex = JHashTableGetBucketLockIndex(table, listIndex, table->size);
+	JHashTableLockBucket(table, lockIndex, 1);
+
+	JLinkedListPtr list = table->listContainer[listIndex];
+	if(list == JHT_FORWARD_LIST)
+	{
+		JHashTableUnlockBucket(table, lockIndex, 1);
+		return;
+	}
+	if((JLinkedListGetSize(list) > 0) && (JHashTableMigrateList(table, listIndex) == HASH_FAIL))
+	{
+		__atomic_store_n(&(table->rehashRetry), 1, __ATOMIC_RELEASE);
+		JHashTableUnlockBucket(table, lockIndex, 1);
+		return;
+	}
+	if(list != NULL)
+	{
+		JBucketBitmapUpdate(&(table->occupied), list);
+		DeleteJLinkedList(&(table->listContainer[listIndex]));
+	}
+	__atomic_store_n(&(table->listContainer[listIndex]), JHT_FORWARD_LIST, __ATOMIC_RELEASE);
+	__atomic_add_fetch(&(table->rehashDoneCount), 1, __ATOMIC_RELEASE);
+
+	JHashTableUnlockBucket(table, lockIndex, 1);
+}
+
+/**
+ * @fn static void JHashTableRetryForward(JHashTablePtr table)
+ * @brief (동시 접근 모드) 메모리 할당 실패로 옮기지 못한 기존 Slot 들을 다시 옮기는 함수
+ * 다시 시도 표시를 먼저 지운 스레드 하나만 기존 Slot 배열 전체를 검사하며, 다시 실패한 Slot 이 있으면 표시가 다시 남는다.
+ * @param table 해쉬 테이블 구조체 객체의 주소(출력, 재해싱 잠금(읽기)을 잡은 상태)
+ * @return 반환값 없음
+ */
+static void JHashTableRetryForward(JHashTablePtr table)
+{
+	int expected = 1;
+	if(__atomic_compare_exchange_n(&(table->rehashRetry), &expected, 0, 0, __ATOMIC_ACQ_REL, __ATOMIC_RELAXED) == 0) return;
+
+	int listIndex = 0;
+	for( ; listIndex < table->size; listIndex++)
+	{
+		if(__atomic_load_n(&(table->listContainer[listIndex]), __ATOMIC_ACQUIRE) != JHT_FORWARD_LIST)
+		{
+			JHashTableForwardList(table, listIndex);
+		}
+	}
+}
+
+/**
+ * @fn static void JHashTableFinishSharedRehash(JHashTablePtr table)
+ * @brief (동시 접근 모드) 모든 기존 Slot 이 옮겨졌으면 Slot 배열을 새로운 Slot 배열로 교체하는 함수
+ * 데이터는 이미 모두 옮겨졌으므로 배열 주소만 바꾸며, 기존 배열을 읽는 연산이 없도록 모든 버킷 잠금을 차례로 잡은 상태에서 바꾼다.
+ * 다른 스레드가 재해싱 잠금을 잡고 있으면 교체하지 않고 이후 연산에 맡긴다.
+ * 교체 후에도 적재율 기준을 넘으면 다음 재해싱을 바로 시작한다.
+ * @param table 해쉬 테이블 구조체 객체의 주소(출력, 버킷 잠금을 잡지 않은 상태)
+ * @return 반환값 없음
+ */
+static void JHashTableFinishSharedRehash(JHashTablePtr table)
+{
+	if(pthread_rwlock_trywrlock(&(table->resizeLock)) != 0) return;
+	if((table->rehashContainer == NULL) || (__atomic_load_n(&(table->rehashDoneCount), __ATOMIC_ACQUIRE) != table->size))
+	{
+		pthread_rwlock_unlock(&(table->resizeLock));
+		return;
+	}
+
+	int stripeIndex = 0;
+	for( ; stripeIndex < table->lockStripeCount; stripeIndex++)
+	{
+		if(table->lockType == RwLock) pthread_rwlock_wrlock(&(table->lockStripes[stripeIndex].rwlock));
+		else JSpinLockAcquire(&(table->lockStripes[stripeIndex].spinLock));
+	}
+
+	JLinkedListPtrContainer oldContainer = table->listContainer;
+	JBucketBitmap oldOccupied = table->occupied;
+	table->listContainer = table->rehashContainer;
+	table->occupied = table->rehashOccupied;
+	memset(&(table->rehashOccupied), 0, sizeof(JBucketBitmap));
+	__atomic_store_n(&(table->size), table->rehashSize, __ATOMIC_RELAXED);
+	__atomic_store_n(&(table->rehashContainer), NULL, __ATOMIC_RELEASE);
+	__atomic_store_n(&(table->rehashSize), 0, __ATOMIC_RELAXED);
+	__atomic_store_n(&(table->rehashIndex), 0, __ATOMIC_RELAXED);
+	__atomic_store_n(&(table->rehashDoneCount), 0, __ATOMIC_RELAXED);
+	__atomic_store_n(&(table->rehashRetry), 0, __ATOMIC_RELAXED);
+
+	for(stripeIndex = 0; stripeIndex < table->lockStripeCount; stripeIndex++)
+	{
+		if(table->lockType == RwLock) pthread_rwlock_unlock(&(table->lockStripes[stripeIndex].rwlock));
+		else __atomic_store_n(&(table->lockStripes[stripeIndex].spinLock), 0, __ATOMIC_RELEASE);
+	}
+
+	// 재해싱 중에는 다른 스레드가 확장 검사를 건너뛰므로, 그동안 적재율 기준을 넘었으면 바로 다음 재해싱을 시작한다.
+	if((table->loadFactor > 0) && ((double)JHashTableGetCount(table) > table->loadFactor * (double)table->size))
+	{
+		JHashTableStartRehash(table);
+	}
+	pthread_rwlock_unlock(&(table->resizeLock));
+
+	// 기존 Slot 들은 모두 전달 표시이므로 배열만 해제한다.
+	free(oldContainer);
+	JBucketBitmapFree(&oldOccupied);
+}
+
+/**
+ * @fn static int JHashTableInitLockStripes(JHashTablePtr table, LockType lockType, int stripeCount, int useNodePool)
+ * @brief 동시 접근 모드의 버킷 잠금 배열을 생성하는 함수
+ * 잠금 개수는 2 의 거듭제곱으로 올림하며, 잠금마다 데이터 개수와 메모리 풀을 따로 둔다.
+ * 버킷 개수가 설정되어 있어야 한다.
+ * @param table 해쉬 테이블 구조체 객체의 주소(출력)
+ * @param lockType 동시 접근 보호 유형(입력, RwLock 또는 SpinLock)
+ * @param stripeCount 버킷 잠금 개수(입력)
+ * @param useNodePool 잠금별 메모리 풀 사용 여부(입력)
+ * @return 성공 시 버킷 잠금 개수, 실패 시 HASH_FAIL 반환
+ */
+static int JHashTableInitLockStripes(JHashTablePtr table, LockType lockType, int stripeCount, int useNodePool)
+{
+	int lockStripeCount = 1;
+	while(lockStripeCount < stripeCount) lockStripeCount *= 2;
+
+	void *memory = NULL;
+	if(posix_memalign(&memory, JHT_CACHE_LINE_SIZE, sizeof(JLockStripe) * (size_t)lockStripeCount) != 0) return HASH_FAIL;
+	memset(memory, 0, sizeof(JLockStripe) * (size_t)lockStripeCount);
+
+	JLockStripePtr lockStripes = (JLockStripePtr)memory;
+	int stripeIndex = 0;
+	for( ; stripeIndex < lockStripeCount; stripeIndex++)
+	{
+		if((lockType == RwLock) && (pthread_rwlock_init(&(lockStripes[stripeIndex].rwlock), NULL) != 0))
+		{
+			while(--stripeIndex >= 0) pthread_rwlock_destroy(&(lockStripes[stripeIndex].rwlock));
+			free(memory);
+			return HASH_FAIL;
+		}
+		lockStripes[stripeIndex].usePool = (useNodePool != 0) ? 1 : 0;
+		JPoolInit(&(lockStripes[stripeIndex].pool.nodes), sizeof(JNode));
+		JPoolInit(&(lockStripes[stripeIndex].pool.lists), sizeof(JLinkedList));
+	}
+
+	// 버킷이 충분하면 연속된 버킷들(최대 bitmap word 하나)을 같은 잠금으로 보호해서
+	// 이웃한 키들의 노드가 같은 메모리 풀에 모이도록 한다.
+	int lockStripeShift = 0;
+	while((lockStripeShift < 6) && (((int64_t)lockStripeCount << (lockStripeShift + 1)) <= (int64_t)table->size)) lockStripeShift++;
+
+	table->lockType = lockType;
+	table->lockStripes = lockStripes;
+	table->lockStripeCount = lockStripeCount;
+	table->lockStripeShift = lockStripeShift;
+	return lockStripeCount;
+}
+
+/**
+ * @fn static void JHashTableFreeLockStripes(JHashTablePtr table)
+ * @brief 버킷 잠금 배열과 잠금별 메모리 풀을 해제하는 함수
+ * @param table 해쉬 테이블 구조체 객체의 주소(출력)
+ * @return 반환값 없음
+ */
+static void JHashTableFreeLockStripes(JHashTablePtr table)
+{
+	if(table->lockStripes == NULL) return;
+
+	int stripeIndex = 0;
+	int retiredIndex = 0;
+	for( ; stripeIndex < table->lockStripeCount; stripeIndex++)
+	{
+		if(table->lockType == RwLock) pthread_rwlock_destroy(&(table->lockStripes[stripeIndex].rwlock));
+		for(retiredIndex = 0; retiredIndex < 3; retiredIndex++)
+		{
+			JHashTableReclaimNodes(&(table->lockStripes[stripeIndex].retired),
+				(table->lockStripes[stripeIndex].usePool != 0) ? &(table->lockStripes[stripeIndex].pool) : NULL, retiredIndex);
+		}
+		JPoolDestroy(&(table->lockStripes[stripeIndex].pool.nodes));
+		JPoolDestroy(&(table->lockStripes[stripeIndex].pool.lists));
+	}
+
+	free(table->lockStripes);
+	table->lockStripes = NULL;
+	table->lockStripeCount = 0;
+}
+
+/**
+ * @fn static int JHashTableGetLockIndex(const JHashTablePtr table, uint64_t hash)
+ * @brief 키를 보호하는 잠금 위치를 반환하는 함수
+ * 생성 시 버킷 개수 기준의 버킷 위치를 사용하므로, 재해싱 전후 어느 Slot 배열에 저장되어 있어도 같은 잠금이 보호한다.
+ * @param table 해쉬 테이블 구조체 객체의 주소(입력, 읽기 전용)
+ * @param hash 키의 전체 해쉬값(입력)
+ * @return 항상 잠금 위치 반환(동시 접근 모드가 아니면 0)
+ */
+static int JHashTableGetLockIndex(const JHashTablePtr table, uint64_t hash)
+{
+	if(table->lockStripes == NULL) return 0;
+	return JHashTableGetBucketIndex(table, hash, table->lockBaseSize);
+}
+
+/**
+ * @fn static int JHashTableGetBucketLockIndex(const JHashTablePtr table, int listIndex, int size)
+ * @brief Slot 배열의 Slot 을 보호하는 잠금 위치를 반환하는 함수
+ * 2 배씩 확장하므로 나머지 연산이면 기준 버킷 개수로 나눈 나머지, 2 의 거듭제곱 버킷이면 상위 bit 가 기준 버킷 위치가 된다.
+ * @param table 해쉬 테이블 구조체 객체의 주소(입력, 읽기 전용)
+ * @param listIndex Slot 위치(입력)
+ * @param size Slot 이 속한 Slot 배열의 크기(입력)
+ * @return 항상 잠금 위치 반환(동시 접근 모드가 아니면 0)
+ */
+static int JHashTableGetBucketLockIndex(const JHashTablePtr table, int listIndex, int size)
+{
+	if(table->lockStripes == NULL) return 0;
+	if(size == table->lockBaseSize) return listIndex;
+	if(table->powerOfTwoBuckets != 0) return listIndex >> (__builtin_ctz((unsigned int)size) - __builtin_ctz((unsigned int)table->lockBaseSize));
+	return listIndex % table->lockBaseSize;
+}
+
+/**
+ * @fn static JLockStripePtr JHashTableGetLockStripe(const JHashTablePtr table, int lockIndex)
+ * @brief 버킷을 보호하는 잠금을 반환하는 함수
+ * 연속된 2^lockStripeShift 개의 버킷 묶음을 잠금 개수로 나눈 나머지 위치의 잠금이 보호한다.
+ * @param table 해쉬 테이블 구조체 객체의 주소(입력, 읽기 전용, 동시 접근 모드)
+ * @param lockIndex 잠금 위치(입력, 생성 시 버킷 개수 기준의 버킷 위치)
+ * @return 항상 잠금 구조체 객체의 주소 반환
+ */
+static JLockStripePtr JHashTableGetLockStripe(const JHashTablePtr table, int lockIndex)
+{
+	return &(table->lockStripes[(lockIndex >> table->lockStripeShift) & (table->lockStripeCount - 1)]);
+}
+
+/**
+ * @fn static int JHashTableLockBucket(const JHashTablePtr table, int lockIndex, int isWrite)
+ * @brief 버킷을 보호하는 잠금을 잡는 함수(동시 접근 모드가 아니면 아무것도 하지 않음)
+ * 잠금 없는 검색을 사용하면 읽기 잠금 대신 검색 구간을 시작한다.
+ * @param table 해쉬 테이블 구조체 객체의 주소(입력, 읽기 전용)
+ * @param lockIndex 잠금 위치(입력)
+ * @param isWrite 1 이면 쓰기 잠금, 0 이면 읽기 잠금(SpinLock 은 구분하지 않음)(입력)
+ * @return 잡은 잠금 유형(isWrite 값, 검색 구간을 시작했으면 JHT_LOCK_EPOCH) 반환, JHashTableUnlockBucket 에 그대로 전달한다.
+ */
+static int JHashTableLockBucket(const JHashTablePtr table, int lockIndex, int isWrite)
+{
+	if(table->lockStripes == NULL) return isWrite;
+	// 잠금 없는 검색은 잠금 대신 검색 시작 epoch 를 게시한다(검색 상태를 만들 수 없으면 잠금 사용).
+	if((isWrite == 0) && (table->lockFreeRead != 0) && (JHashTableEnterEpoch(table) != HASH_FAIL)) return JHT_LOCK_EPOCH;
+
+	JLockStripePtr lockStripe = JHashTableGetLockStripe(table, lockIndex);
+	if(table->lockType == RwLock)
+	{
+		if(isWrite != 0) pthread_rwlock_wrlock(&(lockStripe->rwlock));
+		else pthread_rwlock_rdlock(&(lockStripe->rwlock));
+		return isWrite;
+	}
+
+	JSpinLockAcquire(&(lockStripe->spinLock));
+	return isWrite;
+}
+
+/**
+ * @fn static void JHashTableUnlockBucket(const JHashTablePtr table, int lockIndex, int lockMode)
+ * @brief 버킷을 보호하는 잠금을 푸는 함수(동시 접근 모드가 아니면 아무것도 하지 않음)
+ * @param table 해쉬 테이블 구조체 객체의 주소(입력, 읽기 전용)
+ * @param lockIndex 잠금 위치(입력)
+ * @param lockMode 잠금을 잡을 때 JHashTableLockBucket 이 반환한 값(입력, 쓰기 잠금이면 1)
+ * @return 반환값 없음
+ */
+static void JHashTableUnlockBucket(const JHashTablePtr table, int lockIndex, int lockMode)
+{
+	if(table->lockStripes == NULL) return;
+	if(lockMode == JHT_LOCK_EPOCH)
+	{
+		JHashTableExitEpoch(table);
+		return;
+	}
+
+	JLockStripePtr lockStripe = JHashTableGetLockStripe(table, lockIndex);
+	if(table->lockType == RwLock) pthread_rwlock_unlock(&(lockStripe->rwlock));
+	else __atomic_store_n(&(lockStripe->spinLock), 0, __ATOMIC_RELEASE);
+}
+
+/**
+ * @fn static int JHashTableLockEndList(const JHashTablePtr table, int fromFirst, int isWrite, JLinkedListPtr *list, JBucketBitmapPtr *bitmap, int *lockMode)
+ * @brief 데이터가 저장된 첫 번째 또는 마지막 연결 리스트를 찾아 그 버킷의 잠금을 잡는 함수
+ * 동시 접근 모드에서는 잠금을 잡는 사이 다른 스레드가 버킷을 비울 수 있으므로, 잠금을 잡은 후 다시 확인하고 비어 있으면 다시 찾는다.
+ * 재해싱 중이면 첫 번째는 기존 Slot 들부터, 마지막은 새로운 Slot 들부터 찾으며, 찾는 동안 재해싱 잠금(읽기)을 잡아 Slot 배열이 교체되지 않도록 한다.
+ * @param table 해쉬 테이블 구조체 객체의 주소(입력, 읽기 전용)
+ * @param fromFirst 1 이면 첫 번째, 0 이면 마지막 연결 리스트 검색(입력)
+ * @param isWrite 1 이면 쓰기 잠금, 0 이면 읽기 잠금(입력)
+ * @param list 찾은 연결 리스트(출력)
+ * @param bitmap 찾은 연결 리스트가 속한 Slot 배열의 bitmap(출력, NULL 허용)
+ * @param lockMode 잡은 잠금 유형(출력, JHashTableUnlockBucket 에 전달)
+ * @return 성공 시 잠금을 잡은 잠금 위치(동시 접근 모드가 아니면 버킷 위치), 실패 시 HASH_FAIL 반환
+ */
+static int JHashTableLockEndList(const JHashTablePtr table, int fromFirst, int isWrite, JLinkedListPtr *list, JBucketBitmapPtr *bitmap, int *lockMode)
+{
+	*lockMode = isWrite;
+	if(table->lockStripes == NULL)
+	{
+		*list = (fromFirst != 0) ? JHashTableGetFirstList(table, bitmap) : JHashTableGetLastList(table, bitmap);
+		return (JLinkedListGetSize(*list) > 0) ? (*list)->hash : HASH_FAIL;
+	}
+
+	if(table->cooperativeResize != 0) pthread_rwlock_rdlock(&(table->resizeLock));
+
+	int lockIndex = HASH_FAIL;
+	int listIndex = 0;
+	int phase = 0;
+	int isRehash = 0;
+	JLinkedListPtrContainer container = NULL;
+	JBucketBitmapPtr containerBitmap = NULL;
+
+	for( ; (lockIndex < 0) && (phase < 2); phase++)
+	{
+		isRehash = (phase == 0) ? (fromFirst == 0) : (fromFirst != 0);
+		container = (isRehash != 0) ? table->rehashContainer : table->listContainer;
+		if(container == NULL) continue;
+		containerBitmap = (isRehash != 0) ? &(table->rehashOccupied) : &(table->occupied);
+
+		while((listIndex = JBucketBitmapFindShared(containerBitmap, fromFirst)) >= 0)
+		{
+			lockIndex = JHashTableGetBucketLockIndex(table, listIndex, (isRehash != 0) ? table->rehashSize : table->size);
+			*lockMode = JHashTableLockBucket(table, lockIndex, isWrite);
+			*list = __atomic_load_n(&(container[listIndex]), __ATOMIC_ACQUIRE);
+			if((*list != NULL) && (*list != JHT_FORWARD_LIST) && (__atomic_load_n(&((*list)->head->next), __ATOMIC_ACQUIRE) != (*list)->tail))
+			{
+				if(bitmap != NULL) *bitmap = containerBitmap;
+				break;
+			}
+			JHashTableUnlockBucket(table, lockIndex, *lockMode);
+			lockIndex = HASH_FAIL;
+		}
+	}
+
+	// 버킷 잠금을 잡은 동안에는 Slot 배열이 교체되지 않는다.
+	if(table->cooperativeResize != 0) pthread_rwlock_unlock(&(table->resizeLock));
+	return lockIndex;
+}
+
+/**
+ * @fn static int JHashTableAddCount(JHashTablePtr table, int lockIndex, int delta)
+ * @brief 저장된 데이터 개수를 변경하는 함수
+ * 동시 접근 모드에서는 여러 스레드가 같은 캐시 라인을 갱신하지 않도록 버킷 잠금별 데이터 개수를 변경한다.
+ * @param table 해쉬 테이블 구조체 객체의 주소(출력)
+ * @param lockIndex 변경된 버킷의 잠금 위치(입력, 해당 잠금의 쓰기 잠금을 잡은 상태)
+ * @param delta 변경할 개수(입력)
+ * @return 변경된 데이터 개수(동시 접근 모드에서는 잠금별 데이터 개수) 반환
+ */
+static int JHashTableAddCount(JHashTablePtr table, int lockIndex, int delta)
+{
+	if(table->lockStripes == NULL)
+	{
+		table->count += delta;
+		return table->count;
+	}
+
+	// 잠금 안에서만 변경하고, JHashTableGetCount 는 잠금 없이 읽는다.
+	int *count = &(JHashTableGetLockStripe(table, lockIndex)->count);
+	int newCount = __atomic_load_n(count, __ATOMIC_RELAXED) + delta;
+	__atomic_store_n(count, newCount, __ATOMIC_RELAXED);
+	return newCount;
+}
+
+/**
+ * @fn static JNodePoolPtr JHashTableGetNodePool(const JHashTablePtr table, int lockIndex)
+ * @brief 버킷의 연결 리스트와 노드를 할당할 메모리 풀을 반환하는 함수
+ * 동시 접근 모드에서는 버킷을 보호하는 잠금의 메모리 풀을 사용하므로 메모리 풀에 별도의 잠금이 필요 없다.
+ * @param table 해쉬 테이블 구조체 객체의 주소(입력, 읽기 전용)
+ * @param lockIndex 버킷의 잠금 위치(입력)
+ * @return 메모리 풀 구조체 객체의 주소, 메모리 풀을 사용하지 않으면 NULL 반환
+ */
+static JNodePoolPtr JHashTableGetNodePool(const JHashTablePtr table, int lockIndex)
+{
+	if(table->lockStripes == NULL) return table->nodePool;
+
+	JLockStripePtr lockStripe = JHashTableGetLockStripe(table, lockIndex);
+	return (lockStripe->usePool != 0) ? &(lockStripe->pool) : NULL;
+}
+
+/**
+ * @fn static void JHashTableRemoveNode(JHashTablePtr table, int lockIndex, JLinkedListPtr list, JNodePtr node)
+ * @brief 버킷의 연결 리스트에서 노드를 분리하고 해제하는 함수
+ * 잠금 없는 검색을 사용하면 검색 중인 스레드가 노드를 읽고 있을 수 있으므로 바로 해제하지 않고 삭제 대기 목록에 넣는다.
+ * @param table 해쉬 테이블 구조체 객체의 주소(출력)
+ * @param lockIndex 버킷의 잠금 위치(입력, 동시 접근 모드면 해당 잠금의 쓰기 잠금을 잡은 상태)
+ * @param list 버킷의 연결 리스트 구조체 객체의 주소(출력)
+ * @param node 삭제할 노드의 주소(입력)
+ * @return 반환값 없음
+ */
+static void JHashTableRemoveNode(JHashTablePtr table, int lockIndex, JLinkedListPtr list, JNodePtr node)
+{
+	JLinkedListUnlinkNode(list, node);
+	if(table->lockFreeRead != 0) JHashTableRetireNode(table, lockIndex, node);
+	else JLinkedListFreeNode(list, node);
+}
+
+/**
+ * @fn static JEpochRecordPtr JHashTableGetEpochRecord(const JHashTablePtr table, int create)
+ * @brief 호출한 스레드의 검색 상태를 반환하는 함수
+ * 스레드별 캐시에서 먼저 찾고, 없으면 테이블에 등록된 목록에서 찾는다.
+ * 목록에도 없으면 반환된 검색 상태를 재사용하거나 새로 생성해서 목록 앞에 추가한다.
+ * @param table 해쉬 테이블 구조체 객체의 주소(입력, 읽기 전용)
+ * @param create 없으면 생성할지 여부(입력)
+ * @return 성공 시 검색 상태 구조체 객체의 주소, 실패 시 NULL 반환
+ */
+static JEpochRecordPtr JHashTableGetEpochRecord(const JHashTablePtr table, int create)
+{
+	int cacheIndex = 0;
+	for( ; cacheIndex < JHT_EPOCH_CACHE_SIZE; cacheIndex++)
+	{
+		if(jhtEpochCache[cacheIndex].domainId == table->epochDomainId) return jhtEpochCache[cacheIndex].record;
+	}
+
+	pthread_t self = pthread_self();
+	pthread_t owner;
+	JEpochRecordPtr firstRecord = __atomic_load_n(&(table->epochRecords), __ATOMIC_ACQUIRE);
+	JEpochRecordPtr record = firstRecord;
+	for( ; record != NULL; record = record->next)
+	{
+		if(__atomic_load_n(&(record->isUsed), __ATOMIC_ACQUIRE) != 1) continue;
+		__atomic_load(&(record->owner), &owner, __ATOMIC_RELAXED);
+		if(pthread_equal(owner, self) != 0) break;
+	}
+	if(record == NULL)
+	{
+		if(create == 0) return NULL;
+
+		// 반환된 검색 상태가 있으면 가져가는 중(2)으로 표시하고 소유 스레드를 기록한 후 사용 중(1)으로 게시한다.
+		int isUsed = 0;
+		for(record = firstRecord; record != NULL; record = record->next)
+		{
+			isUsed = 0;
+			if(__atomic_compare_exchange_n(&(record->isUsed), &isUsed, 2, 0, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED) != 0)
+			{
+				__atomic_store(&(record->owner), &self, __ATOMIC_RELAXED);
+				__atomic_store_n(&(record->isUsed), 1, __ATOMIC_RELEASE);
+				break;
+			}
+		}
+	}
+
+	if(record == NULL)
+	{
+		void *memory = NULL;
+		if(posix_memalign(&memory, JHT_CACHE_LINE_SIZE, sizeof(JEpochRecord)) != 0) return NULL;
+		memset(memory, 0, sizeof(JEpochRecord));
+		record = (JEpochRecordPtr)memory;
+		record->owner = self;
+		record->isUsed = 1;
+		record->next = __atomic_load_n(&(table->epochRecords), __ATOMIC_RELAXED);
+		while(__atomic_compare_exchange_n(&(table->epochRecords), &(record->next), record, 1, __ATOMIC_RELEASE, __ATOMIC_RELAXED) == 0);
+	}
+
+	jhtEpochCache[jhtEpochCacheNext].domainId = table->epochDomainId;
+	jhtEpochCache[jhtEpochCacheNext].record = record;
+	jhtEpochCacheNext = (jhtEpochCacheNext + 1) % JHT_EPOCH_CACHE_SIZE;
+	return record;
+}
+
+/**
+ * @fn static int JHashTableEnterEpoch(const JHashTablePtr table)
+ * @brief (잠금 없는 검색) 검색 구간을 시작하는 함수
+ * 현재 전체 epoch 를 스레드의 검색 상태에 게시한 후부터 노드를 읽는다.
+ * 검색 구간은 중첩할 수 있으며(순회 함수 안에서 검색 등), 가장 바깥 구간을 시작할 때만 epoch 를 게시한다.
+ * @param table 해쉬 테이블 구조체 객체의 주소(입력, 읽기 전용)
+ * @return 성공 시 0, 실패 시 HASH_FAIL 반환
+ */
+static int JHashTableEnterEpoch(const JHashTablePtr table)
+{
+	JEpochRecordPtr record = JHashTableGetEpochRecord(table, 1);
+	if(record == NULL) return HASH_FAIL;
+	if(record->depth++ > 0) return 0;
+
+	uint64_t epoch = __atomic_load_n(&(table->globalEpoch), __ATOMIC_SEQ_CST);
+	__atomic_store_n(&(record->localEpoch), epoch, __ATOMIC_SEQ_CST);
+	return 0;
+}
+
+/**
+ * @fn static int JHashTableExitEpoch(const JHashTablePtr table)
+ * @brief (잠금 없는 검색) 검색 구간을 끝내는 함수
+ * 가장 바깥 구간이 끝날 때만 게시한 epoch 를 지운다.
+ * @param table 해쉬 테이블 구조체 객체의 주소(입력, 읽기 전용)
+ * @return 성공 시 0, 검색 구간이 아니면 HASH_FAIL 반환
+ */
+static int JHashTableExitEpoch(const JHashTablePtr table)
+{
+	JEpochRecordPtr record = JHashTableGetEpochRecord(table, 0);
+	if((record == NULL) || (record->depth <= 0)) return HASH_FAIL;
+	if(--(record->depth) > 0) return 0;
+
+	__atomic_store_n(&(record->localEpoch), 0, __ATOMIC_RELEASE);
+	return 0;
+}
+
+/**
+ * @fn static void JHashTableTryAdvanceEpoch(const JHashTablePtr table)
+ * @brief (잠금 없는 검색) 검색 중인 모든 스레드가 현재 epoch 에서 시작했으면 전체 epoch 를 1 증가시키는 함수
+ * 전체 epoch 가 E + 2 가 되면 검색 중인 스레드는 모두 E + 1 이후에 시작했으므로 E 에 삭제 대기한 노드를 해제할 수 있다.
+ * @param table 해쉬 테이블 구조체 객체의 주소(입력, 읽기 전용)
+ * @return 반환값 없음
+ */
+static void JHashTableTryAdvanceEpoch(const JHashTablePtr table)
+{
+	uint64_t epoch = __atomic_load_n(&(table->globalEpoch), __ATOMIC_SEQ_CST);
+	uint64_t localEpoch = 0;
+	JEpochRecordPtr record = __atomic_load_n(&(table->epochRecords), __ATOMIC_ACQUIRE);
+
+	for( ; record != NULL; record = record->next)
+	{
+		localEpoch = __atomic_load_n(&(record->localEpoch), __ATOMIC_SEQ_CST);
+		if((localEpoch != 0) && (localEpoch != epoch)) return;
+	}
+	__atomic_compare_exchange_n(&(table->globalEpoch), &epoch, epoch + 1, 0, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST);
+}
+
+/**
+ * @fn static void JHashTableRetireNode(JHashTablePtr table, int listIndex, JNodePtr node)
+ * @brief (잠금 없는 검색) 분리된 노드를 삭제 대기 목록에 넣는 함수
+ * 버킷 잠금을 사용하면 버킷 잠금의 목록에, 잠금 없는 버킷이면 호출한 스레드의 검색 상태의 목록에 넣는다.
+ * 삭제 대기 목록은 삭제 시점 epoch % 3 위치별로 관리하며, 같은 위치의 이전 목록(3 epoch 이상 지난 목록)은 먼저 해제한다.
+ * 삭제 대기 노드가 JHT_RECLAIM_THRESHOLD 개 이상이면 epoch 진행을 시도하고 해제 가능한 목록을 해제한다.
+ * @param table 해쉬 테이블 구조체 객체의 주소(출력)
+ * @param listIndex 버킷 위치(입력, 버킷 잠금을 사용하면 잠금 위치이며 해당 잠금의 쓰기 잠금을 잡은 상태)
+ * @param node 분리된 노드의 주소(입력)
+ * @return 반환값 없음
+ */
+static void JHashTableRetireNode(JHashTablePtr table, int listIndex, JNodePtr node)
+{
+	JRetireListPtr retired = NULL;
+	JNodePoolPtr pool = NULL;
+	if(table->lockStripes != NULL)
+	{
+		JLockStripePtr lockStripe = JHashTableGetLockStripe(table, listIndex);
+		retired = &(lockStripe->retired);
+		if(lockStripe->usePool != 0) pool = &(lockStripe->pool);
+	}
+	else
+	{
+		// 잠금 없는 버킷의 연산은 검색 상태를 얻은 후(epoch 구간 안에서) 노드를 분리한다.
+		retired = &(JHashTableGetEpochRecord(table, 0)->retired);
+	}
+
+	// 노드 분리가 epoch 를 읽기 전에 다른 스레드에 보이도록 읽기 대신 원자적 연산(전체 메모리 장벽)으로 읽는다.
+	uint64_t epoch = __atomic_fetch_add(&(table->globalEpoch), 0, __ATOMIC_SEQ_CST);
+	int retiredIndex = (int)(epoch % 3);
+
+	if(retired->epochs[retiredIndex] != epoch)
+	{
+		JHashTableReclaimNodes(retired, pool, retiredIndex);
+		retired->epochs[retiredIndex] = epoch;
+	}
+	// 잠금 없이 검색 중인 스레드가 세대 번호를 읽을 수 있으므로 원자적으로 바꾼다.
+	__atomic_store_n(&(node->generation), node->generation + 1, __ATOMIC_RELAXED);
+	node->prev = retired->nodes[retiredIndex];
+	retired->nodes[retiredIndex] = node;
+	retired->count++;
+
+	if(retired->count < JHT_RECLAIM_THRESHOLD) return;
+
+	JHashTableTryAdvanceEpoch(table);
+	epoch = __atomic_load_n(&(table->globalEpoch), __ATOMIC_SEQ_CST);
+	for(retiredIndex = 0; retiredIndex < 3; retiredIndex++)
+	{
+		if(retired->epochs[retiredIndex] + 2 <= epoch) JHashTableReclaimNodes(retired, pool, retiredIndex);
+	}
+}
+
+/**
+ * @fn static void JHashTableReclaimNodes(JRetireListPtr retired, JNodePoolPtr pool, int retiredIndex)
+ * @brief (잠금 없는 검색) 삭제 대기 목록 하나의 노드들을 모두 해제하는 함수
+ * @param retired 삭제 대기 노드 목록 구조체 객체의 주소(출력, 잠금을 잡은 상태, 소유한 스레드 또는 테이블 삭제 중)
+ * @param pool 노드를 반환할 메모리 풀(입력, NULL 이면 free 사용)
+ * @param retiredIndex 삭제 대기 목록 위치(입력)
+ * @return 반환값 없음
+ */
+static void JHashTableReclaimNodes(JRetireListPtr retired, JNodePoolPtr pool, int retiredIndex)
+{
+	JNodePtr node = retired->nodes[retiredIndex];
+	JNodePtr nextNode = NULL;
+
+	while(node != NULL)
+	{
+		nextNode = node->prev;
+		if(pool != NULL) JPoolRelease(&(pool->nodes), node);
+		else free(node);
+		retired->count--;
+		node = nextNode;
+	}
+	retired->nodes[retiredIndex] = NULL;
+}
+
+/**
+ * @fn static void JPoolInit(JPoolPtr pool, size_t objectSize)
+ * @brief 메모리 풀을 초기화하는 함수(슬랩은 처음 할당할 때 생성)
+ * @param pool 메모리 풀 구조체 객체의 주소(출력)
+ * @param objectSize 객체 하나의 크기(입력)
+ * @return 반환값 없음
+ */
+static void JPoolInit(JPoolPtr pool, size_t objectSize)
+{
+	memset(pool, 0, sizeof(JPool));
+	if(objectSize < sizeof(void*)) objectSize = sizeof(void*);
+	pool->objectSize = (objectSize + sizeof(void*) - 1) & ~(sizeof(void*) - 1);
+	pool->nextSlabObjects = JHT_POOL_MIN_SLAB_OBJECTS;
+}
+
+/**
+ * @fn static void* JPoolAlloc(JPoolPtr pool)
+ * @brief 메모리 풀에서 객체 하나를 할당하는 함수
+ * 반환된 객체를 먼저 재사용하고, 없으면 가장 최근 슬랩에서 잘라낸다.
+ * 슬랩이 모두 사용되면 이전 슬랩의 2 배 크기(최대 JHT_POOL_MAX_SLAB_OBJECTS 개)로 새 슬랩을 할당한다.
+ * @param pool 메모리 풀 구조체 객체의 주소(출력)
+ * @return 성공 시 할당한 객체의 주소, 실패 시 NULL 반환
+ */
+static void* JPoolAlloc(JPoolPtr pool)
+{
+	void *object = pool->freeList;
+	if(object != NULL)
+	{
+		pool->freeList = *((void**)object);
+		pool->usedObjects++;
+		return object;
+	}
+
+	if((pool->remaining == 0) && (JPoolAddSlab(pool, pool->nextSlabObjects) == HASH_FAIL)) return NULL;
+
+	object = pool->cursor;
+	pool->cursor += pool->objectSize;
+	pool->remaining--;
+	pool->usedObjects++;
+	return object;
+}
+
+/**
+ * @fn static int JPoolAddSlab(JPoolPtr pool, int objectCount)
+ * @brief 메모리 풀에 새 슬랩을 할당하고 가장 최근 슬랩으로 사용하는 함수
+ * 이전 슬랩에 남은 객체는 호출하는 함수에서 처리한다.
+ * @param pool 메모리 풀 구조체 객체의 주소(출력)
+ * @param objectCount 슬랩의 객체 개수(입력)
+ * @return 성공 시 슬랩의 객체 개수, 실패 시 HASH_FAIL 반환
+ */
+static int JPoolAddSlab(JPoolPtr pool, int objectCount)
+{
+	// 슬랩 앞부분에 다음 슬랩 주소를 저장하고, 객체 정렬을 위해 한 객체 크기만큼 비워둔다.
+	// 노드의 세대 번호가 0 부터 시작하도록 슬랩을 0 으로 초기화한다.
+	size_t headerSize = (sizeof(void*) > pool->objectSize) ? sizeof(void*) : pool->objectSize;
+	void *slab = calloc(1, headerSize + pool->objectSize * (size_t)objectCount);
+	if(slab == NULL) return HASH_FAIL;
+
+	*((void**)slab) = pool->slabs;
+	pool->slabs = slab;
+	pool->cursor = (char*)slab + headerSize;
+	pool->remaining = objectCount;
+	pool->slabCount++;
+	if(pool->nextSlabObjects < JHT_POOL_MAX_SLAB_OBJECTS) pool->nextSlabObjects *= 2;
+	return objectCount;
+}
+
+/**
+ * @fn static void JPoolReserve(JPoolPtr pool, int objectCount)
+ * @brief 객체 objectCount 개를 더 할당해도 새 슬랩이 필요 없도록 미리 한 번에 할당하는 함수
+ * 반환된 객체가 있으면 먼저 재사용하도록 아무것도 하지 않는다.
+ * 가장 최근 슬랩에 남은 객체가 부족하면 남은 객체들을 반환 목록으로 옮기고, 요청한 개수를 모두 담는 슬랩 하나를 할당한다.
+ * 할당에 실패하면 JPoolAlloc 이 평소처럼 슬랩을 할당한다.
+ * @param pool 메모리 풀 구조체 객체의 주소(출력)
+ * @param objectCount 할당할 객체 개수(입력)
+ * @return 반환값 없음
+ */
+static void JPoolReserve(JPoolPtr pool, int objectCount)
+{
+	if((pool->freeList != NULL) || (pool->remaining >= objectCount)) return;
+
+	char *cursor = pool->cursor;
+	int remaining = pool->remaining;
+	if(JPoolAddSlab(pool, (objectCount > pool->nextSlabObjects) ? objectCount : pool->nextSlabObjects) == HASH_FAIL) return;
+
+	for( ; remaining > 0; remaining--)
+	{
+		*((void**)cursor) = pool->freeList;
+		pool->freeList = cursor;
+		cursor += pool->objectSize;
+	}
+}
+
+/**
+ * @fn static void JPoolRelease(JPoolPtr pool, void *object)
+ * @brief 메모리 풀에서 할당한 객체를 반환하는 함수(메모리는 슬랩과 함께 해제)
+ * @param pool 메모리 풀 구조체 객체의 주소(출력)
+ * @param object 반환할 객체의 주소(입력)
+ * @return 반환값 없음
+ */
+static void JPoolRelease(JPoolPtr pool, void *object)
+{
+	*((void**)object) = pool->freeList;
+	pool->freeList = object;
+	pool->usedObjects--;
+}
+
+/**
+ * @fn static void JPoolDestroy(JPoolPtr pool)
+ * @brief 메모리 풀의 모든 슬랩을 해제하는 함수
+ * @param pool 메모리 풀 구조체 객체의 주소(출력)
+ * @return 반환값 없음
+ */
+static void JPoolDestroy(JPoolPtr pool)
+{
+	void *slab = pool->slabs;
+	void *nextSlab = NULL;
+
+	while(slab != NULL)
+	{
+		nextSlab = *((void**)slab);
+		free(slab);
+		slab = nextSlab;
+	}
+	JPoolInit(pool, pool->objectSize);
+}
+
+/**
+ * @fn static JNodePoolPtr NewJNodePool(void)
+ * @brief 노드와 연결 리스트용 메모리 풀 묶음을 생성하는 함수
+ * @return 성공 시 생성된 메모리 풀 묶음 구조체 객체의 주소, 실패 시 NULL 반환
+ */
+static JNodePoolPtr NewJNodePool(void)
+{
+	JNodePoolPtr newPool = (JNodePoolPtr)malloc(sizeof(JNodePool));
+	if(newPool == NULL) return NULL;
+
+	JPoolInit(&(newPool->nodes), sizeof(JNode));
+	JPoolInit(&(newPool->lists), sizeof(JLinkedList));
+	return newPool;
+}
+
+/**
+ * @fn static void DeleteJNodePool(JNodePoolPtr *container)
+ * @brief 메모리 풀 묶음과 모든 슬랩을 해제하는 함수
+ * @param container 메모리 풀 묶음 구조체 객체의 주소를 저장한 이중 포인터(입력)
+ * @return 반환값 없음
+ */
+static void DeleteJNodePool(JNodePoolPtr *container)
+{
+	if(container == NULL || *container == NULL) return;
+
+	JPoolDestroy(&((*container)->nodes));
+	JPoolDestroy(&((*container)->lists));
+	free(*container);
+	*container = NULL;
+}
+
+/**
+ * @fn static void JSpinLockAcquire(int *spinLock)
+ * @brief 스핀 잠금을 잡는 함수
+ * 잠금이 풀릴 때까지 읽기만 반복해서 캐시 라인을 독점하지 않는다.
+ * @param spinLock 스핀 잠금 상태(입력, 출력)
+ * @return 반환값 없음
+ */
+static void JSpinLockAcquire(int *spinLock)
+{
+	while(__atomic_exchange_n(spinLock, 1, __ATOMIC_ACQUIRE) != 0)
+	{
+		while(__atomic_load_n(spinLock, __ATOMIC_RELAXED) != 0) JHT_CPU_RELAX();
+	}
+}
+
+/**
+ * @fn static void JShardedHashTableLockShard(const JShardedHashTablePtr table, JHashShardPtr shard, int isWrite)
+ * @brief 샤드의 잠금을 잡는 함수(샤드 잠금 유형이 NoLock 이면 아무것도 하지 않음)
+ * 바로 잡지 못하면 기다리기 전에 샤드의 잠금 대기 횟수를 증가시킨다.
+ * Chaining 저장소의 검색은 재해싱 중이면 버킷을 옮기므로, 읽기 잠금을 잡은 후 재해싱 중이면 쓰기 잠금으로 다시 잡는다.
+ * @param table 샤드 테이블 구조체 객체의 주소(입력, 읽기 전용)
+ * @param shard 잠글 샤드(입력, 출력)
+ * @param isWrite 1 이면 쓰기 잠금, 0 이면 읽기 잠금(입력)
+ * @return 반환값 없음
+ */
+static void JShardedHashTableLockShard(const JShardedHashTablePtr table, JHashShardPtr shard, int isWrite)
+{
+	if(table->lockType == SpinLock)
+	{
+		if(__atomic_exchange_n(&(shard->spinLock), 1, __ATOMIC_ACQUIRE) == 0) return;
+		__atomic_fetch_add(&(shard->contendedCount), 1, __ATOMIC_RELAXED);
+		JSpinLockAcquire(&(shard->spinLock));
+		return;
+	}
+	if(table->lockType != RwLock) return;
+
+	if(isWrite != 0)
+	{
+		if(pthread_rwlock_trywrlock(&(shard->rwlock)) == 0) return;
+		__atomic_fetch_add(&(shard->contendedCount), 1, __ATOMIC_RELAXED);
+		pthread_rwlock_wrlock(&(shard->rwlock));
+		return;
+	}
+
+	if(pthread_rwlock_tryrdlock(&(shard->rwlock)) != 0)
+	{
+		__atomic_fetch_add(&(shard->contendedCount), 1, __ATOMIC_RELAXED);
+		pthread_rwlock_rdlock(&(shard->rwlock));
+	}
+	if(shard->table->rehashContainer != NULL)
+	{
+		pthread_rwlock_unlock(&(shard->rwlock));
+		pthread_rwlock_wrlock(&(shard->rwlock));
+	}
+}
+
+/**
+ * @fn static void JShardedHashTableUnlockShard(const JShardedHashTablePtr table, JHashShardPtr shard)
+ * @brief 샤드의 잠금을 푸는 함수(샤드 잠금 유형이 NoLock 이면 아무것도 하지 않음)
+ * @param table 샤드 테이블 구조체 객체의 주소(입력, 읽기 전용)
+ * @param shard 잠금을 풀 샤드(입력, 출력)
+ * @return 반환값 없음
+ */
+static void JShardedHashTableUnlockShard(const JShardedHashTablePtr table, JHashShardPtr shard)
+{
+	if(table->lockType == RwLock) pthread_rwlock_unlock(&(shard->rwlock));
+	else if(table->lockType == SpinLock) __atomic_store_n(&(shard->spinLock), 0, __ATOMIC_RELEASE);
+}
+
+/**
+ * @fn static uint64_t JHashTableMix64(uint64_t value)
+ * @brief 64 bit 정수의 모든 bit 가 결과의 모든 bit 에 영향을 주도록 섞는 함수(MurmurHash3 fmix64)
+ * @param value 섞을 값(입력)
+ * @return 항상 섞인 값 반환
+ */
+static uint64_t JHashTableMix64(uint64_t value)
+{
+	value ^= value >> 33;
+	value *= 0xff51afd7ed558ccdULL;
+	value ^= value >> 33;
+	value *= 0xc4ceb9fe1a85ec53ULL;
+	value ^= value >> 33;
+	return value;
+}
+
+/**
+ * @fn static uint64_t JHashTableGetFullHash(const JHashTablePtr table, const void *key)
+ * @brief 해쉬 테이블에 등록된 키 유형별 해싱 함수와 seed 로 키의 전체 해쉬값을 계산하는 함수
+ * Chaining 저장소는 이 값을 버킷 개수로 나눈 나머지를 버킷 위치로 사용하고 노드에 저장한다.
+ * @param table 해쉬 테이블 구조체 객체의 주소(입력, 읽기 전용)
+ * @param key 해싱할 키(입력, 읽기 전용)
+ * @return 항상 해쉬값 반환
+ */
+static uint64_t JHashTableGetFullHash(const JHashTablePtr table, const void *key)
+{
+	switch(table->keyType)
+	{
+		case IntType:
+			return table->intHashFunc(*((const int*)key), table->hashSeed);
+		case CharType:
+			return table->charHashFunc(*((const char*)key), table->hashSeed);
+		case StringType:
+			return table->stringHashFunc((const char*)key, table->hashSeed);
+		default: break;
+	}
+
+	return 0;
+}
+
+/**
+ * @fn static void JHashWyMultiply(uint64_t *a, uint64_t *b)
+ * @brief 두 64 bit 값을 128 bit 로 곱해서 하위 64 bit 는 a 에, 상위 64 bit 는 b 에 저장하는 함수
+ * @param a 첫 번째 값(입력), 곱의 하위 64 bit(출력)
+ * @param b 두 번째 값(입력), 곱의 상위 64 bit(출력)
+ * @return 반환값 없음
+ */
+static void JHashWyMultiply(uint64_t *a, uint64_t *b)
+{
+#ifdef __SIZEOF_INT128__
+	__uint128_t product = (__uint128_t)(*a) * (*b);
+	*a = (uint64_t)product;
+	*b = (uint64_t)(product >> 64);
+#else
+	uint64_t aHigh = *a >> 32;
+	uint64_t aLow = (uint32_t)(*a);
+	uint64_t bHigh = *b >> 32;
+	uint64_t bLow = (uint32_t)(*b);
+	uint64_t highHigh = aHigh * bHigh;
+	uint64_t highLow = aHigh * bLow;
+	uint64_t lowHigh = aLow * bHigh;
+	uint64_t lowLow = aLow * bLow;
+	uint64_t middle = highLow + lowHigh;
+	uint64_t carry = (middle < highLow) ? (1ULL << 32) : 0;
+	uint64_t low = lowLow + (middle << 32);
+	*b = highHigh + (middle >> 32) + carry + ((low < lowLow) ? 1 : 0);
+	*a = low;
+#endif
+}
+
+/**
+ * @fn static uint64_t JHashWyMix(uint64_t a, uint64_t b)
+ * @brief 두 64 bit 값을 128 bit 로 곱한 결과의 상위, 하위 64 bit 를 XOR 하는 함수(wyhash 혼합 단계)
+ * @param a 첫 번째 값(입력)
+ * @param b 두 번째 값(입력)
+ * @return 항상 혼합된 값 반환
+ */
+static uint64_t JHashWyMix(uint64_t a, uint64_t b)
+{
+	JHashWyMultiply(&a, &b);
+	return a ^ b;
+}
+
+/**
+ * @fn static uint64_t JHashWyRead(const unsigned char *p, int byteCount)
+ * @brief 지정한 주소에서 4 또는 8 byte 를 little endian 정수로 읽는 함수
+ * @param p 읽을 주소(입력, 읽기 전용)
+ * @param byteCount 읽을 byte 수(입력, 4 또는 8)
+ * @return 항상 읽은 값 반환
+ */
+static uint64_t JHashWyRead(const unsigned char *p, int byteCount)
+{
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+	if(byteCount == 8)
+	{
+		uint64_t value64 = 0;
+		memcpy(&value64, p, 8);
+		return value64;
+	}
+	uint32_t value32 = 0;
+	memcpy(&value32, p, 4);
+	return value32;
+#else
+	uint64_t value = 0;
+	int byteIndex = byteCount - 1;
+	for( ; byteIndex >= 0; byteIndex--)
+	{
+		value = (value << 8) | (uint64_t)p[byteIndex];
+	}
+	return value;
+#endif
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Static Functions for Open Addressing Storage
+/// 슬롯마다 1 byte 제어 바이트를 두고 JHT_GROUP_SIZE 개씩 한 번에 비교한다.
+/// 제어 바이트 : EMPTY(-128), DELETED(-2), FULL(0 ~ 127, 해쉬값의 하위 7 bit 태그)
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static uint64_t JSwissGetHash(const JHashTablePtr table, const void *key)
+ * @brief Open Addressing 저장소에서 사용할 키의 해쉬값을 계산하는 함수
+ * 하위 7 bit 태그와 상위 bit 탐색 위치를 함께 쓰므로, 등록된 해싱 함수가 약하더라도 전체 bit 가 섞이도록 한 번 더 혼합한다.
+ * @param table 해쉬 테이블 구조체 객체의 주소(입력, 읽기 전용)
+ * @param key 해싱할 키(입력, 읽기 전용)
+ * @return 항상 해쉬값 반환
+ */
+static uint64_t JSwissGetHash(const JHashTablePtr table, const void *key)
+{
+	return JHashTableMix64(JHashTableGetFullHash(table, key));
+}
+
+/**
+ * @fn static int JSwissInit(JHashTablePtr table, int capacity)
+ * @brief Open Addressing 저장소의 제어 바이트 배열과 슬롯 배열을 새로 할당하는 함수
+ * 슬롯 개수는 capacity 이상의 2 의 거듭제곱(최소 JHT_MIN_CAPACITY)으로 정한다.
+ * 실패 시 해쉬 테이블의 기존 저장소는 변경하지 않는다.
+ * @param table 해쉬 테이블 구조체 객체의 주소(출력)
+ * @param capacity 최소 슬롯 개수(입력)
+ * @return 성공 시 할당된 슬롯 개수, 실패 시 HASH_FAIL 반환
+ */
+static int JSwissInit(JHashTablePtr table, int capacity)
+{
+	int slotCount = JHT_MIN_CAPACITY;
+	while(slotCount < capacity)
+	{
+		if(slotCount > (INT_MAX / 2) - JHT_GROUP_SIZE) return HASH_FAIL;
+		slotCount <<= 1;
+	}
+
+	signed char *ctrlBytes = (signed char*)malloc((size_t)(slotCount + JHT_GROUP_SIZE));
+	if(ctrlBytes == NULL) return HASH_FAIL;
+
+	JSlotPtr slots = (JSlotPtr)calloc((size_t)slotCount, sizeof(JSlot));
+	if(slots == NULL)
+	{
+		free(ctrlBytes);
+		return HASH_FAIL;
+	}
+
+	memset(ctrlBytes, JHT_CTRL_EMPTY, (size_t)(slotCount + JHT_GROUP_SIZE));
+
+	table->ctrlBytes = ctrlBytes;
+	table->slots = slots;
+	table->size = slotCount;
+	table->count = 0;
+	table->deletedSlots = 0;
+	table->slotsGeneration++;
+
+	return slotCount;
+}
+
+/**
+ * @fn static void JSwissFree(JHashTablePtr table)
+ * @brief Open Addressing 저장소의 제어 바이트 배열과 슬롯 배열을 해제하는 함수
+ * 저장된 key 와 value 는 사용자 메모리이므로 해제하지 않는다.
+ * @param table 해쉬 테이블 구조체 객체의 주소(출력)
+ * @return 반환값 없음
+ */
+static void JSwissFree(JHashTablePtr table)
+{
+	free(table->ctrlBytes);
+	free(table->slots);
+	table->ctrlBytes = NULL;
+	table->slots = NULL;
+}
+
+/**
+ * @fn static unsigned int JSwissMatchByte(const signed char *group, signed char value)
+ * @brief 그룹의 제어 바이트들 중에서 지정한 값과 같은 위치를 bit mask 로 반환하는 함수
+ * SSE2 를 사용할 수 있으면 16 개의 바이트를 한 번에 비교한다.
+ * @param group 검사할 그룹의 첫 번째 제어 바이트 주소(입력, 읽기 전용)
+ * @param value 비교할 제어 바이트 값(입력)
+ * @return 항상 일치하는 위치의 bit mask 반환(i 번째 bit 가 group[i] 에 대응)
+ */
+static unsigned int JSwissMatchByte(const signed char *group, signed char value)
+{
+#ifdef JHT_USE_SSE2
+	__m128i ctrl = _mm_loadu_si128((const __m128i*)group);
+	return (unsigned int)_mm_movemask_epi8(_mm_cmpeq_epi8(ctrl, _mm_set1_epi8(value)));
+#else
+	unsigned int mask = 0;
+	int byteIndex = 0;
+	for( ; byteIndex < JHT_GROUP_SIZE; byteIndex++)
+	{
+		if(group[byteIndex] == value) mask |= (1u << byteIndex);
+	}
+	return mask;
+#endif
+}
+
+/**
+ * @fn static unsigned int JSwissMatchEmpty(const signed char *group)
+ * @brief 그룹에서 비어 있는 슬롯의 위치를 bit mask 로 반환하는 함수
+ * @param group 검사할 그룹의 첫 번째 제어 바이트 주소(입력, 읽기 전용)
+ * @return 항상 비어 있는 위치의 bit mask 반환
+ */
+static unsigned int JSwissMatchEmpty(const signed char *group)
+{
+	return JSwissMatchByte(group, JHT_CTRL_EMPTY);
+}
+
+/**
+ * @fn static unsigned int JSwissMatchFull(const signed char *group)
+ * @brief 그룹에서 사용 중인 슬롯(제어 바이트의 최상위 bit 가 0)의 위치를 bit mask 로 반환하는 함수
+ * @param group 검사할 그룹의 첫 번째 제어 바이트 주소(입력, 읽기 전용)
+ * @return 항상 사용 중인 위치의 bit mask 반환
+ */
+static unsigned int JSwissMatchFull(const signed char *group)
+{
+#ifdef JHT_USE_SSE2
+	__m128i ctrl = _mm_loadu_si128((const __m128i*)group);
+	return (~(unsigned int)_mm_movemask_epi8(ctrl)) & 0xFFFFu;
+#else
+	unsigned int mask = 0;
+	int byteIndex = 0;
+	for( ; byteIndex < JHT_GROUP_SIZE; byteIndex++)
+	{
+		if(group[byteIndex] >= 0) mask |= (1u << byteIndex);
+	}
+	return mask;
+#endif
+}
+
+/**
+ * @fn static void JSwissSetCtrl(JHashTablePtr table, int slotIndex, signed char ctrl)
+ * @brief 슬롯의 제어 바이트를 변경하는 함수
+ * 앞쪽 JHT_GROUP_SIZE 개의 슬롯은 배열 끝에 복제된 바이트도 함께 변경한다.
+ * @param table 해쉬 테이블 구조체 객체의 주소(출력)
+ * @param slotIndex 변경할 슬롯 위치(입력)
+ * @param ctrl 저장할 제어 바이트(입력)
+ * @return 반환값 없음
+ */
+static void JSwissSetCtrl(JHashTablePtr table, int slotIndex, signed char ctrl)
+{
+	table->ctrlBytes[slotIndex] = ctrl;
+	if(slotIndex < JHT_GROUP_SIZE) table->ctrlBytes[table->size + slotIndex] = ctrl;
+}
+
+/**
+ * @fn static int JSwissFindSlot(const JHashTablePtr table, uint64_t hash, const void *key, const void *value)
+ * @brief 지정한 키(와 데이터)가 저장된 슬롯을 검색하는 함수
+ * 해쉬값의 상위 bit 로 시작 위치를, 하위 7 bit 로 태그를 정하고 그룹 단위로 삼각수 간격만큼 이동하며 검사한다.
+ * 비어 있는 슬롯이 있는 그룹을 만나면 검색을 종료한다.
+ * @param table 해쉬 테이블 구조체 객체의 주소(입력, 읽기 전용)
+ * @param hash 키의 64 bit 해쉬값(입력)
+ * @param key 검색할 키(입력, 읽기 전용)
+ * @param value 검색할 데이터(입력, 읽기 전용, NULL 이면 키만 비교)
+ * @return 성공 시 슬롯 위치, 실패 시 -1 반환
+ */
+static int JSwissFindSlot(const JHashTablePtr table, uint64_t hash, const void *key, const void *value)
+{
+	int mask = table->size - 1;
+	int groupCount = table->size / JHT_GROUP_SIZE;
+	int position = (int)((hash >> 7) & (uint64_t)mask);
+	signed char tag = (signed char)(hash & 0x7F);
+	int probeIndex = 0;
+
+	for( ; probeIndex < groupCount; probeIndex++)
+	{
+		const signed char *group = table->ctrlBytes + position;
+		unsigned int matches = JSwissMatchByte(group, tag);
+		while(matches != 0)
+		{
+			int slotIndex = (position + __builtin_ctz(matches)) & mask;
+			JSlotPtr slot = &(table->slots[slotIndex]);
+			if(((value == NULL) || (slot->data == value)) && (JHashTableIsKeyEqual(table, slot->key, key) == 1)) return slotIndex;
+			matches &= matches - 1;
+		}
+		if(JSwissMatchEmpty(group) != 0) break;
+		position = (position + (probeIndex + 1) * JHT_GROUP_SIZE) & mask;
+	}
+
+	return -1;
+}
+
+/**
+ * @fn static int JSwissFindInsertSlot(const JHashTablePtr table, uint64_t hash)
+ * @brief 지정한 해쉬값으로 데이터를 저장할 수 있는 첫 번째 슬롯(EMPTY 또는 DELETED)을 검색하는 함수
+ * @param table 해쉬 테이블 구조체 객체의 주소(입력, 읽기 전용)
+ * @param hash 키의 64 bit 해쉬값(입력)
+ * @return 성공 시 슬롯 위치, 실패 시 -1 반환
+ */
+static int JSwissFindInsertSlot(const JHashTablePtr table, uint64_t hash)
+{
+	int mask = table->size - 1;
+	int groupCount = table->size / JHT_GROUP_SIZE;
+	int position = (int)((hash >> 7) & (uint64_t)mask);
+	int probeIndex = 0;
+
+	for( ; probeIndex < groupCount; probeIndex++)
+	{
+		unsigned int matches = (~JSwissMatchFull(table->ctrlBytes + position)) & 0xFFFFu;
+		if(matches != 0) return (position + __builtin_ctz(matches)) & mask;
+		position = (position + (probeIndex + 1) * JHT_GROUP_SIZE) & mask;
+	}
+
+	return -1;
+}
+
+/**
+ * @fn static int JSwissResize(JHashTablePtr table, int capacity)
+ * @brief 지정한 슬롯 개수로 저장소를 새로 할당하고 저장된 모든 데이터를 다시 배치하는 함수
+ * 삭제 표시된 슬롯은 이 과정에서 모두 제거된다.
+ * @param table 해쉬 테이블 구조체 객체의 주소(출력)
+ * @param capacity 새로운 최소 슬롯 개수(입력)
+ * @return 성공 시 새로운 슬롯 개수, 실패 시 HASH_FAIL 반환
+ */
+static int JSwissResize(JHashTablePtr table, int capacity)
+{
+	signed char *oldCtrlBytes = table->ctrlBytes;
+	JSlotPtr oldSlots = table->slots;
+	int oldSize = table->size;
+
+	if(JSwissInit(table, capacity) == HASH_FAIL) return HASH_FAIL;
+
+	int slotIndex = 0;
+	for( ; slotIndex < oldSize; slotIndex++)
+	{
+		if(oldCtrlBytes[slotIndex] < 0) continue;
+
+		uint64_t hash = JSwissGetHash(table, oldSlots[slotIndex].key);
+		int newSlotIndex = JSwissFindInsertSlot(table, hash);
+		table->slots[newSlotIndex] = oldSlots[slotIndex];
+		JSwissSetCtrl(table, newSlotIndex, (signed char)(hash & 0x7F));
+		table->count++;
+	}
+
+	free(oldCtrlBytes);
+	free(oldSlots);
+
+	return table->size;
+}
+
+/**
+ * @fn static JHashTablePtr JSwissAddData(JHashTablePtr table, void *key, void *value, int checkDuplicate)
+ * @brief Open Addressing 저장소에 새로운 데이터를 추가하는 함수
+ * 중복 검사를 하면 같은 키와 데이터 쌍은 중복 저장하지 않는다.
+ * 저장된 데이터와 삭제 표시된 슬롯이 전체의 7/8 을 넘으면 저장소를 다시 배치(필요하면 2 배로 확장)한다.
+ * @param table 해쉬 테이블 구조체 객체의 주소(출력)
+ * @param key 저장할 키(입력)
+ * @param value 저장할 데이터(입력)
+ * @param checkDuplicate 같은 키와 데이터가 저장되어 있는지 검사할지 여부(입력)
+ * @return 성공 시 해쉬 테이블 구조체의 주소, 실패 시 NULL 반환
+ */
+static JHashTablePtr JSwissAddData(JHashTablePtr table, void *key, void *value, int checkDuplicate)
+{
+	uint64_t hash = JSwissGetHash(table, key);
+	if((checkDuplicate != 0) && (JSwissFindSlot(table, hash, key, value) >= 0)) return NULL;
+	return JSwissInsertHashed(table, key, value, hash);
+}
+
+/**
+ * @fn static JHashTablePtr JSwissInsertHashed(JHashTablePtr table, void *key, void *value, uint64_t hash)
+ * @brief (Open Addressing) 해쉬값을 이미 계산한 데이터를 중복 검사 없이 추가하는 함수(재배치 기준은 JSwissAddData 참고)
+ * @param table 해쉬 테이블 구조체 객체의 주소(출력)
+ * @param key 저장할 키(입력)
+ * @param value 저장할 데이터(입력)
+ * @param hash 키의 해쉬값(입력, JSwissGetHash 참고)
+ * @return 성공 시 해쉬 테이블 구조체의 주소, 실패 시 NULL 반환
+ */
+static JHashTablePtr JSwissInsertHashed(JHashTablePtr table, void *key, void *value, uint64_t hash)
+{
+	if((table->count + table->deletedSlots + 1) > (table->size - (table->size / 8)))
+	{
+		int capacity = table->size;
+		if((table->count + 1) > ((capacity / 16) * 7))
+		{
+			if(capacity > INT_MAX / 2) return NULL;
+			capacity *= 2;
+		}
+		if(JSwissResize(table, capacity) == HASH_FAIL) return NULL;
+	}
+
+	int slotIndex = JSwissFindInsertSlot(table, hash);
+	if(slotIndex < 0) return NULL;
+
+	if(table->ctrlBytes[slotIndex] == JHT_CTRL_DELETED) table->deletedSlots--;
+	table->slots[slotIndex].key = key;
+	table->slots[slotIndex].data = value;
+	JSwissSetCtrl(table, slotIndex, (signed char)(hash & 0x7F));
+	table->count++;
+
+	return table;
+}
+
+/**
+ * @fn static void* JSwissFindOrAdd(JHashTablePtr table, void *key, void *value, int isUpdate, InsertResult *result)
+ * @brief (Open Addressing) 키를 한 번 해싱해서 저장된 데이터를 찾거나(교체하거나) 새로운 데이터를 추가하는 함수(JHashTableFindOrAdd 참고)
+ * @param table 해쉬 테이블 구조체 객체의 주소(출력)
+ * @param key 검색하거나 저장할 키(입력)
+ * @param value 저장할 데이터(입력)
+ * @param isUpdate 키를 찾으면 데이터를 value 로 교체할지 여부(입력)
+ * @param result 추가했으면 InsertAdded, 찾았으면 InsertExisting, 실패하면 InsertFail(출력)
+ * @return 키를 찾았으면 찾은 데이터(교체했으면 교체 전 데이터), 아니면 NULL 반환
+ */
+static void* JSwissFindOrAdd(JHashTablePtr table, void *key, void *value, int isUpdate, InsertResult *result)
+{
+	uint64_t hash = JSwissGetHash(table, key);
+	int slotIndex = JSwissFindSlot(table, hash, key, NULL);
+	void *data = NULL;
+
+	if(slotIndex >= 0)
+	{
+		data = table->slots[slotIndex].data;
+		if(isUpdate != 0) table->slots[slotIndex].data = value;
+		*result = InsertExisting;
+		return data;
+	}
+
+	*result = (JSwissInsertHashed(table, key, value, hash) != NULL) ? InsertAdded : InsertFail;
+	return NULL;
+}
+
+/**
+ * @fn static void JSwissEraseSlot(JHashTablePtr table, int slotIndex)
+ * @brief 지정한 슬롯의 데이터를 삭제하는 함수
+ * 슬롯을 지나가는 검색이 있을 수 없는 경우(앞뒤로 JHT_GROUP_SIZE 보다 좁은 범위 안에 빈 슬롯이 있는 경우)에는
+ * 삭제 표시 대신 빈 슬롯으로 되돌린다.
+ * @param table 해쉬 테이블 구조체 객체의 주소(출력)
+ * @param slotIndex 삭제할 슬롯 위치(입력)
+ * @return 반환값 없음
+ */
+static void JSwissEraseSlot(JHashTablePtr table, int slotIndex)
+{
+	int mask = table->size - 1;
+	unsigned int emptyBefore = JSwissMatchEmpty(table->ctrlBytes + ((slotIndex - JHT_GROUP_SIZE) & mask));
+	unsigned int emptyAfter = JSwissMatchEmpty(table->ctrlBytes + slotIndex);
+	int wasNeverFull = (emptyBefore != 0) && (emptyAfter != 0)
+		&& ((__builtin_ctz(emptyAfter) + (__builtin_clz(emptyBefore) - (int)(sizeof(unsigned int) * 8 - JHT_GROUP_SIZE))) < JHT_GROUP_SIZE);
+
+	table->slots[slotIndex].key = NULL;
+	table->slots[slotIndex].data = NULL;
+	table->count--;
+
+	if(wasNeverFull)
+	{
+		JSwissSetCtrl(table, slotIndex, JHT_CTRL_EMPTY);
+	}
+	else
+	{
+		JSwissSetCtrl(table, slotIndex, JHT_CTRL_DELETED);
+		table->deletedSlots++;
+	}
+}
+
+/**
+ * @fn static int JSwissGetFirstSlot(const JHashTablePtr table)
+ * @brief 사용 중인 첫 번째 슬롯의 위치를 반환하는 함수
+ * @param table 해쉬 테이블 구조체 객체의 주소(입력, 읽기 전용)
+ * @return 성공 시 슬롯 위치, 실패 시 -1 반환
+ */
+static int JSwissGetFirstSlot(const JHashTablePtr table)
+{
+	if(table->count == 0) return -1;
+
+	int position = 0;
+	for( ; position < table->size; position += JHT_GROUP_SIZE)
+	{
+		unsigned int matches = JSwissMatchFull(table->ctrlBytes + position);
+		if(matches != 0) return position + __builtin_ctz(matches);
+	}
+
+	return -1;
+}
+
+/**
+ * @fn static int JSwissGetLastSlot(const JHashTablePtr table)
+ * @brief 사용 중인 마지막 슬롯의 위치를 반환하는 함수
+ * @param table 해쉬 테이블 구조체 객체의 주소(입력, 읽기 전용)
+ * @return 성공 시 슬롯 위치, 실패 시 -1 반환
+ */
+static int JSwissGetLastSlot(const JHashTablePtr table)
+{
+	if(table->count == 0) return -1;
+
+	int position = table->size - JHT_GROUP_SIZE;
+	for( ; position >= 0; position -= JHT_GROUP_SIZE)
+	{
+		unsigned int matches = JSwissMatchFull(table->ctrlBytes + position);
+		if(matches != 0) return position + (int)(sizeof(unsigned int) * 8) - 1 - __builtin_clz(matches);
+	}
+
+	return -1;
+}
+
+/**
+ * @fn static DeleteResult JSwissRemoveKey(JHashTablePtr table, void *key)
+ * @brief Open Addressing 저장소에서 지정한 키에 저장된 모든 데이터를 삭제하는 함수
+ * @param table 해쉬 테이블 구조체 객체의 주소(출력)
+ * @param key 삭제할 키(입력)
+ * @return 성공 시 DeleteSuccess, 실패 시 DeleteFail 반환(DeleteResult 열거형 참고)
+ */
+static DeleteResult JSwissRemoveKey(JHashTablePtr table, void *key)
+{
+	DeleteResult result = DeleteFail;
+	uint64_t hash = JSwissGetHash(table, key);
+	int slotIndex = JSwissFindSlot(table, hash, key, NULL);
+
+	while(slotIndex >= 0)
+	{
+		JSwissEraseSlot(table, slotIndex);
+		result = DeleteSuccess;
+		slotIndex = JSwissFindSlot(table, hash, key, NULL);
+	}
+
+	return result;
+}
+
+/**
+ * @fn static void JSwissPrintAll(const JHashTablePtr table)
+ * @brief Open Addressing 저장소에 저장된 모든 데이터들을 슬롯 순서대로 출력하는 함수
+ * @param table 해쉬 테이블 구조체 객체의 주소(입력, 읽기 전용)
+ * @return 반환값 없음
+ */
+static void JSwissPrintAll(const JHashTablePtr table)
+{
+    int slotIndex = 0;
+    void *data = NULL;
+
+    printf("------------------\n");
+    for( ; slotIndex < table->size; slotIndex++)
+    {
+        if(table->ctrlBytes[slotIndex] < 0) continue;
+
+        data = table->slots[slotIndex].data;
+        printf("(%d) [ ", slotIndex);
+        switch(table->valueType)
+        {
+            case IntType:
+                printf("%d ", *((int*)data));
+                break;
+            case CharType:
+                printf("%c ", *((char*)data));
+                break;
+            case StringType:
+                printf("%s ", ((char*)data));
+                break;
+            default: return;
+        }
+        printf("]\n");
+    }
+    printf("------------------\n");
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Static Functions for Lock-Free Buckets
+/// 버킷마다 전체 해쉬값 순서로 정렬된 단일 연결 리스트를 두고, 노드 연결과 분리를 CAS 로 처리한다(Harris/Michael).
+/// 삭제는 노드의 next 최하위 bit 를 1 로 표시(논리 삭제)한 후 앞 노드에서 분리(물리 삭제)하며,
+/// 분리에 성공한 스레드가 노드를 자신의 삭제 대기 목록에 넣고 epoch 기반으로 해제한다.
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static void JLockFreeFree(JHashTablePtr table)
+ * @brief 잠금 없는 버킷의 노드들과 스레드별 삭제 대기 노드들, 버킷 배열을 해제하는 함수
+ * @param table 해쉬 테이블 구조체 객체의 주소(출력)
+ * @return 반환값 없음
+ */
+static void JLockFreeFree(JHashTablePtr table)
+{
+	if(table->lockFreeBuckets == NULL) return;
+
+	int listIndex = 0;
+	int retiredIndex = 0;
+	JNodePtr node = NULL;
+	JNodePtr nextNode = NULL;
+	JEpochRecordPtr record = NULL;
+
+	for( ; listIndex < table->size; listIndex++)
+	{
+		node = table->lockFreeBuckets[listIndex];
+		while(node != NULL)
+		{
+			nextNode = JHT_LF_UNMARKED(node->next);
+			free(node);
+			node = nextNode;
+		}
+	}
+	for(record = table->epochRecords; record != NULL; record = record->next)
+	{
+		for(retiredIndex = 0; retiredIndex < 3; retiredIndex++) JHashTableReclaimNodes(&(record->retired), NULL, retiredIndex);
+	}
+
+	free(table->lockFreeBuckets);
+	table->lockFreeBuckets = NULL;
+}
+
+/**
+ * @fn static void JLockFreeClear(JHashTablePtr table)
+ * @brief 잠금 없는 버킷들의 모든 노드를 해제하고 버킷을 비우는 함수
+ * 데이터가 있는 버킷만 bitmap 으로 찾아 비우며, 삭제 대기 목록의 노드는 기존대로 epoch 가 지난 후 해제된다.
+ * @param table 해쉬 테이블 구조체 객체의 주소(출력, 다른 스레드가 사용하지 않는 상태)
+ * @return 반환값 없음
+ */
+static void JLockFreeClear(JHashTablePtr table)
+{
+	int listIndex = 0;
+	JNodePtr node = NULL;
+	JNodePtr nextNode = NULL;
+	JEpochRecordPtr record = NULL;
+
+	while((listIndex = JBucketBitmapFindNext(&(table->occupied), listIndex)) >= 0)
+	{
+		for(node = table->lockFreeBuckets[listIndex]; node != NULL; node = nextNode)
+		{
+			nextNode = JHT_LF_UNMARKED(node->next);
+			free(node);
+		}
+		table->lockFreeBuckets[listIndex] = NULL;
+		listIndex++;
+	}
+	JBucketBitmapClear(&(table->occupied));
+
+	for(record = table->epochRecords; record != NULL; record = record->next) record->count = 0;
+}
+
+/**
+ * @fn static int JLockFreeSearch(const JHashTablePtr table, int listIndex, uint64_t hash, const void *key, const void *value, JNodePtr **prevLink, JNodePtr *found)
+ * @brief 잠금 없는 버킷에서 지정한 키와 데이터의 노드 또는 새로운 노드를 연결할 위치를 찾는 함수
+ * 지나가는 삭제 표시된 노드는 앞 노드에서 분리하며, 분리 중 앞 노드가 바뀌면 처음부터 다시 찾는다.
+ * 찾지 못하면 전체 해쉬값이 더 큰 첫 번째 노드(같은 해쉬값 노드들의 다음)와 그 노드를 가리키는 연결 위치를 반환한다.
+ * epoch 구간 안에서 호출해야 한다.
+ * @param table 해쉬 테이블 구조체 객체의 주소(입력, 읽기 전용)
+ * @param listIndex 버킷 위치(입력)
+ * @param hash 키의 전체 해쉬값(입력)
+ * @param key 찾을 키(입력, NULL 이면 노드를 찾지 않고 연결 위치만 찾음)
+ * @param value 찾을 데이터(입력, NULL 이면 키만 비교)
+ * @param prevLink 찾은 노드를 가리키는 연결 위치(버킷 배열 항목 또는 앞 노드의 next)(출력)
+ * @param found 찾은 노드 또는 연결 위치 다음 노드(출력, 없으면 NULL)
+ * @return 찾으면 1, 찾지 못하면 0 반환
+ */
+static int JLockFreeSearch(const JHashTablePtr table, int listIndex, uint64_t hash, const void *key, const void *value, JNodePtr **prevLink, JNodePtr *found)
+{
+	JNodePtr *link = NULL;
+	JNodePtr node = NULL;
+	JNodePtr nextNode = NULL;
+	JNodePtr expected = NULL;
+	int isRetry = 1;
+
+	while(isRetry != 0)
+	{
+		isRetry = 0;
+		link = &(table->lockFreeBuckets[listIndex]);
+		node = __atomic_load_n(link, __ATOMIC_ACQUIRE);
+		while(node != NULL)
+		{
+			nextNode = __atomic_load_n(&(node->next), __ATOMIC_ACQUIRE);
+			if(JHT_LF_IS_MARKED(nextNode))
+			{
+				expected = node;
+				if(__atomic_compare_exchange_n(link, &expected, JHT_LF_UNMARKED(nextNode), 0, __ATOMIC_SEQ_CST, __ATOMIC_ACQUIRE) == 0)
+				{
+					isRetry = 1;
+					break;
+				}
+				JHashTableRetireNode(table, listIndex, node);
+				node = JHT_LF_UNMARKED(nextNode);
+				continue;
+			}
+
+			if(node->hash > hash) break;
+			if((key != NULL) && (node->hash == hash) && ((value == NULL) || (__atomic_load_n(&(node->data), __ATOMIC_RELAXED) == value))
+				&& (JHashTableIsKeyEqual(table, node->key, key) == 1))
+			{
+				*prevLink = link;
+				*found = node;
+				return 1;
+			}
+			link = &(node->next);
+			node = nextNode;
+		}
+	}
+
+	*prevLink = link;
+	*found = node;
+	return 0;
+}
+
+/**
+ * @fn static JNodePtr JLockFreeFindNode(const JHashTablePtr table, int listIndex, uint64_t hash, const void *key, const void *value)
+ * @brief 잠금 없는 버킷에서 삭제 표시되지 않은 노드를 찾는 함수(검색 전용, 노드를 분리하지 않음)
+ * epoch 구간 안에서 호출해야 한다.
+ * @param table 해쉬 테이블 구조체 객체의 주소(입력, 읽기 전용)
+ * @param listIndex 버킷 위치(입력)
+ * @param hash 키의 전체 해쉬값(입력)
+ * @param key 찾을 키(입력)
+ * @param value 찾을 데이터(입력, NULL 이면 키만 비교)
+ * @return 성공 시 노드의 주소, 실패 시 NULL 반환
+ */
+static JNodePtr JLockFreeFindNode(const JHashTablePtr table, int listIndex, uint64_t hash, const void *key, const void *value)
+{
+	JNodePtr node = __atomic_load_n(&(table->lockFreeBuckets[listIndex]), __ATOMIC_ACQUIRE);
+	JNodePtr nextNode = NULL;
+
+	while(node != NULL)
+	{
+		if(node->hash > hash) return NULL;
+
+		nextNode = __atomic_load_n(&(node->next), __ATOMIC_ACQUIRE);
+		if((JHT_LF_IS_MARKED(nextNode) == 0) && (node->hash == hash) && ((value == NULL) || (__atomic_load_n(&(node->data), __ATOMIC_RELAXED) == value))
+			&& (JHashTableIsKeyEqual(table, node->key, key) == 1))
+		{
+			return node;
+		}
+		node = JHT_LF_UNMARKED(nextNode);
+	}
+
+	return NULL;
+}
+
+/**
+ * @fn static void JLockFreeUpdateBit(JHashTablePtr table, int listIndex)
+ * @brief 잠금 없는 버킷의 데이터 유무에 따라 bitmap 의 bit 를 설정하거나 지우는 함수
+ * bit 를 지운 후 다른 스레드가 노드를 연결했으면 다시 설정하므로, 데이터가 있는 버킷의 bit 는 지워진 채로 남지 않는다.
+ * @param table 해쉬 테이블 구조체 객체의 주소(출력)
+ * @param listIndex 버킷 위치(입력)
+ * @return 반환값 없음
+ */
+static void JLockFreeUpdateBit(JHashTablePtr table, int listIndex)
+{
+	JBucketBitmapPtr bitmap = &(table->occupied);
+	JNodePtr *bucket = &(table->lockFreeBuckets[listIndex]);
+	int wordIndex = listIndex >> 6;
+	uint64_t bit = 1ULL << (listIndex & 63);
+	uint64_t word = __atomic_load_n(&(bitmap->words[wordIndex]), __ATOMIC_SEQ_CST);
+
+	if(__atomic_load_n(bucket, __ATOMIC_SEQ_CST) == NULL)
+	{
+		if((word & bit) == 0) return;
+		__atomic_fetch_and(&(bitmap->words[wordIndex]), ~bit, __ATOMIC_SEQ_CST);
+		if(__atomic_load_n(bucket, __ATOMIC_SEQ_CST) == NULL) return;
+	}
+	else if((word & bit) != 0)
+	{
+		return;
+	}
+
+	__atomic_fetch_or(&(bitmap->words[wordIndex]), bit, __ATOMIC_SEQ_CST);
+	JBucketBitmapWiden(bitmap, wordIndex);
+}
+
+/**
+ * @fn static void JLockFreeAddCount(JHashTablePtr table, int delta)
+ * @brief 잠금 없는 버킷의 데이터 개수를 호출한 스레드의 검색 상태에서 변경하는 함수
+ * epoch 구간 안에서 호출해야 한다.
+ * @param table 해쉬 테이블 구조체 객체의 주소(출력)
+ * @param delta 변경할 개수(입력)
+ * @return 반환값 없음
+ */
+static void JLockFreeAddCount(JHashTablePtr table, int delta)
+{
+	int *count = &(JHashTableGetEpochRecord(table, 0)->count);
+	__atomic_store_n(count, __atomic_load_n(count, __ATOMIC_RELAXED) + delta, __ATOMIC_RELAXED);
+}
+
+/**
+ * @fn static void JLockFreeUnlink(JHashTablePtr table, int listIndex, JNodePtr *prevLink, JNodePtr node, JNodePtr nextNode)
+ * @brief 삭제 표시한 노드를 앞 노드에서 분리하는 함수
+ * 앞 노드가 바뀌어 분리하지 못하면 버킷을 다시 검색해서 분리한다(다른 스레드가 대신 분리할 수도 있음).
+ * @param table 해쉬 테이블 구조체 객체의 주소(출력)
+ * @param listIndex 버킷 위치(입력)
+ * @param prevLink 노드를 찾을 때의 연결 위치(입력)
+ * @param node 삭제 표시한 노드(입력)
+ * @param nextNode 삭제 표시할 때의 다음 노드(입력)
+ * @return 반환값 없음
+ */
+static void JLockFreeUnlink(JHashTablePtr table, int listIndex, JNodePtr *prevLink, JNodePtr node, JNodePtr nextNode)
+{
+	JNodePtr expected = node;
+	if(__atomic_compare_exchange_n(prevLink, &expected, nextNode, 0, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED) != 0)
+	{
+		JHashTableRetireNode(table, listIndex, node);
+	}
+	else
+	{
+		JLockFreeSearch(table, listIndex, node->hash, NULL, NULL, &prevLink, &expected);
+	}
+
+	JLockFreeUpdateBit(table, listIndex);
+	JLockFreeAddCount(table, -1);
+}
+
+/**
+ * @fn static void* JLockFreeRemove(JHashTablePtr table, int listIndex, uint64_t hash, const void *key, const void *value)
+ * @brief 잠금 없는 버킷에서 지정한 키와 데이터의 노드 하나를 삭제하는 함수
+ * 같은 노드를 여러 스레드가 삭제하면 삭제 표시에 성공한 스레드만 삭제한 것으로 처리한다.
+ * epoch 구간 안에서 호출해야 한다.
+ * @param table 해쉬 테이블 구조체 객체의 주소(출력)
+ * @param listIndex 버킷 위치(입력)
+ * @param hash 키의 전체 해쉬값(입력)
+ * @param key 삭제할 키(입력)
+ * @param value 삭제할 데이터(입력, NULL 이면 키만 비교)
+ * @return 성공 시 삭제된 데이터의 주소, 실패 시 NULL 반환
+ */
+static void* JLockFreeRemove(JHashTablePtr table, int listIndex, uint64_t hash, const void *key, const void *value)
+{
+	JNodePtr *prevLink = NULL;
+	JNodePtr node = NULL;
+	JNodePtr nextNode = NULL;
+
+	while(JLockFreeSearch(table, listIndex, hash, key, value, &prevLink, &node) == 1)
+	{
+		nextNode = __atomic_load_n(&(node->next), __ATOMIC_ACQUIRE);
+		if(JHT_LF_IS_MARKED(nextNode)) continue;
+		if(__atomic_compare_exchange_n(&(node->next), &nextNode, JHT_LF_MARKED(nextNode), 0, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED) == 0) continue;
+
+		void *data = __atomic_load_n(&(node->data), __ATOMIC_ACQUIRE);
+		JLockFreeUnlink(table, listIndex, prevLink, node, nextNode);
+		return data;
+	}
+
+	return NULL;
+}
+
+/**
+ * @fn static JHashTablePtr JLockFreeAddData(JHashTablePtr table, void *key, void *value, int checkDuplicate)
+ * @brief 잠금 없는 버킷에 새로운 데이터를 추가하는 함수
+ * 같은 해쉬값의 노드들 다음에 연결하므로 같은 키의 데이터는 추가한 순서로 저장되며,
+ * 같은 키와 데이터를 여러 스레드가 동시에 추가해도 같은 위치를 두고 경쟁하므로 하나만 추가된다.
+ * @param table 해쉬 테이블 구조체 객체의 주소(출력)
+ * @param key 저장할 키(입력)
+ * @param value 저장할 데이터(입력)
+ * @param checkDuplicate 같은 키와 데이터가 저장되어 있는지 검사할지 여부(입력)
+ * @return 성공 시 해쉬 테이블 구조체의 주소, 실패 시 NULL 반환
+ */
+static JHashTablePtr JLockFreeAddData(JHashTablePtr table, void *key, void *value, int checkDuplicate)
+{
+	if(JHashTableEnterEpoch(table) == HASH_FAIL) return NULL;
+
+	uint64_t hash = JHashTableGetFullHash(table, key);
+	int listIndex = JHashTableGetBucketIndex(table, hash, table->size);
+	JNodePtr *prevLink = NULL;
+	JNodePtr node = NULL;
+	JHashTablePtr result = NULL;
+
+	JNodePtr newNode = NewJNode();
+	if(newNode != NULL)
+	{
+		newNode->prev = NULL;
+		newNode->key = key;
+		newNode->data = value;
+		newNode->hash = hash;
+		while(JLockFreeSearch(table, listIndex, hash, (checkDuplicate != 0) ? key : NULL, value, &prevLink, &node) == 0)
+		{
+			newNode->next = node;
+			if(__atomic_compare_exchange_n(prevLink, &node, newNode, 0, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED) != 0)
+			{
+				result = table;
+				break;
+			}
+		}
+	}
+
+	if(result != NULL)
+	{
+		JLockFreeUpdateBit(table, listIndex);
+		JLockFreeAddCount(table, 1);
+	}
+	else
+	{
+		free(newNode);
+	}
+	JHashTableExitEpoch(table);
+	return result;
+}
+
+/**
+ * @fn static void* JLockFreeFindOrAdd(JHashTablePtr table, void *key, void *value, int isUpdate, InsertResult *result)
+ * @brief (잠금 없는 버킷) 키를 한 번 해싱하고 버킷을 검색해서 저장된 데이터를 찾거나(교체하거나) 새로운 데이터를 추가하는 함수
+ * 찾지 못하면 검색이 반환한 연결 위치에 CAS 로 연결하고, 그 사이 다른 스레드가 버킷을 바꾸면 다시 검색한다.
+ * @param table 해쉬 테이블 구조체 객체의 주소(출력)
+ * @param key 검색하거나 저장할 키(입력)
+ * @param value 저장할 데이터(입력)
+ * @param isUpdate 키를 찾으면 데이터를 value 로 교체할지 여부(입력)
+ * @param result 추가했으면 InsertAdded, 찾았으면 InsertExisting, 실패하면 InsertFail(출력)
+ * @return 키를 찾았으면 찾은 데이터(교체했으면 교체 전 데이터), 아니면 NULL 반환
+ */
+static void* JLockFreeFindOrAdd(JHashTablePtr table, void *key, void *value, int isUpdate, InsertResult *result)
+{
+	*result = InsertFail;
+	if(JHashTableEnterEpoch(table) == HASH_FAIL) return NULL;
+
+	uint64_t hash = JHashTableGetFullHash(table, key);
+	int listIndex = JHashTableGetBucketIndex(table, hash, table->size);
+	JNodePtr *prevLink = NULL;
+	JNodePtr node = NULL;
+	JNodePtr newNode = NULL;
+	void *data = NULL;
+
+	while(1)
+	{
+		if(JLockFreeSearch(table, listIndex, hash, key, NULL, &prevLink, &node) == 1)
+		{
+			if(isUpdate != 0) data = __atomic_exchange_n(&(node->data), value, __ATOMIC_ACQ_REL);
+			else data = __atomic_load_n(&(node->data), __ATOMIC_ACQUIRE);
+			*result = InsertExisting;
+			break;
+		}
+
+		if(newNode == NULL)
+		{
+			newNode = NewJNode();
+			if(newNode == NULL) break;
+			newNode->prev = NULL;
+			newNode->key = key;
+			newNode->data = value;
+			newNode->hash = hash;
+		}
+		newNode->next = node;
+		if(__atomic_compare_exchange_n(prevLink, &node, newNode, 0, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED) != 0)
+		{
+			*result = InsertAdded;
+			break;
+		}
+	}
+
+	if(*result == InsertAdded)
+	{
+		JLockFreeUpdateBit(table, listIndex);
+		JLockFreeAddCount(table, 1);
+	}
+	else
+	{
+		free(newNode);
+	}
+	JHashTableExitEpoch(table);
+	return data;
+}
+
+/**
+ * @fn static void* JLockFreeGet(const JHashTablePtr table, const void *key, const void *value)
+ * @brief 잠금 없는 버킷에서 지정한 키(와 데이터)의 데이터를 검색하는 함수
+ * @param table 해쉬 테이블 구조체 객체의 주소(입력, 읽기 전용)
+ * @param key 검색할 키(입력)
+ * @param value 검색할 데이터(입력, NULL 이면 키만 비교)
+ * @return 성공 시 데이터의 주소, 실패 시 NULL 반환
+ */
+static void* JLockFreeGet(const JHashTablePtr table, const void *key, const void *value)
+{
+	if(JHashTableEnterEpoch(table) == HASH_FAIL) return NULL;
+
+	uint64_t hash = JHashTableGetFullHash(table, key);
+	JNodePtr node = JLockFreeFindNode(table, JHashTableGetBucketIndex(table, hash, table->size), hash, key, value);
+	void *data = (node == NULL) ? NULL : __atomic_load_n(&(node->data), __ATOMIC_ACQUIRE);
+
+	JHashTableExitEpoch(table);
+	return data;
+}
+
+/**
+ * @fn static DeleteResult JLockFreeDeleteData(JHashTablePtr table, const void *key, const void *value)
+ * @brief 잠금 없는 버킷에서 데이터를 삭제하는 함수
+ * @param table 해쉬 테이블 구조체 객체의 주소(출력)
+ * @param key 삭제할 키(입력)
+ * @param value 삭제할 데이터(입력, NULL 이면 키에 저장된 모든 데이터 삭제)
+ * @return 성공 시 DeleteSuccess, 실패 시 DeleteFail 반환(DeleteResult 열거형 참고)
+ */
+static DeleteResult JLockFreeDeleteData(JHashTablePtr table, const void *key, const void *value)
+{
+	if(JHashTableEnterEpoch(table) == HASH_FAIL) return DeleteFail;
+
+	uint64_t hash = JHashTableGetFullHash(table, key);
+	int listIndex = JHashTableGetBucketIndex(table, hash, table->size);
+	int deleteCount = 0;
+
+	while(JLockFreeRemove(table, listIndex, hash, key, value) != NULL)
+	{
+		deleteCount++;
+		if(value != NULL) break;
+	}
+
+	JHashTableExitEpoch(table);
+	return (deleteCount > 0) ? DeleteSuccess : DeleteFail;
+}
+
+/**
+ * @fn static DeleteResult JLockFreeEraseNode(JHashTablePtr table, const JHashTableEntryPtr entry)
+ * @brief 잠금 없는 버킷에서 이미 찾은 노드를 삭제하는 함수
+ * 핸들의 노드는 이미 삭제되어 해제되었을 수 있으므로, epoch 구간 안에서 버킷을 해쉬값 위치까지 검사해서
+ * 노드가 아직 연결되어 있는지(세대 번호가 같은지) 확인한 후에 노드에 삭제 표시한다.
+ * 삭제 표시된 노드는 해쉬값 위치까지 검사하는 검색이 분리한다.
+ * 같은 노드를 여러 스레드가 삭제하면 삭제 표시에 성공한 스레드만 삭제한 것으로 처리한다.
+ * @param table 해쉬 테이블 구조체 객체의 주소(출력)
+ * @param entry 삭제할 데이터의 핸들(입력, 읽기 전용)
+ * @return 성공 시 DeleteSuccess, 실패 시 DeleteFail 반환(DeleteResult 열거형 참고)
+ */
+static DeleteResult JLockFreeEraseNode(JHashTablePtr table, const JHashTableEntryPtr entry)
+{
+	if(JHashTableEnterEpoch(table) == HASH_FAIL) return DeleteFail;
+
+	uint64_t hash = entry->hash;
+	int listIndex = JHashTableGetBucketIndex(table, hash, table->size);
+	JNodePtr *prevLink = NULL;
+	JNodePtr found = NULL;
+	JNodePtr node = JHT_LF_UNMARKED(__atomic_load_n(&(table->lockFreeBuckets[listIndex]), __ATOMIC_ACQUIRE));
+	JNodePtr nextNode = NULL;
+	DeleteResult result = DeleteFail;
+
+	while((node != NULL) && (node->hash <= hash) && (node != entry->node))
+	{
+		node = JHT_LF_UNMARKED(__atomic_load_n(&(node->next), __ATOMIC_ACQUIRE));
+	}
+	if((node != entry->node) || (node->hash != hash) || (__atomic_load_n(&(node->generation), __ATOMIC_RELAXED) != entry->generation))
+	{
+		JHashTableExitEpoch(table);
+		return DeleteFail;
+	}
+
+	nextNode = __atomic_load_n(&(node->next), __ATOMIC_ACQUIRE);
+	while(JHT_LF_IS_MARKED(nextNode) == 0)
+	{
+		if(__atomic_compare_exchange_n(&(node->next), &nextNode, JHT_LF_MARKED(nextNode), 0, __ATOMIC_SEQ_CST, __ATOMIC_ACQUIRE) != 0)
+		{
+			result = DeleteSuccess;
+			break;
+		}
+	}
+
+	if(result == DeleteSuccess)
+	{
+		JLockFreeSearch(table, listIndex, hash, NULL, NULL, &prevLink, &found);
+		JLockFreeUpdateBit(table, listIndex);
+		JLockFreeAddCount(table, -1);
+	}
+
+	JHashTableExitEpoch(table);
+	return result;
+}
+
+/**
+ * @fn static void* JLockFreeGetEndData(JHashTablePtr table, int fromFirst, int isRemove)
+ * @brief 잠금 없는 버킷에서 첫 번째 또는 마지막 데이터를 반환하거나 삭제하고 반환하는 함수
+ * 데이터가 있는 첫 번째(마지막) 버킷의 삭제 표시되지 않은 첫 번째(마지막) 노드를 사용한다.
+ * 삭제 표시된 노드만 남은 버킷은 노드를 분리하고 bit 를 지운 후 다음 버킷을 찾는다.
+ * @param table 해쉬 테이블 구조체 객체의 주소(출력)
+ * @param fromFirst 1 이면 첫 번째, 0 이면 마지막 데이터(입력)
+ * @param isRemove 1 이면 삭제 후 반환(입력)
+ * @return 성공 시 데이터의 주소, 실패 시 NULL 반환
+ */
+static void* JLockFreeGetEndData(JHashTablePtr table, int fromFirst, int isRemove)
+{
+	if(JHashTableEnterEpoch(table) == HASH_FAIL) return NULL;
+
+	int listIndex = 0;
+	void *data = NULL;
+	JNodePtr *link = NULL;
+	JNodePtr *targetLink = NULL;
+	JNodePtr node = NULL;
+	JNodePtr nextNode = NULL;
+	JNodePtr target = NULL;
+
+	while((data == NULL) && ((listIndex = JBucketBitmapFindShared(&(table->occupied), fromFirst)) >= 0))
+	{
+		target = NULL;
+		link = &(table->lockFreeBuckets[listIndex]);
+		node = __atomic_load_n(link, __ATOMIC_ACQUIRE);
+		while(node != NULL)
+		{
+			nextNode = __atomic_load_n(&(node->next), __ATOMIC_ACQUIRE);
+			if(JHT_LF_IS_MARKED(nextNode) == 0)
+			{
+				target = node;
+				targetLink = link;
+				if(fromFirst != 0) break;
+			}
+			link = &(node->next);
+			node = JHT_LF_UNMARKED(nextNode);
+		}
+
+		if(target == NULL)
+		{
+			JLockFreeSearch(table, listIndex, UINT64_MAX, NULL, NULL, &link, &node);
+			JLockFreeUpdateBit(table, listIndex);
+			continue;
+		}
+		if(isRemove == 0)
+		{
+			data = __atomic_load_n(&(target->data), __ATOMIC_ACQUIRE);
+			continue;
+		}
+
+		nextNode = __atomic_load_n(&(target->next), __ATOMIC_ACQUIRE);
+		if(JHT_LF_IS_MARKED(nextNode)) continue;
+		if(__atomic_compare_exchange_n(&(target->next), &nextNode, JHT_LF_MARKED(nextNode), 0, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED) == 0) continue;
+
+		data = __atomic_load_n(&(target->data), __ATOMIC_ACQUIRE);
+		JLockFreeUnlink(table, listIndex, targetLink, target, nextNode);
+	}
+
+	JHashTableExitEpoch(table);
+	return data;
+}
+
+/**
+ * @fn static void JLockFreePrintAll(const JHashTablePtr table)
+ * @brief 잠금 없는 버킷에 저장된 모든 데이터를 출력하는 함수(삭제 표시된 노드 제외)
+ * @param table 해쉬 테이블 구조체 객체의 주소(입력, 읽기 전용)
+ * @return 반환값 없음
+ */
+static void JLockFreePrintAll(const JHashTablePtr table)
+{
+	int listIndex = 0;
+	JNodePtr node = NULL;
+	JNodePtr nextNode = NULL;
+
+	printf("------------------\n");
+	for( ; listIndex < table->size; listIndex++)
+	{
+		node = __atomic_load_n(&(table->lockFreeBuckets[listIndex]), __ATOMIC_ACQUIRE);
+		if(node == NULL) continue;
+
+		printf("(%d) [ ", listIndex);
+		for( ; node != NULL; node = JHT_LF_UNMARKED(nextNode))
+		{
+			nextNode = __atomic_load_n(&(node->next), __ATOMIC_ACQUIRE);
+			if(JHT_LF_IS_MARKED(nextNode)) continue;
+			switch(table->valueType)
+			{
+				case IntType:
+					printf("%d ", *((int*)node->data));
+					break;
+				case CharType:
+					printf("%c ", *((char*)node->data));
+					break;
+				case StringType:
+					printf("%s ", ((char*)node->data));
+					break;
+				default: return;
+			}
+		}
+		printf("]\n");
+	}
+	printf("------------------\n");
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Static Functions for Parallel Build
+/// 해쉬값 계산, 구역별 모으기, 구역별 추가의 세 단계를 스레드들이 나누어 처리한다.
+/// 구역 하나는 한 스레드만 맡으므로 추가 단계에서는 잠금을 잡지 않는다.
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static int JHashTableBuildSerial(JHashTablePtr table, void **keys, void **values, int count)
+ * @brief 호출한 스레드에서 데이터들을 순서대로 추가하는 함수(병렬로 적재할 수 없을 때 사용)
+ * NULL 인 키 또는 데이터가 있으면 아무것도 추가하지 않는다.
+ * @param table 해쉬 테이블 구조체 객체의 주소(출력)
+ * @param keys 저장할 키 배열(입력)
+ * @param values 저장할 데이터 배열(입력)
+ * @param count 저장할 데이터 개수(입력)
+ * @return 성공 시 추가된 데이터 개수, 실패 시 HASH_FAIL 반환
+ */
+static int JHashTableBuildSerial(JHashTablePtr table, void **keys, void **values, int count)
+{
+	int pairIndex = 0;
+	for( ; pairIndex < count; pairIndex++)
+	{
+		if((keys[pairIndex] == NULL) || (values[pairIndex] == NULL)) return HASH_FAIL;
+	}
+
+	int addedCount = 0;
+	for(pairIndex = 0; pairIndex < count; pairIndex++)
+	{
+		if(JHashTableInsert(table, keys[pairIndex], values[pairIndex], 1) != NULL) addedCount++;
+		// 이미 저장된 데이터가 아닌데 추가하지 못했으면 메모리 할당 실패
+		else if(JHashTableFindData(table, keys[pairIndex], values[pairIndex]) != FindSuccess) return HASH_FAIL;
+	}
+	return addedCount;
+}
+
+/**
+ * @fn static int JHashTableReserveForBuild(JHashTablePtr table, double expectedCount)
+ * @brief (Chaining) 병렬 적재 전에 진행 중인 재해싱을 마치고, 예상 데이터 개수에 맞게 미리 확장하는 함수
+ * 자동 확장하지 않는 테이블은 확장하지 않으며, 확장할 메모리가 없으면 현재 크기로 적재한다.
+ * @param table 해쉬 테이블 구조체 객체의 주소(출력, 다른 스레드가 사용하지 않는 상태)
+ * @param expectedCount 적재 후 예상 데이터 개수(입력)
+ * @return 성공 시 버킷 개수, 진행 중인 재해싱을 마치지 못하면 HASH_FAIL 반환
+ */
+static int JHashTableReserveForBuild(JHashTablePtr table, double expectedCount)
+{
+	if(JHashTableFinishRehash(table) == HASH_FAIL) return HASH_FAIL;
+
+	int isGrowable = (table->lockStripes == NULL) || (table->cooperativeResize != 0);
+	while((isGrowable != 0) && (table->loadFactor > 0) && (expectedCount > table->loadFactor * (double)table->size))
+	{
+		if(table->cooperativeResize != 0) pthread_rwlock_wrlock(&(table->resizeLock));
+		JHashTableStartRehash(table);
+		if(table->cooperativeResize != 0) pthread_rwlock_unlock(&(table->resizeLock));
+
+		if(table->rehashContainer == NULL) break;
+		if(JHashTableFinishRehash(table) == HASH_FAIL) return HASH_FAIL;
+	}
+
+	return table->size;
+}
+
+/**
+ * @fn static int JHashTableFinishRehash(JHashTablePtr table)
+ * @brief (Chaining) 진행 중인 재해싱의 남은 Slot 들을 모두 옮기는 함수
+ * @param table 해쉬 테이블 구조체 객체의 주소(출력, 다른 스레드가 사용하지 않는 상태)
+ * @return 성공 시 버킷 개수, 메모리 할당 실패로 옮기지 못한 Slot 이 있으면 HASH_FAIL 반환
+ */
+static int JHashTableFinishRehash(JHashTablePtr table)
+{
+	if(table->lockStripes != NULL)
+	{
+		// 모든 Slot 을 맡아 옮긴 후, 메모리 할당 실패로 옮기지 못한 Slot 들을 한 번 더 옮겨본다.
+		JHashTableRehashStep(table, table->size);
+		if(table->rehashContainer != NULL) JHashTableRehashStep(table, table->size);
+		return (table->rehashContainer == NULL) ? table->size : HASH_FAIL;
+	}
+
+	int rehashIndex = 0;
+	while(table->rehashContainer != NULL)
+	{
+		rehashIndex = table->rehashIndex;
+		JHashTableRehashStep(table, JHT_POOL_MAX_SLAB_OBJECTS);
+		if((table->rehashContainer != NULL) && (table->rehashIndex == rehashIndex)) return HASH_FAIL;
+	}
+	return table->size;
+}
+
+/**
+ * @fn static int JHashTableGetBuildPartition(const JBuildJobPtr job, uint64_t hash)
+ * @brief (병렬 적재) 전체 해쉬값의 키를 추가할 구역 위치를 반환하는 함수
+ * 동시 접근 모드에서는 키를 보호하는 잠금, 아니면 키의 버킷이 속한 64 개 버킷 묶음을 연속된 구역들로 나눈다.
+ * @param job 적재 작업 구조체 객체의 주소(입력, 읽기 전용)
+ * @param hash 키의 전체 해쉬값(입력)
+ * @return 항상 구역 위치 반환
+ */
+static int JHashTableGetBuildPartition(const JBuildJobPtr job, uint64_t hash)
+{
+	JHashTablePtr table = job->table;
+	int unitIndex = 0;
+
+	if(table->lockStripes != NULL) unitIndex = (int)(JHashTableGetLockStripe(table, JHashTableGetLockIndex(table, hash)) - table->lockStripes);
+	else unitIndex = JHashTableGetBucketIndex(table, hash, table->size) >> 6;
+	return (int)(((int64_t)unitIndex * job->partitionCount) / job->unitCount);
+}
+
+/**
+ * @fn static void JHashTableRunBuildPhase(JBuildJobPtr job, JBuildWorkerPtr workers, JBuildPhase phase)
+ * @brief (병렬 적재) 모든 스레드에서 한 단계를 실행하고 끝날 때까지 기다리는 함수
+ * 스레드를 생성하지 못하면 그 스레드의 몫은 호출한 스레드에서 실행한다.
+ * @param job 적재 작업 구조체 객체의 주소(출력)
+ * @param workers 스레드별 작업 상태 배열(출력)
+ * @param phase 실행할 단계(입력)
+ * @return 반환값 없음
+ */
+static void JHashTableRunBuildPhase(JBuildJobPtr job, JBuildWorkerPtr workers, JBuildPhase phase)
+{
+	int threadIndex = 1;
+	int *isStarted = (int*)calloc((size_t)job->threadCount, sizeof(int));
+
+	job->phase = phase;
+	for( ; (isStarted != NULL) && (threadIndex < job->threadCount); threadIndex++)
+	{
+		isStarted[threadIndex] = (pthread_create(&(workers[threadIndex].thread), NULL, JHashTableBuildWorker, &(workers[threadIndex])) == 0) ? 1 : 0;
+	}
+
+	JHashTableBuildWorker(&(workers[0]));
+	for(threadIndex = 1; threadIndex < job->threadCount; threadIndex++)
+	{
+		if((isStarted != NULL) && (isStarted[threadIndex] != 0)) pthread_join(workers[threadIndex].thread, NULL);
+		else JHashTableBuildWorker(&(workers[threadIndex]));
+	}
+	free(isStarted);
+}
+
+/**
+ * @fn static void* JHashTableBuildWorker(void *arg)
+ * @brief (병렬 적재) 스레드 하나가 현재 단계의 몫을 처리하는 함수
+ * @param arg 스레드의 작업 상태 구조체 객체의 주소(입력, JBuildWorkerPtr)
+ * @return 항상 NULL 반환
+ */
+static void* JHashTableBuildWorker(void *arg)
+{
+	JBuildWorkerPtr worker = (JBuildWorkerPtr)arg;
+
+	switch(worker->job->phase)
+	{
+		case JBuildHashPhase:
+			JHashTableBuildHash(worker);
+			break;
+		case JBuildScatterPhase:
+			JHashTableBuildScatter(worker);
+			break;
+		case JBuildFillPhase:
+			JHashTableBuildFill(worker);
+			break;
+	}
+	return NULL;
+}
+
+/**
+ * @fn static void JHashTableBuildHash(JBuildWorkerPtr worker)
+ * @brief (병렬 적재) 스레드가 맡은 입력 구간의 해쉬값을 계산하고 구역별 데이터 개수를 세는 함수
+ * @param worker 스레드의 작업 상태 구조체 객체의 주소(출력)
+ * @return 반환값 없음
+ */
+static void JHashTableBuildHash(JBuildWorkerPtr worker)
+{
+	JBuildJobPtr job = worker->job;
+	int pairIndex = (int)(((int64_t)job->pairCount * worker->threadIndex) / job->threadCount);
+	int endIndex = (int)(((int64_t)job->pairCount * (worker->threadIndex + 1)) / job->threadCount);
+	int *partitionCounts = &(job->partitionOffsets[worker->threadIndex * job->partitionCount]);
+
+	for( ; pairIndex < endIndex; pairIndex++)
+	{
+		if((job->keys[pairIndex] == NULL) || (job->values[pairIndex] == NULL))
+		{
+			__atomic_store_n(&(job->isFailed), 1, __ATOMIC_RELAXED);
+			return;
+		}
+		job->hashes[pairIndex] = JHashTableGetFullHash(job->table, job->keys[pairIndex]);
+		partitionCounts[JHashTableGetBuildPartition(job, job->hashes[pairIndex])]++;
+	}
+}
+
+/**
+ * @fn static void JHashTableBuildScatter(JBuildWorkerPtr worker)
+ * @brief (병렬 적재) 스레드가 맡은 입력 구간의 데이터 위치를 구역별 저장 위치에 모으는 함수
+ * @param worker 스레드의 작업 상태 구조체 객체의 주소(출력)
+ * @return 반환값 없음
+ */
+static void JHashTableBuildScatter(JBuildWorkerPtr worker)
+{
+	JBuildJobPtr job = worker->job;
+	int pairIndex = (int)(((int64_t)job->pairCount * worker->threadIndex) / job->threadCount);
+	int endIndex = (int)(((int64_t)job->pairCount * (worker->threadIndex + 1)) / job->threadCount);
+	int *partitionOffsets = &(job->partitionOffsets[worker->threadIndex * job->partitionCount]);
+
+	for( ; pairIndex < endIndex; pairIndex++)
+	{
+		job->order[partitionOffsets[JHashTableGetBuildPartition(job, job->hashes[pairIndex])]++] = pairIndex;
+	}
+}
+
+/**
+ * @fn static void JHashTableBuildFill(JBuildWorkerPtr worker)
+ * @brief (병렬 적재) 아직 맡지 않은 구역을 하나씩 맡아 구역의 데이터들을 입력 순서대로 추가하는 함수
+ * 구역마다 데이터 개수가 달라도 먼저 끝난 스레드가 다음 구역을 맡는다.
+ * @param worker 스레드의 작업 상태 구조체 객체의 주소(출력)
+ * @return 반환값 없음
+ */
+static void JHashTableBuildFill(JBuildWorkerPtr worker)
+{
+	JBuildJobPtr job = worker->job;
+	int partitionIndex = 0;
+	int orderIndex = 0;
+
+	while((partitionIndex = __atomic_fetch_add(&(job->nextPartition), 1, __ATOMIC_RELAXED)) < job->partitionCount)
+	{
+		for(orderIndex = job->partitionStarts[partitionIndex]; orderIndex < job->partitionStarts[partitionIndex + 1]; orderIndex++)
+		{
+			if(JHashTableBuildAdd(worker, job->order[orderIndex]) == HASH_FAIL)
+			{
+				__atomic_store_n(&(job->isFailed), 1, __ATOMIC_RELAXED);
+				return;
+			}
+		}
+		if(__atomic_load_n(&(job->isFailed), __ATOMIC_RELAXED) != 0) return;
+	}
+}
+
+/**
+ * @fn static int JHashTableBuildAdd(JBuildWorkerPtr worker, int pairIndex)
+ * @brief (병렬 적재) 스레드가 맡은 구역의 Slot 에 데이터 하나를 추가하는 함수
+ * 같은 키와 데이터가 이미 저장되어 있으면 추가하지 않는다.
+ * 테이블 전체 메모리 풀을 사용하면 스레드의 메모리 풀에서 할당하고, 연결 리스트에는 테이블 메모리 풀을 기록한다.
+ * @param worker 스레드의 작업 상태 구조체 객체의 주소(출력)
+ * @param pairIndex 추가할 데이터의 입력 위치(입력)
+ * @return 추가하면 1, 이미 저장되어 있으면 0, 메모리 할당에 실패하면 HASH_FAIL 반환
+ */
+static int JHashTableBuildAdd(JBuildWorkerPtr worker, int pairIndex)
+{
+	JHashTablePtr table = worker->job->table;
+	void *key = worker->job->keys[pairIndex];
+	void *value = worker->job->values[pairIndex];
+	uint64_t hash = worker->job->hashes[pairIndex];
+	int listIndex = JHashTableGetBucketIndex(table, hash, table->size);
+	int lockIndex = JHashTableGetLockIndex(table, hash);
+	JLinkedListPtr list = table->listContainer[listIndex];
+
+	if(JHashTableFindNode(table, list, hash, key, value) != NULL) return 0;
+
+	JNodePoolPtr pool = JHashTableGetNodePool(table, lockIndex);
+	JNodePoolPtr allocPool = ((table->lockStripes == NULL) && (pool != NULL)) ? &(worker->pool) : pool;
+	if(list == NULL)
+	{
+		list = JLinkedListNewWithPool(listIndex, allocPool);
+		if(list == NULL) return HASH_FAIL;
+		list->pool = pool;
+		__atomic_store_n(&(table->listContainer[listIndex]), list, __ATOMIC_RELEASE);
+	}
+
+	JNodePtr node = (allocPool != NULL) ? (JNodePtr)JPoolAlloc(&(allocPool->nodes)) : NewJNode();
+	if(node == NULL) return HASH_FAIL;
+	node->key = key;
+	node->data = value;
+	node->hash = hash;
+	JLinkedListLinkNode(list, node);
+	worker->addedCount++;
+
+	if(table->lockStripes != NULL)
+	{
+		JBucketBitmapUpdate(&(table->occupied), list);
+		JHashTableAddCount(table, lockIndex, 1);
+		return 1;
+	}
+
+	// 64 개 버킷 묶음 단위로 구역을 나누므로 bitmap word 는 이 스레드만 변경하며, 검사 범위는 적재 후 합친다.
+	int wordIndex = listIndex >> 6;
+	table->occupied.words[wordIndex] |= 1ULL << (listIndex & 63);
+	if(wordIndex < worker->lowWord) worker->lowWord = wordIndex;
+	if(wordIndex > worker->highWord) worker->highWord = wordIndex;
+	return 1;
+}
+
+/**
+ * @fn static void JPoolMerge(JPoolPtr target, JPoolPtr source)
+ * @brief 메모리 풀의 슬랩들과 반환된 객체들을 다른 메모리 풀로 옮기는 함수
+ * 아직 한 번도 사용하지 않은 객체들은 반환된 객체로 옮기며, 옮긴 후 source 는 빈 메모리 풀이 된다.
+ * @param target 합쳐 받을 메모리 풀 구조체 객체의 주소(출력)
+ * @param source 합칠 메모리 풀 구조체 객체의 주소(출력, 객체 크기가 target 과 같음)
+ * @return 반환값 없음
+ */
+static void JPoolMerge(JPoolPtr target, JPoolPtr source)
+{
+	if(source->slabs == NULL) return;
+
+	void **lastSlab = (void**)source->slabs;
+	while(*lastSlab != NULL) lastSlab = (void**)*lastSlab;
+	*lastSlab = target->slabs;
+	target->slabs = source->slabs;
+
+	// 아직 사용하지 않은 객체는 할당된 적이 없으므로 사용 중인 객체 개수를 바꾸지 않고 반환 목록에 바로 넣는다.
+	for( ; source->remaining > 0; source->remaining--)
+	{
+		*((void**)source->cursor) = target->freeList;
+		target->freeList = source->cursor;
+		source->cursor += source->objectSize;
+	}
+	void *object = source->freeList;
+	void *nextObject = NULL;
+	for( ; object != NULL; object = nextObject)
+	{
+		nextObject = *((void**)object);
+		*((void**)object) = target->freeList;
+		target->freeList = object;
+	}
+
+	target->usedObjects += source->usedObjects;
+	target->slabCount += source->slabCount;
+	if(source->nextSlabObjects > target->nextSlabObjects) target->nextSlabObjects = source->nextSlabObjects;
+	JPoolInit(source, source->objectSize);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Static Functions for Traversal
+/// 재해싱 중 옮겨진 기존 Slot 은 그 Slot 의 데이터를 옮겨 받은 새로운 Slot 2 개로 대신 순회한다.
+/// 2 배로 확장하므로 나머지 연산이면 (i, i + size), 2 의 거듭제곱 버킷이면 (2i, 2i + 1) 위치이다.
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static int JHashTableVisitRange(const JHashTablePtr table, int beginIndex, int endIndex, _jhashVisit_f visitFunc, void *ctx, int *isStopped)
+ * @brief 버킷(슬롯) 범위에 저장된 데이터마다 순회 함수를 호출하는 함수
+ * @param table 해쉬 테이블 구조체 객체의 주소(입력, 읽기 전용)
+ * @param beginIndex 순회할 첫 번째 버킷(슬롯) 위치(입력)
+ * @param endIndex 순회할 마지막 버킷(슬롯) 다음 위치(입력)
+ * @param visitFunc 순회 함수(입력)
+ * @param ctx 순회 함수에 전달할 사용자 데이터(입력)
+ * @param isStopped 순회를 멈췄는지 여부(입력, 출력, 여러 스레드가 함께 사용)
+ * @return 항상 순회 함수를 호출한 횟수 반환
+ */
+static int JHashTableVisitRange(const JHashTablePtr table, int beginIndex, int endIndex, _jhashVisit_f visitFunc, void *ctx, int *isStopped)
+{
+	int visitedCount = 0;
+	int listIndex = beginIndex;
+
+	if(table->storageType == OpenAddressStorage)
+	{
+		for( ; (listIndex < endIndex) && (__atomic_load_n(isStopped, __ATOMIC_RELAXED) == 0); listIndex++)
+		{
+			if(table->ctrlBytes[listIndex] < 0) continue;
+			visitedCount++;
+			if(visitFunc(table->slots[listIndex].key, table->slots[listIndex].data, ctx) != 0) __atomic_store_n(isStopped, 1, __ATOMIC_RELAXED);
+		}
+		return visitedCount;
+	}
+
+	if(table->lockFreeBuckets != NULL)
+	{
+		if(JHashTableEnterEpoch(table) == HASH_FAIL) return 0;
+
+		JNodePtr node = NULL;
+		JNodePtr nextNode = NULL;
+		for( ; (listIndex < endIndex) && (__atomic_load_n(isStopped, __ATOMIC_RELAXED) == 0); listIndex++)
+		{
+			node = __atomic_load_n(&(table->lockFreeBuckets[listIndex]), __ATOMIC_ACQUIRE);
+			for( ; (node != NULL) && (__atomic_load_n(isStopped, __ATOMIC_RELAXED) == 0); node = JHT_LF_UNMARKED(nextNode))
+			{
+				nextNode = __atomic_load_n(&(node->next), __ATOMIC_ACQUIRE);
+				if(JHT_LF_IS_MARKED(nextNode)) continue;
+				visitedCount++;
+				if(visitFunc(node->key, __atomic_load_n(&(node->data), __ATOMIC_ACQUIRE), ctx) != 0) __atomic_store_n(isStopped, 1, __ATOMIC_RELAXED);
+			}
+		}
+
+		JHashTableExitEpoch(table);
+		return visitedCount;
+	}
+
+	for( ; (listIndex < endIndex) && (__atomic_load_n(isStopped, __ATOMIC_RELAXED) == 0); listIndex++)
+	{
+		visitedCount += JHashTableVisitBucket(table, listIndex, visitFunc, ctx, isStopped);
+	}
+	return visitedCount;
+}
+
+/**
+ * @fn static int JHashTableVisitBucket(const JHashTablePtr table, int listIndex, _jhashVisit_f visitFunc, void *ctx, int *isStopped)
+ * @brief (Chaining) 기존 Slot 하나에 저장된 데이터마다 순회 함수를 호출하는 함수
+ * 기존 Slot 과 그 데이터를 옮겨 받는 새로운 Slot 들은 같은 잠금이 보호하므로, 잠금을 잡은 동안 어느 쪽에 있는지 정해진다.
+ * @param table 해쉬 테이블 구조체 객체의 주소(입력, 읽기 전용, 동시 접근 모드의 자동 확장을 사용하면 재해싱 잠금(읽기)을 잡은 상태)
+ * @param listIndex 기존 Slot 위치(입력)
+ * @param visitFunc 순회 함수(입력)
+ * @param ctx 순회 함수에 전달할 사용자 데이터(입력)
+ * @param isStopped 순회를 멈췄는지 여부(입력, 출력)
+ * @return 항상 순회 함수를 호출한 횟수 반환
+ */
+static int JHashTableVisitBucket(const JHashTablePtr table, int listIndex, _jhashVisit_f visitFunc, void *ctx, int *isStopped)
+{
+	int visitedCount = 0;
+	int lockIndex = JHashTableGetBucketLockIndex(table, listIndex, table->size);
+
+	int lockMode = JHashTableLockBucket(table, lockIndex, 0);
+	JLinkedListPtr list = __atomic_load_n(&(table->listContainer[listIndex]), __ATOMIC_ACQUIRE);
+	if((list == JHT_FORWARD_LIST)
+		|| ((table->lockStripes == NULL) && (table->rehashContainer != NULL) && (listIndex < table->rehashIndex)))
+	{
+		JLinkedListPtrContainer rehashContainer = __atomic_load_n(&(table->rehashContainer), __ATOMIC_ACQUIRE);
+		int firstIndex = (table->powerOfTwoBuckets != 0) ? listIndex * 2 : listIndex;
+		int secondIndex = (table->powerOfTwoBuckets != 0) ? firstIndex + 1 : listIndex + table->size;
+		visitedCount = JHashTableVisitList(__atomic_load_n(&(rehashContainer[firstIndex]), __ATOMIC_ACQUIRE), visitFunc, ctx, isStopped);
+		visitedCount += JHashTableVisitList(__atomic_load_n(&(rehashContainer[secondIndex]), __ATOMIC_ACQUIRE), visitFunc, ctx, isStopped);
+	}
+	else
+	{
+		visitedCount = JHashTableVisitList(list, visitFunc, ctx, isStopped);
+	}
+	JHashTableUnlockBucket(table, lockIndex, lockMode);
+
+	return visitedCount;
+}
+
+/**
+ * @fn static int JHashTableVisitList(const JLinkedListPtr list, _jhashVisit_f visitFunc, void *ctx, int *isStopped)
+ * @brief (Chaining) 연결 리스트에 저장된 데이터마다 순회 함수를 호출하는 함수
+ * 잠금 없는 검색에서도 사용하므로 다음 노드 주소는 acquire 로 읽는다.
+ * @param list 연결 리스트 구조체 객체의 주소(입력, 읽기 전용, NULL 허용)
+ * @param visitFunc 순회 함수(입력)
+ * @param ctx 순회 함수에 전달할 사용자 데이터(입력)
+ * @param isStopped 순회를 멈췄는지 여부(입력, 출력)
+ * @return 항상 순회 함수를 호출한 횟수 반환
+ */
+static int JHashTableVisitList(const JLinkedListPtr list, _jhashVisit_f visitFunc, void *ctx, int *isStopped)
+{
+	if(list == NULL) return 0;
+
+	int visitedCount = 0;
+	JNodePtr node = __atomic_load_n(&(list->head->next), __ATOMIC_ACQUIRE);
+	for( ; (node != list->tail) && (__atomic_load_n(isStopped, __ATOMIC_RELAXED) == 0); node = __atomic_load_n(&(node->next), __ATOMIC_ACQUIRE))
+	{
+		visitedCount++;
+		if(visitFunc(node->key, __atomic_load_n(&(node->data), __ATOMIC_ACQUIRE), ctx) != 0) __atomic_store_n(isStopped, 1, __ATOMIC_RELAXED);
+	}
+	return visitedCount;
+}
+
+/**
+ * @fn static void JHashTableVisitTask(void *arg, int taskIndex, int workerIndex)
+ * @brief (병렬 순회) 버킷(슬롯) 묶음 하나를 순회하는 작업 함수
+ * 작업 풀이 생성한 스레드는 epoch 기반 해제를 사용하는 테이블의 검색 상태를 작업 단위마다 반환한다.
+ * @param arg 순회 작업 구조체 객체의 주소(입력, JVisitJobPtr)
+ * @param taskIndex 버킷 묶음 위치(입력)
+ * @param workerIndex 작업을 처리하는 스레드 위치(입력)
+ * @return 반환값 없음
+ */
+static void JHashTableVisitTask(void *arg, int taskIndex, int workerIndex)
+{
+	JVisitJobPtr job = (JVisitJobPtr)arg;
+	int beginIndex = taskIndex * JHT_FOREACH_CHUNK_BUCKETS;
+	int endIndex = (job->bucketCount - beginIndex > JHT_FOREACH_CHUNK_BUCKETS) ? beginIndex + JHT_FOREACH_CHUNK_BUCKETS : job->bucketCount;
+
+	if(__atomic_load_n(&(job->isStopped), __ATOMIC_RELAXED) != 0) return;
+	int visitedCount = JHashTableVisitRange(job->table, beginIndex, endIndex, job->visitFunc, job->ctx, &(job->isStopped));
+	__atomic_fetch_add(&(job->visitedCount), visitedCount, __ATOMIC_RELAXED);
+
+	if((workerIndex != 0) && ((job->table->lockFreeRead != 0) || (job->table->lockFreeBuckets != NULL)))
+	{
+		JHashTableReleaseThread(job->table);
+	}
+}
+
+/**
+ * @fn static void JHashTableClearContainer(JLinkedListPtrContainer container, JBucketBitmapPtr bitmap)
+ * @brief (Chaining) Slot 배열에서 데이터가 있는 연결 리스트들을 비우는 함수
+ * 연결 리스트와 Head/Tail 노드는 남겨 두고, 데이터 노드는 메모리 풀에 반환(메모리 풀을 사용하지 않으면 해제)한다.
+ * @param container Slot 배열의 주소(출력)
+ * @param bitmap Slot 배열의 bitmap(출력)
+ * @return 반환값 없음
+ */
+static void JHashTableClearContainer(JLinkedListPtrContainer container, JBucketBitmapPtr bitmap)
+{
+	int listIndex = 0;
+	JLinkedListPtr list = NULL;
+	JNodePtr node = NULL;
+	JNodePtr nextNode = NULL;
+
+	while((listIndex = JBucketBitmapFindNext(bitmap, listIndex)) >= 0)
+	{
+		list = container[listIndex];
+		if((list != NULL) && (list != JHT_FORWARD_LIST))
+		{
+			for(node = list->head->next; node != list->tail; node = nextNode)
+			{
+				nextNode = node->next;
+				JLinkedListFreeNode(list, node);
+			}
+			list->head->next = list->tail;
+			list->tail->prev = list->head;
+			list->size = 0;
+		}
+		listIndex++;
+	}
+
+	JBucketBitmapClear(bitmap);
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Static Functions for Iterator
+/// 순회 커서는 (Slot 배열, 버킷 위치, 노드) 로 현재 위치를 나타내며, 다음 버킷은 bitmap 으로 찾는다.
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static int JHashTableIterSeek(JHashTableIterPtr iter, int containerIndex, int listIndex)
+ * @brief 지정한 Slot 배열의 버킷(슬롯) 위치부터 데이터가 있는 첫 번째 위치로 순회 커서를 옮기는 함수
+ * 재해싱 중에 옮겨진 기존 Slot 은 bitmap 에서 지워지므로 bitmap 이 가리키는 버킷만 검사하면 된다.
+ * @param iter 순회 커서 구조체 객체의 주소(출력)
+ * @param containerIndex 검사를 시작할 Slot 배열(입력, 0 이면 기존 Slot 배열, 1 이면 새로운 Slot 배열)
+ * @param listIndex 검사를 시작할 버킷(슬롯) 위치(입력)
+ * @return 데이터를 찾으면 1, 순회가 끝났으면 0 반환
+ */
+static int JHashTableIterSeek(JHashTableIterPtr iter, int containerIndex, int listIndex)
+{
+	JHashTablePtr table = iter->table;
+	JNodePtr node = NULL;
+	iter->node = NULL;
+	iter->list = NULL;
+
+	if(table->storageType == OpenAddressStorage)
+	{
+		int position = listIndex & ~(JHT_GROUP_SIZE - 1);
+		unsigned int matches = 0;
+
+		if(position < table->size) matches = JSwissMatchFull(table->ctrlBytes + position) & (~0U << (listIndex - position));
+		while(matches == 0)
+		{
+			position += JHT_GROUP_SIZE;
+			if(position >= table->size)
+			{
+				iter->listIndex = HASH_FAIL;
+				return 0;
+			}
+			matches = JSwissMatchFull(table->ctrlBytes + position);
+		}
+		iter->listIndex = position + __builtin_ctz(matches);
+		return 1;
+	}
+
+	if(table->lockFreeBuckets != NULL)
+	{
+		while((listIndex = JBucketBitmapFindNext(&(table->occupied), listIndex)) >= 0)
+		{
+			node = JHashTableIterSkipMarked(__atomic_load_n(&(table->lockFreeBuckets[listIndex]), __ATOMIC_ACQUIRE));
+			if(node != NULL)
+			{
+				iter->listIndex = listIndex;
+				iter->node = node;
+				return 1;
+			}
+			listIndex++;
+		}
+		iter->listIndex = HASH_FAIL;
+		return 0;
+	}
+
+	JLinkedListPtrContainer container = NULL;
+	JLinkedListPtr list = NULL;
+	JLinkedListPtr aheadList = NULL;
+	int containerSize = 0;
+	for( ; containerIndex < 2; containerIndex++, listIndex = 0)
+	{
+		iter->containerIndex = containerIndex;
+		container = JHashTableIterGetContainer(iter);
+		if(container == NULL) continue;
+		containerSize = (containerIndex == 0) ? table->size : table->rehashSize;
+
+		while((listIndex = JBucketBitmapFindNext(JHashTableGetBitmap(table, container), listIndex)) >= 0)
+		{
+			list = __atomic_load_n(&(container[listIndex]), __ATOMIC_ACQUIRE);
+			if((list != NULL) && (list != JHT_FORWARD_LIST) && (list->head->next != list->tail))
+			{
+				// 연결 리스트 -> Head -> 첫 노드 순서로 따라가야 하므로, 앞쪽 버킷의 연결 리스트와 Head 를 미리 읽어 둔다.
+				if(listIndex + 2 * JHT_ITER_PREFETCH_BUCKETS < containerSize)
+				{
+					aheadList = container[listIndex + 2 * JHT_ITER_PREFETCH_BUCKETS];
+					if((aheadList != NULL) && (aheadList != JHT_FORWARD_LIST)) __builtin_prefetch(aheadList);
+					aheadList = container[listIndex + JHT_ITER_PREFETCH_BUCKETS];
+					if((aheadList != NULL) && (aheadList != JHT_FORWARD_LIST)) __builtin_prefetch(aheadList->head);
+				}
+				iter->listIndex = listIndex;
+				iter->list = list;
+				iter->node = list->head->next;
+				return 1;
+			}
+			listIndex++;
+		}
+	}
+
+	iter->listIndex = HASH_FAIL;
+	return 0;
 }
 
 /**
- * @fn static int HashChar(char key, int hashSize)
- * @brief char 형 문자를 해쉬 테이블의 크기로 해싱한 값을 반환하는 함수
- * @param key 해싱할 char 형 문자(입력)
- * @param hashSize 해쉬 테이블의 전체 크기(입력)
- * @return 항상 해싱된 값 반환
+ * @fn static JLinkedListPtrContainer JHashTableIterGetContainer(const JHashTableIterPtr iter)
+ * @brief (Chaining) 순회 커서가 가리키는 Slot 배열을 반환하는 함수
+ * @param iter 순회 커서 구조체 객체의 주소(입력, 읽기 전용)
+ * @return 성공 시 Slot 배열의 주소, 재해싱 중이 아니면 새로운 Slot 배열은 NULL 반환
  */
-static int HashChar(char key, int hashSize)
+static JLinkedListPtrContainer JHashTableIterGetContainer(const JHashTableIterPtr iter)
 {
-	int value = 0;
-	int hashIndex = 1;
-	for( ; hashIndex <= (int)key; hashIndex++)
+	if(iter->containerIndex == 0) return iter->table->listContainer;
+	return iter->table->rehashContainer;
+}
+
+/**
+ * @fn static JNodePtr JHashTableIterSkipMarked(JNodePtr node)
+ * @brief (LockFree) 지정한 노드부터 삭제 표시되지 않은 첫 번째 노드를 찾는 함수
+ * @param node 검사를 시작할 노드의 주소(입력, NULL 허용)
+ * @return 성공 시 노드의 주소, 없으면 NULL 반환
+ */
+static JNodePtr JHashTableIterSkipMarked(JNodePtr node)
+{
+	JNodePtr nextNode = NULL;
+	for( ; node != NULL; node = JHT_LF_UNMARKED(nextNode))
+	{
+		nextNode = __atomic_load_n(&(node->next), __ATOMIC_ACQUIRE);
+		if(JHT_LF_IS_MARKED(nextNode) == 0) return node;
+	}
+	return NULL;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Static Functions for Work Pool
+/// 작업 단위 범위를 스레드 개수로 나누어 스레드마다 나누어 준 후, 자신의 범위를 모두 처리한 스레드는
+/// 다른 스레드의 남은 범위 뒤쪽 절반을 CAS 로 가져와 처리한다. 모든 범위가 비면 작업이 끝난다.
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static void JWorkPoolRun(JWorkPoolPtr pool, int taskCount, _jworkTask_f taskFunc, void *taskArg)
+ * @brief 작업 단위 taskCount 개를 작업 풀의 스레드들이 나누어 처리하고, 모두 끝날 때까지 기다리는 함수
+ * @param pool 작업 풀 구조체 객체의 주소(출력)
+ * @param taskCount 작업 단위 개수(입력)
+ * @param taskFunc 작업 단위 하나를 처리하는 함수(입력)
+ * @param taskArg 작업 인자(입력)
+ * @return 반환값 없음
+ */
+static void JWorkPoolRun(JWorkPoolPtr pool, int taskCount, _jworkTask_f taskFunc, void *taskArg)
+{
+	if(taskCount <= 0) return;
+
+	int threadIndex = 0;
+	uint64_t beginIndex = 0;
+	uint64_t endIndex = 0;
+	for( ; threadIndex < pool->threadCount; threadIndex++)
 	{
-		value += (hashIndex * (int)key);
+		beginIndex = (uint64_t)(((int64_t)taskCount * threadIndex) / pool->threadCount);
+		endIndex = (uint64_t)(((int64_t)taskCount * (threadIndex + 1)) / pool->threadCount);
+		__atomic_store_n(&(pool->queues[threadIndex].range), (endIndex << 32) | beginIndex, __ATOMIC_RELAXED);
 	}
-	return value % hashSize;
+
+	pthread_mutex_lock(&(pool->mutex));
+	pool->taskFunc = taskFunc;
+	pool->taskArg = taskArg;
+	pool->busyCount = pool->threadCount - 1;
+	pool->generation++;
+	pthread_cond_broadcast(&(pool->startCond));
+	pthread_mutex_unlock(&(pool->mutex));
+
+	JWorkPoolRunTasks(pool, 0);
+
+	pthread_mutex_lock(&(pool->mutex));
+	while(pool->busyCount > 0) pthread_cond_wait(&(pool->doneCond), &(pool->mutex));
+	pthread_mutex_unlock(&(pool->mutex));
 }
 
 /**
- * @fn static int HashString(const char* key, int hashSize)
- * @brief char* 형 문자열을 해쉬 테이블의 크기로 해싱한 값을 반환하는 함수
- * @param key 해싱할 char* 형 문자열(입력, 읽기 전용)
- * @param hashSize 해쉬 테이블의 전체 크기(입력)
- * @return 항상 해싱된 값 반환
+ * @fn static void* JWorkPoolThread(void *arg)
+ * @brief 작업 풀이 생성한 스레드의 함수
+ * 새로운 작업이 요청될 때까지 대기하고, 작업을 처리한 후 완료를 알린다.
+ * @param arg 스레드의 작업 단위 범위 구조체 객체의 주소(입력, JWorkQueuePtr)
+ * @return 항상 NULL 반환
  */
-static int HashString(const char* key, int hashSize)
+static void* JWorkPoolThread(void *arg)
 {
-	int value = 0;
-	int hashIndex = 1;
-	int strLength = strlen(key);
-	for( ; hashIndex <= strLength; hashIndex++)
+	JWorkQueuePtr queue = (JWorkQueuePtr)arg;
+	JWorkPoolPtr pool = queue->pool;
+	uint64_t generation = 0;
+
+	while(1)
+	{
+		pthread_mutex_lock(&(pool->mutex));
+		while((pool->isStopping == 0) && (pool->generation == generation)) pthread_cond_wait(&(pool->startCond), &(pool->mutex));
+		if(pool->isStopping != 0)
+		{
+			pthread_mutex_unlock(&(pool->mutex));
+			break;
+		}
+		generation = pool->generation;
+		pthread_mutex_unlock(&(pool->mutex));
+
+		JWorkPoolRunTasks(pool, queue->workerIndex);
+
+		pthread_mutex_lock(&(pool->mutex));
+		if(--(pool->busyCount) == 0) pthread_cond_signal(&(pool->doneCond));
+		pthread_mutex_unlock(&(pool->mutex));
+	}
+
+	return NULL;
+}
+
+/**
+ * @fn static void JWorkPoolRunTasks(JWorkPoolPtr pool, int workerIndex)
+ * @brief 스레드가 자신의 범위와 다른 스레드에서 가져온 범위의 작업 단위들을 모두 처리하는 함수
+ * @param pool 작업 풀 구조체 객체의 주소(출력)
+ * @param workerIndex 스레드 위치(입력)
+ * @return 반환값 없음
+ */
+static void JWorkPoolRunTasks(JWorkPoolPtr pool, int workerIndex)
+{
+	int taskIndex = 0;
+	int oldWorkerIndex = jhtWorkerIndex;
+
+	jhtWorkerIndex = workerIndex;
+	while(1)
+	{
+		taskIndex = JWorkQueuePop(&(pool->queues[workerIndex]));
+		if(taskIndex >= 0)
+		{
+			pool->taskFunc(pool->taskArg, taskIndex, workerIndex);
+			continue;
+		}
+		if(JWorkPoolSteal(pool, workerIndex) == HASH_FAIL) break;
+	}
+	jhtWorkerIndex = oldWorkerIndex;
+}
+
+/**
+ * @fn static int JWorkQueuePop(JWorkQueuePtr queue)
+ * @brief 작업 단위 범위의 첫 번째 작업 단위를 가져가는 함수
+ * @param queue 작업 단위 범위 구조체 객체의 주소(출력)
+ * @return 성공 시 작업 단위 위치, 범위가 비어 있으면 HASH_FAIL 반환
+ */
+static int JWorkQueuePop(JWorkQueuePtr queue)
+{
+	uint64_t range = __atomic_load_n(&(queue->range), __ATOMIC_ACQUIRE);
+	uint64_t beginIndex = 0;
+
+	while((beginIndex = (range & 0xFFFFFFFFULL)) < (range >> 32))
+	{
+		if(__atomic_compare_exchange_n(&(queue->range), &range, range + 1, 1, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE) != 0)
+		{
+			return (int)beginIndex;
+		}
+	}
+	return HASH_FAIL;
+}
+
+/**
+ * @fn static int JWorkPoolSteal(JWorkPoolPtr pool, int workerIndex)
+ * @brief 다른 스레드의 남은 작업 단위 범위에서 뒤쪽 절반을 가져와 자신의 범위로 저장하는 함수
+ * 자신의 범위가 비어 있을 때만 호출하므로, 가져온 범위는 다른 스레드가 다시 가져갈 수 있도록 원자적으로 저장한다.
+ * 가져온 범위는 다른 스레드의 범위에서 빠졌으므로 같은 작업 단위를 두 스레드가 처리하지 않는다.
+ * @param pool 작업 풀 구조체 객체의 주소(출력)
+ * @param workerIndex 가져오는 스레드 위치(입력)
+ * @return 성공 시 가져온 작업 단위 개수, 모든 범위가 비어 있으면 HASH_FAIL 반환
+ */
+static int JWorkPoolSteal(JWorkPoolPtr pool, int workerIndex)
+{
+	int offset = 1;
+	uint64_t range = 0;
+	uint64_t beginIndex = 0;
+	uint64_t endIndex = 0;
+	uint64_t stealCount = 0;
+	JWorkQueuePtr victim = NULL;
+
+	for( ; offset < pool->threadCount; offset++)
+	{
+		victim = &(pool->queues[(workerIndex + offset) % pool->threadCount]);
+		range = __atomic_load_n(&(victim->range), __ATOMIC_ACQUIRE);
+		while((beginIndex = (range & 0xFFFFFFFFULL)) < (endIndex = (range >> 32)))
+		{
+			stealCount = (endIndex - beginIndex + 1) / 2;
+			if(__atomic_compare_exchange_n(&(victim->range), &range, ((endIndex - stealCount) << 32) | beginIndex, 1, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE) != 0)
+			{
+				__atomic_store_n(&(pool->queues[workerIndex].range), (endIndex << 32) | (endIndex - stealCount), __ATOMIC_RELEASE);
+				return (int)stealCount;
+			}
+		}
+	}
+	return HASH_FAIL;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Static Functions for Insert Buffer
+/// 잠금 그룹 하나의 데이터를 그 그룹의 쓰기 잠금 한 번 안에서 모두 추가한다.
+/// 재해싱 돕기와 확장 검사는 잠금 밖에서 그룹 단위로 처리한다.
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static int JInsertBufferFlushEntries(JInsertBufferPtr buffer, int isDelayed)
+ * @brief 쓰기 버퍼에 모아 둔 데이터를 테이블에 추가하고 통계를 갱신하는 함수
+ * 이미 저장되어 있어서 추가하지 않은 데이터와 메모리 할당 실패로 추가하지 못한 데이터를 구분하고, 실패한 데이터만 버퍼에 남긴다.
+ * @param buffer 쓰기 버퍼 구조체 객체의 주소(출력)
+ * @param isDelayed 최대 대기 시간을 넘어서 비우는지 여부(입력)
+ * @return 성공 시 테이블에 추가된 데이터 개수, 실패 시 HASH_FAIL 반환
+ */
+static int JInsertBufferFlushEntries(JInsertBufferPtr buffer, int isDelayed)
+{
+	if(buffer->entryCount == 0) return 0;
+
+	JHashTablePtr table = buffer->table;
+	uint64_t startNs = JInsertBufferGetNowNs();
+	int insertedCount = 0;
+	int failedCount = 0;
+	int entryIndex = 0;
+	JBufferEntryPtr entry = NULL;
+
+	if(buffer->groupHeads == NULL)
+	{
+		for( ; entryIndex < buffer->entryCount; entryIndex++)
+		{
+			entry = &(buffer->entries[entryIndex]);
+			if(JHashTableInsert(table, entry->key, entry->value, 1) != NULL) insertedCount++;
+			// 이미 저장된 데이터가 아닌데 추가하지 못했으면 메모리 할당 실패
+			else if(JHashTableFindData(table, entry->key, entry->value) != FindSuccess)
+			{
+				entry->next = JHT_BUFFER_RETRY;
+				failedCount++;
+			}
+		}
+	}
+	else
+	{
+		int usedIndex = 0;
+		int groupIndex = 0;
+		int nextIndex = 0;
+		int result = 0;
+		int count = 0;
+		int groupInserted = 0;
+
+		for( ; usedIndex < buffer->usedGroupCount; usedIndex++)
+		{
+			groupIndex = buffer->usedGroups[usedIndex];
+			entryIndex = buffer->groupHeads[groupIndex];
+
+			// 데이터 하나마다 돕던 만큼의 재해싱을 그룹 단위로 한 번에 돕는다.
+			JHashTableRehashStep(table, JHT_REHASH_STEP * buffer->groupSizes[groupIndex]);
+
+			count = 0;
+			groupInserted = 0;
+			JHashTableLockBucket(table, buffer->entries[entryIndex].lockIndex, 1);
+			for( ; entryIndex >= 0; entryIndex = nextIndex)
+			{
+				entry = &(buffer->entries[entryIndex]);
+				nextIndex = entry->next;
+				result = JHashTableInsertLocked(table, entry->key, entry->value, entry->hash, entry->lockIndex, 1, &count);
+				if(result == 1) groupInserted++;
+				else if(result == HASH_FAIL)
+				{
+					entry->next = JHT_BUFFER_RETRY;
+					failedCount++;
+				}
+			}
+			JHashTableUnlockBucket(table, buffer->entries[buffer->groupHeads[groupIndex]].lockIndex, 1);
+			buffer->stats.lockCount++;
+
+			if(groupInserted > 0) JHashTableCheckGrowth(table, count, groupInserted);
+			insertedCount += groupInserted;
+
+			buffer->groupHeads[groupIndex] = -1;
+			buffer->groupSizes[groupIndex] = 0;
+		}
+		buffer->usedGroupCount = 0;
+	}
+
+	uint64_t endNs = JInsertBufferGetNowNs();
+	uint64_t flushNs = endNs - startNs;
+	uint64_t delayNs = startNs - buffer->firstAddNs;
+
+	buffer->stats.flushCount++;
+	if(isDelayed != 0) buffer->stats.delayFlushCount++;
+	buffer->stats.insertedCount += (uint64_t)insertedCount;
+	buffer->stats.totalFlushNs += flushNs;
+	if(flushNs > buffer->stats.maxFlushNs) buffer->stats.maxFlushNs = flushNs;
+	if(delayNs > buffer->stats.maxDelayNs) buffer->stats.maxDelayNs = delayNs;
+
+	if(failedCount == 0)
+	{
+		buffer->entryCount = 0;
+		return insertedCount;
+	}
+	JInsertBufferKeepFailed(buffer);
+	return HASH_FAIL;
+}
+
+/**
+ * @fn static void JInsertBufferLinkEntry(JInsertBufferPtr buffer, int entryIndex)
+ * @brief 모아 둔 데이터를 잠금 그룹의 마지막에 연결하는 함수
+ * @param buffer 쓰기 버퍼 구조체 객체의 주소(출력)
+ * @param entryIndex 연결할 데이터 위치(입력, lockIndex 를 계산하고 next 가 -1 인 상태)
+ * @return 반환값 없음
+ */
+static void JInsertBufferLinkEntry(JInsertBufferPtr buffer, int entryIndex)
+{
+	JHashTablePtr table = buffer->table;
+	int groupIndex = (buffer->entries[entryIndex].lockIndex >> table->lockStripeShift) & (table->lockStripeCount - 1);
+	if(buffer->groupHeads[groupIndex] < 0)
+	{
+		buffer->groupHeads[groupIndex] = entryIndex;
+		buffer->usedGroups[buffer->usedGroupCount++] = groupIndex;
+	}
+	else buffer->entries[buffer->groupTails[groupIndex]].next = entryIndex;
+	buffer->groupTails[groupIndex] = entryIndex;
+	buffer->groupSizes[groupIndex]++;
+}
+
+/**
+ * @fn static void JInsertBufferKeepFailed(JInsertBufferPtr buffer)
+ * @brief 비우는 중 추가하지 못한 데이터(JHT_BUFFER_RETRY 표시)만 버퍼 앞쪽으로 모으고 잠금 그룹에 다시 연결하는 함수
+ * 처음 모아 둔 시각은 바꾸지 않으므로, 최대 대기 시간이 지났으면 다음 추가 시 다시 비운다.
+ * @param buffer 쓰기 버퍼 구조체 객체의 주소(출력, 비운 후 잠금 그룹이 모두 비어 있는 상태)
+ * @return 반환값 없음
+ */
+static void JInsertBufferKeepFailed(JInsertBufferPtr buffer)
+{
+	int keptCount = 0;
+	int entryIndex = 0;
+	for( ; entryIndex < buffer->entryCount; entryIndex++)
+	{
+		if(buffer->entries[entryIndex].next != JHT_BUFFER_RETRY) continue;
+
+		buffer->entries[keptCount] = buffer->entries[entryIndex];
+		buffer->entries[keptCount].next = -1;
+		if(buffer->groupHeads != NULL) JInsertBufferLinkEntry(buffer, keptCount);
+		keptCount++;
+	}
+	buffer->entryCount = keptCount;
+}
+
+/**
+ * @fn static uint64_t JInsertBufferGetNowNs(void)
+ * @brief 쓰기 버퍼의 대기 시간과 비우기 시간을 재는 단조 증가 시각을 반환하는 함수
+ * @return 현재 시각(ns)
+ */
+static uint64_t JInsertBufferGetNowNs(void)
+{
+	struct timespec now;
+	clock_gettime(CLOCK_MONOTONIC, &now);
+	return (uint64_t)now.tv_sec * 1000000000ULL + (uint64_t)now.tv_nsec;
+}
+
+////////////////////////////////////////////////////////////////////////////////
+/// Static Functions for Batch Find
+/// 키 묶음 하나를 4 단계로 prefetch 한다(거리 d).
+/// Slot(4d 앞) -> 연결 리스트 구조체(3d 앞) -> Head 노드(2d 앞) -> 첫 노드(d 앞) -> 검색
+/// 연결 리스트는 한 번 생성되면 Slot 배열이 바뀌기 전까지 해제되지 않고 Head 노드도 바뀌지 않으므로,
+/// 재해싱이 진행되지 않는 동안(묶음 시작 전에 재해싱을 돕고, 동시 접근 모드는 cooperativeResize 가 아닐 때)
+/// 잠금 없이 읽은 주소로 prefetch 하고 검색할 Slot 위치도 다시 계산하지 않는다.
+////////////////////////////////////////////////////////////////////////////////
+
+/**
+ * @fn static int JHashTableFindChunk(const JHashTablePtr table, void **keys, void **values, FindResult *results, int count)
+ * @brief 키 묶음 하나(최대 JHT_FIND_BATCH_SIZE 개)를 검색하는 함수
+ * @param table 해쉬 테이블 구조체 객체의 주소(입력, 읽기 전용)
+ * @param keys 검색할 키 배열(입력)
+ * @param values 검색할 데이터 배열(입력, NULL 이면 키만 검색)
+ * @param results 키별 검색 결과를 저장할 배열(출력)
+ * @param count 키 개수(입력, 1 ~ JHT_FIND_BATCH_SIZE)
+ * @return 찾은 키 개수
+ */
+static int JHashTableFindChunk(const JHashTablePtr table, void **keys, void **values, FindResult *results, int count)
+{
+	uint64_t hashes[JHT_FIND_BATCH_SIZE];
+	JLinkedListPtr *slots[JHT_FIND_BATCH_SIZE];
+	JLinkedListPtr lists[JHT_FIND_BATCH_SIZE];
+	int distance = __atomic_load_n(&(table->prefetchDistance), __ATOMIC_RELAXED);
+	int foundCount = 0;
+	int keyIndex = 0;
+	int step = 0;
+	int listIndex = 0;
+	int lockIndex = 0;
+	int lockMode = 0;
+	void *value = NULL;
+	JNodePtr node = NULL;
+	JLinkedListPtr list = NULL;
+	JLinkedListPtrContainer container = NULL;
+
+	if(table->lockFreeBuckets != NULL)
+	{
+		for( ; keyIndex < count; keyIndex++)
+		{
+			value = (values == NULL) ? NULL : values[keyIndex];
+			results[keyIndex] = ((keys[keyIndex] != NULL) && (JLockFreeGet(table, keys[keyIndex], value) != NULL)) ? FindSuccess : FindFail;
+			if(results[keyIndex] == FindSuccess) foundCount++;
+		}
+		return foundCount;
+	}
+
+	if(table->storageType == OpenAddressStorage)
+	{
+		for(keyIndex = 0; keyIndex < count; keyIndex++)
+		{
+			if(keys[keyIndex] != NULL) hashes[keyIndex] = JSwissGetHash(table, keys[keyIndex]);
+		}
+		for(keyIndex = 0; keyIndex < count; keyIndex++)
+		{
+			if((distance > 0) && (keyIndex + distance < count) && (keys[keyIndex + distance] != NULL))
+			{
+				listIndex = (int)((hashes[keyIndex + distance] >> 7) & (uint64_t)(table->size - 1));
+				__builtin_prefetch(&(table->ctrlBytes[listIndex]));
+				__builtin_prefetch(&(table->slots[listIndex]));
+			}
+			value = (values == NULL) ? NULL : values[keyIndex];
+			results[keyIndex] = ((keys[keyIndex] != NULL) && (JSwissFindSlot(table, hashes[keyIndex], keys[keyIndex], value) >= 0)) ? FindSuccess : FindFail;
+			if(results[keyIndex] == FindSuccess) foundCount++;
+		}
+		return foundCount;
+	}
+
+	// 검색 하나마다 돕던 만큼의 재해싱을 묶음 시작 전에 한 번에 돕는다.
+	JHashTableRehashStep(table, JHT_REHASH_STEP * count);
+	if(table->cooperativeResize != 0) distance = 0;
+
+	JHashTableHashKeys(table, keys, hashes, count);
+
+	for(step = 0; step < count + distance * 4; step++)
 	{
-		value += (hashIndex * key[hashIndex]);
+		if(distance > 0)
+		{
+			// 1 단계 : Slot
+			keyIndex = step;
+			if(keyIndex < count)
+			{
+				slots[keyIndex] = NULL;
+				lists[keyIndex] = NULL;
+				if(keys[keyIndex] != NULL)
+				{
+					container = JHashTableLocateList(table, hashes[keyIndex], &listIndex);
+					slots[keyIndex] = &(container[listIndex]);
+					__builtin_prefetch(slots[keyIndex]);
+				}
+			}
+			// 2 단계 : 연결 리스트 구조체
+			keyIndex = step - distance;
+			if((keyIndex >= 0) && (keyIndex < count) && (slots[keyIndex] != NULL))
+			{
+				lists[keyIndex] = __atomic_load_n(slots[keyIndex], __ATOMIC_ACQUIRE);
+				if(lists[keyIndex] != NULL) __builtin_prefetch(lists[keyIndex]);
+			}
+			// 3 단계 : Head 노드
+			keyIndex = step - distance * 2;
+			if((keyIndex >= 0) && (keyIndex < count) && (lists[keyIndex] != NULL)) __builtin_prefetch(lists[keyIndex]->head);
+			// 4 단계 : 첫 노드
+			keyIndex = step - distance * 3;
+			if((keyIndex >= 0) && (keyIndex < count) && (lists[keyIndex] != NULL))
+			{
+				__builtin_prefetch(__atomic_load_n(&(lists[keyIndex]->head->next), __ATOMIC_RELAXED));
+			}
+		}
+
+		keyIndex = step - distance * 4;
+		if(keyIndex < 0) continue;
+
+		results[keyIndex] = FindFail;
+		if(keys[keyIndex] == NULL) continue;
+
+		value = (values == NULL) ? NULL : values[keyIndex];
+		lockIndex = JHashTableGetLockIndex(table, hashes[keyIndex]);
+		lockMode = JHashTableLockBucket(table, lockIndex, 0);
+		if(distance > 0)
+		{
+			list = __atomic_load_n(slots[keyIndex], __ATOMIC_ACQUIRE);
+		}
+		else
+		{
+			container = JHashTableLocateList(table, hashes[keyIndex], &listIndex);
+			list = __atomic_load_n(&(container[listIndex]), __ATOMIC_ACQUIRE);
+		}
+		node = JHashTableFindNode(table, list, hashes[keyIndex], keys[keyIndex], value);
+		JHashTableUnlockBucket(table, lockIndex, lockMode);
+
+		if(node != NULL)
+		{
+			results[keyIndex] = FindSuccess;
+			foundCount++;
+		}
 	}
-	return value % hashSize;
+
+	return foundCount;
 }
 
+////////////////////////////////////////////////////////////////////////////////
+/// Static Functions for Batch Add
+/// 데이터 묶음 하나의 해쉬값을 먼저 모두 계산하고, 버킷(동시 접근 모드는 잠금 그룹)별로 묶는다.
+/// 묶음별로 연결 리스트(또는 잠금)를 한 번만 찾고, bitmap 과 데이터 개수도 묶음마다 한 번 갱신한다.
+////////////////////////////////////////////////////////////////////////////////
+
 /**
- * @fn static int JHashTableGetHash(const JHashTablePtr table, void *key)
- * @brief 해쉬 테이블의 해쉬 유형에 따라 지정한 키에 대한 해쉬값을 반환하는 함수 
+ * @fn static void JHashTableHashKeys(const JHashTablePtr table, void **keys, uint64_t *hashes, int count)
+ * @brief 키 배열의 전체 해쉬값을 키 유형별 반복문으로 계산하는 함수(JHashTableGetFullHash 참고)
+ * 키 유형 분기는 반복문 밖에서 한 번만 하고, 기본 해싱 함수는 직접 호출해 반복문 안에 펼쳐지도록 한다.
  * @param table 해쉬 테이블 구조체 객체의 주소(입력, 읽기 전용)
- * @param key 해싱할 키(입력)
- * @return 성공 시 해쉬값, 실패 시 HASH_FAIL 반환(매크로 선언 참고)
+ * @param keys 해싱할 키 배열(입력, NULL 인 키는 건너뜀)
+ * @param hashes 전체 해쉬값을 저장할 배열(출력)
+ * @param count 키 개수(입력)
+ * @return 반환값 없음
  */
-static int JHashTableGetHash(const JHashTablePtr table, void *key)
+static void JHashTableHashKeys(const JHashTablePtr table, void **keys, uint64_t *hashes, int count)
 {
-	int hash = 0;
-	int tableSize = table->size;
+	uint64_t seed = table->hashSeed;
+	int keyIndex = 0;
 
 	switch(table->keyType)
 	{
 		case IntType:
-			hash = table->intHashFunc(*((int*)key), tableSize);
+			if(table->intHashFunc == JHashIntMix)
+			{
+				for( ; keyIndex < count; keyIndex++)
+				{
+					if(keys[keyIndex] != NULL) hashes[keyIndex] = JHashIntMix(*((const int*)keys[keyIndex]), seed);
+				}
+			}
+			else
+			{
+				for( ; keyIndex < count; keyIndex++)
+				{
+					if(keys[keyIndex] != NULL) hashes[keyIndex] = table->intHashFunc(*((const int*)keys[keyIndex]), seed);
+				}
+			}
 			break;
 		case CharType:
-			hash = table->charHashFunc(*((char*)key), tableSize);
+			if(table->charHashFunc == JHashCharMix)
+			{
+				for( ; keyIndex < count; keyIndex++)
+				{
+					if(keys[keyIndex] != NULL) hashes[keyIndex] = JHashCharMix(*((const char*)keys[keyIndex]), seed);
+				}
+			}
+			else
+			{
+				for( ; keyIndex < count; keyIndex++)
+				{
+					if(keys[keyIndex] != NULL) hashes[keyIndex] = table->charHashFunc(*((const char*)keys[keyIndex]), seed);
+				}
+			}
 			break;
 		case StringType:
-			hash = table->stringHashFunc((char*)key, tableSize);
+			if(table->stringHashFunc == JHashStringWy)
+			{
+				for( ; keyIndex < count; keyIndex++)
+				{
+					if(keys[keyIndex] != NULL) hashes[keyIndex] = JHashStringWy((const char*)keys[keyIndex], seed);
+				}
+			}
+			else
+			{
+				for( ; keyIndex < count; keyIndex++)
+				{
+					if(keys[keyIndex] != NULL) hashes[keyIndex] = table->stringHashFunc((const char*)keys[keyIndex], seed);
+				}
+			}
+			break;
+		default:
+			for( ; keyIndex < count; keyIndex++) hashes[keyIndex] = 0;
 			break;
-		default: return HASH_FAIL;
+	}
+}
+
+/**
+ * @fn static int JHashTableAddChunk(JHashTablePtr table, void **keys, void **values, int *results, int count)
+ * @brief (Chaining) 데이터 묶음 하나(최대 JHT_ADD_BATCH_SIZE 개)를 버킷 또는 잠금 그룹별로 묶어서 추가하는 함수
+ * @param table 해쉬 테이블 구조체 객체의 주소(출력)
+ * @param keys 저장할 키 배열(입력)
+ * @param values 저장할 데이터 배열(입력)
+ * @param results 데이터별 결과를 저장할 배열(출력, NULL 허용)
+ * @param count 데이터 개수(입력, 1 ~ JHT_ADD_BATCH_SIZE)
+ * @return 추가된 데이터 개수
+ */
+static int JHashTableAddChunk(JHashTablePtr table, void **keys, void **values, int *results, int count)
+{
+	uint64_t hashes[JHT_ADD_BATCH_SIZE];
+	int nextEntries[JHT_ADD_BATCH_SIZE];
+	int groupKeys[JHT_ADD_BATCH_SIZE];
+	int groupHeads[JHT_ADD_BATCH_SIZE];
+	int groupTails[JHT_ADD_BATCH_SIZE];
+	int groupSizes[JHT_ADD_BATCH_SIZE];
+	// 묶음 위치를 찾는 작은 해쉬 표(선형 탐사, -1 이면 빈 칸)
+	int groupSlots[JHT_ADD_BATCH_SIZE * 2];
+	int groupCount = 0;
+	int groupIndex = 0;
+	int groupKey = 0;
+	int listIndex = 0;
+	JLinkedListPtrContainer container = NULL;
+	int slotIndex = 0;
+	int entryIndex = 0;
+	int addedCount = 0;
+
+	JHashTableHashKeys(table, keys, hashes, count);
+	memset(groupSlots, 0xff, sizeof(groupSlots));
+
+	for( ; entryIndex < count; entryIndex++)
+	{
+		if((keys[entryIndex] == NULL) || (values[entryIndex] == NULL))
+		{
+			if(results != NULL) results[entryIndex] = HASH_FAIL;
+			continue;
+		}
+
+		if(table->lockStripes != NULL)
+		{
+			groupKey = (JHashTableGetLockIndex(table, hashes[entryIndex]) >> table->lockStripeShift) & (table->lockStripeCount - 1);
+		}
+		else
+		{
+			// 재해싱 중이면 이미 옮겨진 Slot 의 데이터는 새로운 Slot 배열의 위치로 묶는다.
+			container = JHashTableLocateList(table, hashes[entryIndex], &listIndex);
+			groupKey = (container == table->listContainer) ? listIndex : table->size + listIndex;
+		}
+
+		slotIndex = groupKey % (JHT_ADD_BATCH_SIZE * 2);
+		while((groupSlots[slotIndex] >= 0) && (groupKeys[groupSlots[slotIndex]] != groupKey))
+		{
+			slotIndex = (slotIndex + 1) % (JHT_ADD_BATCH_SIZE * 2);
+		}
+
+		nextEntries[entryIndex] = -1;
+		groupIndex = groupSlots[slotIndex];
+		if(groupIndex < 0)
+		{
+			groupIndex = groupCount++;
+			groupSlots[slotIndex] = groupIndex;
+			groupKeys[groupIndex] = groupKey;
+			groupHeads[groupIndex] = entryIndex;
+			groupSizes[groupIndex] = 0;
+		}
+		else
+		{
+			nextEntries[groupTails[groupIndex]] = entryIndex;
+		}
+		groupTails[groupIndex] = entryIndex;
+		groupSizes[groupIndex]++;
 	}
 
-	return hash;
+	for(groupIndex = 0; groupIndex < groupCount; groupIndex++)
+	{
+		if(table->lockStripes != NULL)
+		{
+			addedCount += JHashTableAddLockGroup(table, keys, values, hashes, nextEntries, groupHeads[groupIndex], groupSizes[groupIndex], results);
+		}
+		else
+		{
+			addedCount += JHashTableAddBucketGroup(table, keys, values, hashes, nextEntries, groupHeads[groupIndex], results);
+		}
+	}
+
+	return addedCount;
 }
 
 /**
- * @fn static HashType CheckHashType(HashType type)
- * @brief 지정한 해쉬 유형이 등록되어 있는지 검사하는 함수
- * @param type 검사할 해쉬 유형(입력)
- * @return 성공 시 지정한 해쉬 유형, 실패 시 Unknown 반환(HashType 열거형 참고)
+ * @fn static int JHashTableAddBucketGroup(JHashTablePtr table, void **keys, void **values, const uint64_t *hashes, const int *nextEntries, int entryIndex, int *results)
+ * @brief (Chaining, 동시 접근 모드가 아님) 같은 버킷에 추가할 데이터들을 연결 리스트를 한 번만 찾아서 추가하는 함수
+ * @param table 해쉬 테이블 구조체 객체의 주소(출력)
+ * @param keys 저장할 키 배열(입력)
+ * @param values 저장할 데이터 배열(입력)
+ * @param hashes 키별 전체 해쉬값 배열(입력)
+ * @param nextEntries 같은 묶음의 다음 데이터 위치 배열(입력, -1 이면 마지막)
+ * @param entryIndex 묶음의 첫 데이터 위치(입력)
+ * @param results 데이터별 결과를 저장할 배열(출력, NULL 허용)
+ * @return 추가된 데이터 개수
  */
-static HashType CheckHashType(HashType type)
+static int JHashTableAddBucketGroup(JHashTablePtr table, void **keys, void **values, const uint64_t *hashes, const int *nextEntries, int entryIndex, int *results)
 {
-	switch(type)
+	int listIndex = 0;
+	int addedCount = 0;
+	int result = 0;
+	JNodePtr node = NULL;
+	JLinkedListPtrContainer container = JHashTableLocateList(table, hashes[entryIndex], &listIndex);
+	JLinkedListPtr list = container[listIndex];
+
+	for( ; entryIndex >= 0; entryIndex = nextEntries[entryIndex])
 	{
-		case IntType:
-		case CharType:
-		case StringType:
-		return type;
+		result = 0;
+		if(JHashTableFindNode(table, list, hashes[entryIndex], keys[entryIndex], values[entryIndex]) == NULL)
+		{
+			if(list == NULL) list = JHashTableMaterializeList(table, container, listIndex, 0);
+			node = (list == NULL) ? NULL : JLinkedListNewNode(list);
+			if(node == NULL)
+			{
+				result = HASH_FAIL;
+			}
+			else
+			{
+				node->key = keys[entryIndex];
+				node->data = values[entryIndex];
+				node->hash = hashes[entryIndex];
+				JLinkedListLinkNode(list, node);
+				addedCount++;
+				result = 1;
+			}
+		}
+		if(results != NULL) results[entryIndex] = result;
 	}
-	return Unknown;
+
+	if(addedCount > 0)
+	{
+		JBucketBitmapUpdate(JHashTableGetBitmap(table, container), list);
+		JHashTableAddCount(table, 0, addedCount);
+	}
+	return addedCount;
 }
 
+/**
+ * @fn static int JHashTableAddLockGroup(JHashTablePtr table, void **keys, void **values, const uint64_t *hashes, const int *nextEntries, int entryIndex, int entryCount, int *results)
+ * @brief (Chaining, 동시 접근 모드) 같은 잠금 그룹으로 보호되는 데이터들을 쓰기 잠금을 한 번만 잡고 추가하는 함수
+ * 데이터 하나마다 돕던 만큼의 재해싱과 확장 검사는 잠금 밖에서 묶음 단위로 처리하고, 노드는 잠금별 메모리 풀에서 한 번에 할당한다.
+ * @param table 해쉬 테이블 구조체 객체의 주소(출력)
+ * @param keys 저장할 키 배열(입력)
+ * @param values 저장할 데이터 배열(입력)
+ * @param hashes 키별 전체 해쉬값 배열(입력)
+ * @param nextEntries 같은 묶음의 다음 데이터 위치 배열(입력, -1 이면 마지막)
+ * @param entryIndex 묶음의 첫 데이터 위치(입력)
+ * @param entryCount 묶음의 데이터 개수(입력)
+ * @param results 데이터별 결과를 저장할 배열(출력, NULL 허용)
+ * @return 추가된 데이터 개수
+ */
+static int JHashTableAddLockGroup(JHashTablePtr table, void **keys, void **values, const uint64_t *hashes, const int *nextEntries, int entryIndex, int entryCount, int *results)
+{
+	int lockIndex = JHashTableGetLockIndex(table, hashes[entryIndex]);
+	int addedCount = 0;
+	int result = 0;
+	int count = 0;
+
+	JHashTableRehashStep(table, JHT_REHASH_STEP * entryCount);
+
+	JHashTableLockBucket(table, lockIndex, 1);
+	JNodePoolPtr pool = JHashTableGetNodePool(table, lockIndex);
+	if(pool != NULL) JPoolReserve(&(pool->nodes), entryCount);
+	for( ; entryIndex >= 0; entryIndex = nextEntries[entryIndex])
+	{
+		result = JHashTableInsertLocked(table, keys[entryIndex], values[entryIndex], hashes[entryIndex], JHashTableGetLockIndex(table, hashes[entryIndex]), 1, &count);
+		if(result == 1) addedCount++;
+		if(results != NULL) results[entryIndex] = result;
+	}
+	JHashTableUnlockBucket(table, lockIndex, 1);
+
+	if(addedCount > 0) JHashTableCheckGrowth(table, count, addedCount);
+	return addedCount;
+}
@@ -1,3 +1,7 @@
+#include <string.h>
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
 #include "../include/ttlib.h"
 #include "../include/jhashtable.h"
 
@@ -142,6 +146,34 @@ TEST(Node_INT, GetData, {
 	DeleteJNode(&node);
 })
 
+TEST(Node_INT, SetKey, {
+	JNodePtr node = NewJNode();
+
+	int expected = 7;
+	EXPECT_NULL(JNodeGetKey(node));
+	EXPECT_NOT_NULL(JNodeSetKey(node, &expected));
+	EXPECT_PTR_EQUAL(node->key, &expected);
+
+	EXPECT_NULL(JNodeSetKey(NULL, &expected));
+	EXPECT_NULL(JNodeSetKey(node, NULL));
+	EXPECT_NULL(JNodeSetKey(NULL, NULL));
+
+	DeleteJNode(&node);
+})
+
+TEST(Node_INT, GetKey, {
+	JNodePtr node = NewJNode();
+
+	int expected = 7;
+	JNodeSetKey(node, &expected);
+	EXPECT_NOT_NULL(JNodeGetKey(node));
+	EXPECT_NUM_EQUAL(*((int*)JNodeGetKey(node)), expected, int);
+
+	EXPECT_NULL(JNodeGetKey(NULL));
+
+	DeleteJNode(&node);
+})
+
 ////////////////////////////////////////////////////////////////////////////////
 /// LinkedList Test (int)
 ////////////////////////////////////////////////////////////////////////////////
@@ -201,6 +233,29 @@ TEST(LinkedList_INT, GetLastNodeData, {
 	DeleteJLinkedList(&list);
 })
 
+TEST(LinkedList_INT, PopFrontAndPopBack, {
+	int values[3];
+	values[0] = 1;
+	values[1] = 2;
+	values[2] = 3;
+	JLinkedListPtr list = NewJLinkedList(0);
+
+	JLinkedListAddNode(list, &values[0]);
+	JLinkedListAddNode(list, &values[1]);
+	JLinkedListAddNode(list, &values[2]);
+
+	EXPECT_PTR_EQUAL(JLinkedListPopFront(list), &values[0]);
+	EXPECT_PTR_EQUAL(JLinkedListPopBack(list), &values[2]);
+	EXPECT_NUM_EQUAL(JLinkedListGetSize(list), 1, int);
+	EXPECT_PTR_EQUAL(JLinkedListPopBack(list), &values[1]);
+	EXPECT_NULL(JLinkedListPopFront(list));
+	EXPECT_NULL(JLinkedListPopBack(list));
+	EXPECT_NULL(JLinkedListPopFront(NULL));
+	EXPECT_NULL(JLinkedListPopBack(NULL));
+
+	DeleteJLinkedList(&list);
+})
+
 TEST(LinkedList_INT, SetData, {
 	JLinkedListPtr list = NewJLinkedList(0);
 	int expected = 5;
@@ -414,6 +469,57 @@ TEST(HashTable_INT, FindData, {
 	DeleteJHashTable(&table);
 })
 
+TEST(HashTable_INT, Get, {
+	int size = 10;
+	int expectedKey1 = 4;
+	int expectedValue1 = 10;
+	int expectedKey2 = 14;
+	int expectedValue2 = 11;
+	int searchKey = 14;
+	int unknownKey = 24;
+	JHashTablePtr table = NewJHashTable(size, IntType, IntType);
+
+	JHashTableAddData(table, &expectedKey1, &expectedValue1);
+	JHashTableAddData(table, &expectedKey2, &expectedValue2);
+
+	// 키의 주소가 아닌 값으로 비교
+	EXPECT_PTR_EQUAL(JHashTableGet(table, &expectedKey1), &expectedValue1);
+	EXPECT_PTR_EQUAL(JHashTableGet(table, &searchKey), &expectedValue2);
+	EXPECT_NULL(JHashTableGet(table, &unknownKey));
+
+	EXPECT_NULL(JHashTableGet(NULL, &expectedKey1));
+	EXPECT_NULL(JHashTableGet(table, NULL));
+	EXPECT_NULL(JHashTableGet(NULL, NULL));
+
+	DeleteJHashTable(&table);
+})
+
+TEST(HashTable_INT, RemoveKey, {
+	int size = 10;
+	int expectedKey1 = 4;
+	int expectedValue1_1 = 10;
+	int expectedValue1_2 = 20;
+	int expectedKey2 = 14;
+	int expectedValue2 = 11;
+	int searchKey = 4;
+	JHashTablePtr table = NewJHashTable(size, IntType, IntType);
+
+	JHashTableAddData(table, &expectedKey1, &expectedValue1_1);
+	JHashTableAddData(table, &expectedKey1, &expectedValue1_2);
+	JHashTableAddData(table, &expectedKey2, &expectedValue2);
+
+	EXPECT_NUM_EQUAL(JHashTableRemoveKey(table, &searchKey), DeleteSuccess, int);
+	EXPECT_NULL(JHashTableGet(table, &expectedKey1));
+	EXPECT_PTR_EQUAL(JHashTableGet(table, &expectedKey2), &expectedValue2);
+	EXPECT_NUM_EQUAL(JHashTableRemoveKey(table, &searchKey), DeleteFail, int);
+
+	EXPECT_NUM_EQUAL(JHashTableRemoveKey(NULL, &expectedKey1), DeleteFail, int);
+	EXPECT_NUM_EQUAL(JHashTableRemoveKey(table, NULL), DeleteFail, int);
+	EXPECT_NUM_EQUAL(JHashTableRemoveKey(NULL, NULL), DeleteFail, int);
+
+	DeleteJHashTable(&table);
+})
+
 // ---------- Hash char Test ----------
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -714,6 +820,51 @@ TEST(HashTable_CHAR, FindData, {
 	DeleteJHashTable(&table);
 })
 
+TEST(HashTable_CHAR, Get, {
+	int size = 10;
+	char expectedKey1 = 'a';
+	char expectedValue1 = 'x';
+	char expectedKey2 = 'b';
+	char expectedValue2 = 'y';
+	char searchKey = 'b';
+	char unknownKey = 'c';
+	JHashTablePtr table = NewJHashTable(size, CharType, CharType);
+
+	JHashTableAddData(table, &expectedKey1, &expectedValue1);
+	JHashTableAddData(table, &expectedKey2, &expectedValue2);
+
+	EXPECT_PTR_EQUAL(JHashTableGet(table, &expectedKey1), &expectedValue1);
+	EXPECT_PTR_EQUAL(JHashTableGet(table, &searchKey), &expectedValue2);
+	EXPECT_NULL(JHashTableGet(table, &unknownKey));
+
+	EXPECT_NULL(JHashTableGet(NULL, &expectedKey1));
+	EXPECT_NULL(JHashTableGet(table, NULL));
+
+	DeleteJHashTable(&table);
+})
+
+TEST(HashTable_CHAR, RemoveKey, {
+	int size = 10;
+	char expectedKey1 = 'a';
+	char expectedValue1 = 'x';
+	char expectedKey2 = 'b';
+	char expectedValue2 = 'y';
+	char searchKey = 'a';
+	JHashTablePtr table = NewJHashTable(size, CharType, CharType);
+
+	JHashTableAddData(table, &expectedKey1, &expectedValue1);
+	JHashTableAddData(table, &expectedKey2, &expectedValue2);
+
+	EXPECT_NUM_EQUAL(JHashTableRemoveKey(table, &searchKey), DeleteSuccess, int);
+	EXPECT_NULL(JHashTableGet(table, &expectedKey1));
+	EXPECT_PTR_EQUAL(JHashTableGet(table, &expectedKey2), &expectedValue2);
+
+	EXPECT_NUM_EQUAL(JHashTableRemoveKey(NULL, &expectedKey1), DeleteFail, int);
+	EXPECT_NUM_EQUAL(JHashTableRemoveKey(table, NULL), DeleteFail, int);
+
+	DeleteJHashTable(&table);
+})
+
 // ---------- Hash string Test ----------
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -869,7 +1020,7 @@ TEST(LinkedList_STRING, FindNodeData, {
 
 TEST(HashTable_STRING, AddData, {
 	int size = 10;
-	char *expectedKey1 = "abc";
+	char *expectedKey1 = "def";
 	char *expectedValue1 = "123";
 	JHashTablePtr table = NewJHashTable(size, StringType, StringType);
 	EXPECT_NOT_NULL(JHashTableAddData(table, expectedKey1, expectedValue1));
@@ -887,9 +1038,9 @@ TEST(HashTable_STRING, AddData, {
 
 TEST(HashTable_STRING, GetFirstData, {
 	int size = 10;
-	char *expectedKey1 = "def";
+	char *expectedKey1 = "abc";
 	char *expectedValue1 = "[1$2**3]";
-	char *expectedKey2 = "abc";
+	char *expectedKey2 = "def";
 	char *expectedValue2 = "{4@5u6}";
 	JHashTablePtr table = NewJHashTable(size, StringType, StringType);
 
@@ -904,9 +1055,9 @@ TEST(HashTable_STRING, GetFirstData, {
 
 TEST(HashTable_STRING, GetLastData, {
 	int size = 10;
-	char *expectedKey1 = "def";
+	char *expectedKey1 = "abc";
 	char *expectedValue1 = "[1$2**3]";
-	char *expectedKey2 = "abc";
+	char *expectedKey2 = "def";
 	char *expectedValue2 = "{4@5u6}";
 	JHashTablePtr table = NewJHashTable(size, StringType, StringType);
 
@@ -948,9 +1099,9 @@ TEST(HashTable_STRING, DeleteData, {
 
 TEST(HashTable_STRING, DeleteFirstData, {
 	int size = 10;
-	char *expectedKey1 = "def";
+	char *expectedKey1 = "abc";
 	char *expectedValue1 = "[1$2**3]";
-	char *expectedKey2 = "abc";
+	char *expectedKey2 = "def";
 	char *expectedValue2 = "{4@5u6}";
 	JHashTablePtr table = NewJHashTable(size, StringType, StringType);
 
@@ -969,9 +1120,9 @@ TEST(HashTable_STRING, DeleteFirstData, {
 
 TEST(HashTable_STRING, DeleteLastData, {
 	int size = 10;
-	char *expectedKey1 = "def";
+	char *expectedKey1 = "abc";
 	char *expectedValue1 = "[1$2**3]";
-	char *expectedKey2 = "abc";
+	char *expectedKey2 = "def";
 	char *expectedValue2 = "{4@5u6}";
 	JHashTablePtr table = NewJHashTable(size, StringType, StringType);
 
@@ -1014,6 +1165,54 @@ TEST(HashTable_STRING, FindData, {
 	DeleteJHashTable(&table);
 })
 
+TEST(HashTable_STRING, Get, {
+	int size = 10;
+	char *expectedKey1 = "def";
+	char *expectedValue1 = "[1$2**3]";
+	char *expectedKey2 = "abc";
+	char *expectedValue2 = "{4@5u6}";
+	// 같은 내용의 다른 문자열 버퍼로 검색
+	char searchKey[4];
+	strcpy(searchKey, "abc");
+	char *unknownKey = "ghi";
+	JHashTablePtr table = NewJHashTable(size, StringType, StringType);
+
+	JHashTableAddData(table, expectedKey1, expectedValue1);
+	JHashTableAddData(table, expectedKey2, expectedValue2);
+
+	EXPECT_PTR_EQUAL(JHashTableGet(table, expectedKey1), expectedValue1);
+	EXPECT_PTR_EQUAL(JHashTableGet(table, searchKey), expectedValue2);
+	EXPECT_NULL(JHashTableGet(table, unknownKey));
+
+	EXPECT_NULL(JHashTableGet(NULL, expectedKey1));
+	EXPECT_NULL(JHashTableGet(table, NULL));
+
+	DeleteJHashTable(&table);
+})
+
+TEST(HashTable_STRING, RemoveKey, {
+	int size = 10;
+	char *expectedKey1 = "def";
+	char *expectedValue1 = "[1$2**3]";
+	char *expectedKey2 = "abc";
+	char *expectedValue2 = "{4@5u6}";
+	char searchKey[4];
+	strcpy(searchKey, "def");
+	JHashTablePtr table = NewJHashTable(size, StringType, StringType);
+
+	JHashTableAddData(table, expectedKey1, expectedValue1);
+	JHashTableAddData(table, expectedKey2, expectedValue2);
+
+	EXPECT_NUM_EQUAL(JHashTableRemoveKey(table, searchKey), DeleteSuccess, int);
+	EXPECT_NULL(JHashTableGet(table, expectedKey1));
+	EXPECT_PTR_EQUAL(JHashTableGet(table, expectedKey2), expectedValue2);
+
+	EXPECT_NUM_EQUAL(JHashTableRemoveKey(NULL, expectedKey1), DeleteFail, int);
+	EXPECT_NUM_EQUAL(JHashTableRemoveKey(table, NULL), DeleteFail, int);
+
+	DeleteJHashTable(&table);
+})
+
 // ---------- Hash int & char Test ----------
 
 ////////////////////////////////////////////////////////////////////////////////
@@ -1477,7 +1676,7 @@ TEST(HashTable_INT_STRING, FindData, {
 
 TEST(HashTable_STRING_INT, AddData, {
 	int size = 10;
-	char *expectedKey1 = "abc";
+	char *expectedKey1 = "def";
 	int expectedValue1 = 5;
 	JHashTablePtr table = NewJHashTable(size, StringType, IntType);
 	EXPECT_NOT_NULL(JHashTableAddData(table, expectedKey1, &expectedValue1));
@@ -1495,9 +1694,9 @@ TEST(HashTable_STRING_INT, AddData, {
 
 TEST(HashTable_STRING_INT, GetFirstData, {
 	int size = 10;
-	char *expectedKey1 = "def";
+	char *expectedKey1 = "abc";
 	int expectedValue1 = 5;
-	char *expectedKey2 = "abc";
+	char *expectedKey2 = "def";
 	int expectedValue2 = 6;
 	JHashTablePtr table = NewJHashTable(size, StringType, IntType);
 
@@ -1512,9 +1711,9 @@ TEST(HashTable_STRING_INT, GetFirstData, {
 
 TEST(HashTable_STRING_INT, GetLastData, {
 	int size = 10;
-	char *expectedKey1 = "def";
+	char *expectedKey1 = "abc";
 	int expectedValue1 = 5;
-	char *expectedKey2 = "abc";
+	char *expectedKey2 = "def";
 	int expectedValue2 = 6;
 	JHashTablePtr table = NewJHashTable(size, StringType, IntType);
 
@@ -1556,9 +1755,9 @@ TEST(HashTable_STRING_INT, DeleteData, {
 
 TEST(HashTable_STRING_INT, DeleteFirstData, {
 	int size = 10;
-	char *expectedKey1 = "def";
+	char *expectedKey1 = "abc";
 	int expectedValue1 = 5;
-	char *expectedKey2 = "abc";
+	char *expectedKey2 = "def";
 	int expectedValue2 = 6;
 	JHashTablePtr table = NewJHashTable(size, StringType, IntType);
 
@@ -1577,9 +1776,9 @@ TEST(HashTable_STRING_INT, DeleteFirstData, {
 
 TEST(HashTable_STRING_INT, DeleteLastData, {
 	int size = 10;
-	char *expectedKey1 = "def";
+	char *expectedKey1 = "abc";
 	int expectedValue1 = 5;
-	char *expectedKey2 = "abc";
+	char *expectedKey2 = "def";
 	int expectedValue2 = 6;
 	JHashTablePtr table = NewJHashTable(size, StringType, IntType);
 
@@ -1789,7 +1988,7 @@ TEST(HashTable_CHAR_STRING, FindData, {
 
 TEST(HashTable_STRING_CHAR, AddData, {
 	int size = 10;
-	char* expectedKey1 = "abc";
+	char* expectedKey1 = "def";
 	char expectedValue1 = 'd';
 	JHashTablePtr table = NewJHashTable(size, StringType, CharType);
 	EXPECT_NOT_NULL(JHashTableAddData(table, expectedKey1, &expectedValue1));
@@ -1807,9 +2006,9 @@ TEST(HashTable_STRING_CHAR, AddData, {
 
 TEST(HashTable_STRING_CHAR, GetFirstData, {
 	int size = 10;
-	char *expectedKey1 = "def";
+	char *expectedKey1 = "abc";
 	char expectedValue1 = 'x';
-	char *expectedKey2 = "abc";
+	char *expectedKey2 = "def";
 	char expectedValue2 = 'y';
 	JHashTablePtr table = NewJHashTable(size, StringType, CharType);
 
@@ -1824,9 +2023,9 @@ TEST(HashTable_STRING_CHAR, GetFirstData, {
 
 TEST(HashTable_STRING_CHAR, GetLastData, {
 	int size = 10;
-	char *expectedKey1 = "def";
+	char *expectedKey1 = "abc";
 	char expectedValue1 = 'x';
-	char *expectedKey2 = "abc";
+	char *expectedKey2 = "def";
 	char expectedValue2 = 'y';
 	JHashTablePtr table = NewJHashTable(size, StringType, CharType);
 
@@ -1868,11 +2067,11 @@ TEST(HashTable_STRING_CHAR, DeleteData, {
 
 TEST(HashTable_STRING_CHAR, DeleteFirstData, {
 	int size = 10;
-	char *expectedKey1 = "def";
+	char *expectedKey1 = "abc";
 	char expectedValue1_1 = 'x';
 	char expectedValue1_2 = 't';
 	char expectedValue1_3 = 'u';
-	char *expectedKey2 = "abc";
+	char *expectedKey2 = "def";
 	char expectedValue2 = 'y';
 	JHashTablePtr table = NewJHashTable(size, StringType, CharType);
 
@@ -1893,9 +2092,9 @@ TEST(HashTable_STRING_CHAR, DeleteFirstData, {
 
 TEST(HashTable_STRING_CHAR, DeleteLastData, {
 	int size = 10;
-	char *expectedKey1 = "def";
+	char *expectedKey1 = "abc";
 	char expectedValue1 = 'x';
-	char *expectedKey2 = "abc";
+	char *expectedKey2 = "def";
 	char expectedValue2_1 = 'y';
 	char expectedValue2_2 = 'z';
 	char expectedValue2_3 = 'w';
@@ -1942,6 +2141,3604 @@ TEST(HashTable_STRING_CHAR, FindData, {
 	DeleteJHashTable(&table);
 })
 
+// ---------- Open Addressing Storage Test ----------
+
+////////////////////////////////////////////////////////////////////////////////
+/// HashTable Test (open addressing)
+////////////////////////////////////////////////////////////////////////////////
+
+TEST(HashTable_OPEN, CreateAndDeleteHashTable, {
+	JHashTableOption option;
+	EXPECT_NOT_NULL(JHashTableInitOption(&option));
+	EXPECT_NUM_EQUAL(option.storageType, ChainStorage, int);
+	EXPECT_NULL(JHashTableInitOption(NULL));
+
+	option.storageType = OpenAddressStorage;
+	JHashTablePtr table = NewJHashTableWithOption(10, IntType, IntType, &option);
+	EXPECT_NOT_NULL(table);
+	EXPECT_NUM_EQUAL(JHashTableGetStorageType(table), OpenAddressStorage, int);
+	// 슬롯 개수는 2 의 거듭제곱(최소 그룹 크기)으로 올림
+	EXPECT_NUM_EQUAL(JHashTableGetSize(table), JHT_GROUP_SIZE, int);
+	EXPECT_NUM_EQUAL(DeleteJHashTable(&table), DeleteSuccess, int);
+
+	option.storageType = 123;
+	EXPECT_NULL(NewJHashTableWithOption(10, IntType, IntType, &option));
+	option.storageType = OpenAddressStorage;
+	EXPECT_NULL(NewJHashTableWithOption(0, IntType, IntType, &option));
+	EXPECT_NULL(NewJHashTableWithOption(10, 123, IntType, &option));
+
+	table = NewJHashTableWithOption(10, IntType, IntType, NULL);
+	EXPECT_NUM_EQUAL(JHashTableGetStorageType(table), ChainStorage, int);
+	DeleteJHashTable(&table);
+})
+
+TEST(HashTable_OPEN, AddAndFindData, {
+	int expectedKey1 = 4;
+	int expectedValue1_1 = 10;
+	int expectedValue1_2 = 20;
+	int expectedKey2 = 5;
+	int expectedValue2 = 11;
+	JHashTableOption option;
+	JHashTableInitOption(&option);
+	option.storageType = OpenAddressStorage;
+	JHashTablePtr table = NewJHashTableWithOption(10, IntType, IntType, &option);
+
+	EXPECT_NOT_NULL(JHashTableAddData(table, &expectedKey1, &expectedValue1_1));
+	EXPECT_NOT_NULL(JHashTableAddData(table, &expectedKey1, &expectedValue1_2));
+	EXPECT_NOT_NULL(JHashTableAddData(table, &expectedKey2, &expectedValue2));
+	// 같은 키와 데이터 쌍은 중복 저장하지 않음
+	EXPECT_NULL(JHashTableAddData(table, &expectedKey1, &expectedValue1_1));
+
+	EXPECT_NUM_EQUAL(JHashTableFindData(table, &expectedKey1, &expectedValue1_1), FindSuccess, int);
+	EXPECT_NUM_EQUAL(JHashTableFindData(table, &expectedKey1, &expectedValue1_2), FindSuccess, int);
+	EXPECT_NUM_EQUAL(JHashTableFindData(table, &expectedKey2, &expectedValue2), FindSuccess, int);
+	EXPECT_NUM_EQUAL(JHashTableFindData(table, &expectedKey2, &expectedValue1_1), FindFail, int);
+
+	EXPECT_NULL(JHashTableAddData(table, NULL, &expectedValue2));
+	EXPECT_NULL(JHashTableAddData(table, &expectedKey2, NULL));
+	EXPECT_NUM_EQUAL(JHashTableFindData(table, NULL, &expectedValue2), FindFail, int);
+	EXPECT_NUM_EQUAL(JHashTableFindData(table, &expectedKey2, NULL), FindFail, int);
+
+	DeleteJHashTable(&table);
+})
+
+TEST(HashTable_OPEN, DeleteData, {
+	int expectedKey1 = 4;
+	int expectedValue1 = 10;
+	int expectedKey2 = 5;
+	int expectedValue2 = 11;
+	JHashTableOption option;
+	JHashTableInitOption(&option);
+	option.storageType = OpenAddressStorage;
+	JHashTablePtr table = NewJHashTableWithOption(10, IntType, IntType, &option);
+
+	JHashTableAddData(table, &expectedKey1, &expectedValue1);
+	JHashTableAddData(table, &expectedKey2, &expectedValue2);
+
+	EXPECT_NUM_EQUAL(JHashTableDeleteData(table, &expectedKey2, &expectedValue2), DeleteSuccess, int);
+	EXPECT_NUM_EQUAL(JHashTableFindData(table, &expectedKey2, &expectedValue2), FindFail, int);
+	EXPECT_NUM_EQUAL(JHashTableDeleteData(table, &expectedKey2, &expectedValue2), DeleteFail, int);
+	EXPECT_PTR_EQUAL(JHashTableGetFirstData(table), &expectedValue1);
+
+	EXPECT_NUM_EQUAL(JHashTableDeleteData(NULL, &expectedKey1, &expectedValue1), DeleteFail, int);
+	EXPECT_NUM_EQUAL(JHashTableDeleteData(table, NULL, &expectedValue1), DeleteFail, int);
+	EXPECT_NUM_EQUAL(JHashTableDeleteData(table, &expectedKey1, NULL), DeleteFail, int);
+
+	DeleteJHashTable(&table);
+})
+
+TEST(HashTable_OPEN, DeleteFirstAndLastData, {
+	int keys[3];
+	int values[3];
+	int index = 0;
+	JHashTableOption option;
+	JHashTableInitOption(&option);
+	option.storageType = OpenAddressStorage;
+	JHashTablePtr table = NewJHashTableWithOption(10, IntType, IntType, &option);
+
+	EXPECT_NULL(JHashTableGetFirstData(table));
+	EXPECT_NULL(JHashTableGetLastData(table));
+	EXPECT_NUM_EQUAL(JHashTableDeleteFirstData(table), DeleteFail, int);
+	EXPECT_NUM_EQUAL(JHashTableDeleteLastData(table), DeleteFail, int);
+
+	for( ; index < 3; index++)
+	{
+		keys[index] = index + 1;
+		values[index] = (index + 1) * 10;
+		JHashTableAddData(table, &keys[index], &values[index]);
+	}
+
+	void *first = JHashTableGetFirstData(table);
+	void *last = JHashTableGetLastData(table);
+	EXPECT_NOT_NULL(first);
+	EXPECT_NOT_NULL(last);
+	EXPECT_PTR_NOT_EQUAL(first, last);
+
+	EXPECT_NUM_EQUAL(JHashTableDeleteFirstData(table), DeleteSuccess, int);
+	EXPECT_PTR_NOT_EQUAL(JHashTableGetFirstData(table), first);
+	EXPECT_NUM_EQUAL(JHashTableDeleteLastData(table), DeleteSuccess, int);
+	EXPECT_PTR_NOT_EQUAL(JHashTableGetLastData(table), last);
+	EXPECT_PTR_EQUAL(JHashTableGetFirstData(table), JHashTableGetLastData(table));
+	EXPECT_NUM_EQUAL(JHashTableDeleteFirstData(table), DeleteSuccess, int);
+	EXPECT_NULL(JHashTableGetFirstData(table));
+
+	DeleteJHashTable(&table);
+})
+
+TEST(HashTable_OPEN, GetAndRemoveKey, {
+	char *expectedKey1 = "def";
+	char *expectedValue1 = "[1$2**3]";
+	char *expectedKey2 = "abc";
+	char *expectedValue2 = "{4@5u6}";
+	char searchKey[4];
+	strcpy(searchKey, "abc");
+	JHashTableOption option;
+	JHashTableInitOption(&option);
+	option.storageType = OpenAddressStorage;
+	JHashTablePtr table = NewJHashTableWithOption(10, StringType, StringType, &option);
+
+	JHashTableAddData(table, expectedKey1, expectedValue1);
+	JHashTableAddData(table, expectedKey2, expectedValue2);
+
+	EXPECT_PTR_EQUAL(JHashTableGet(table, expectedKey1), expectedValue1);
+	EXPECT_PTR_EQUAL(JHashTableGet(table, searchKey), expectedValue2);
+	EXPECT_NUM_EQUAL(JHashTableRemoveKey(table, searchKey), DeleteSuccess, int);
+	EXPECT_NULL(JHashTableGet(table, expectedKey2));
+	EXPECT_NUM_EQUAL(JHashTableRemoveKey(table, searchKey), DeleteFail, int);
+	EXPECT_PTR_EQUAL(JHashTableGet(table, expectedKey1), expectedValue1);
+	JHashTablePrintAll(table);
+
+	DeleteJHashTable(&table);
+})
+
+TEST(HashTable_OPEN, Grow, {
+	int count = 1000;
+	int *keys = (int*)malloc(sizeof(int) * (size_t)count);
+	int index = 0;
+	int foundCount = 0;
+	JHashTableOption option;
+	JHashTableInitOption(&option);
+	option.storageType = OpenAddressStorage;
+	JHashTablePtr table = NewJHashTableWithOption(10, IntType, IntType, &option);
+
+	for(index = 0; index < count; index++)
+	{
+		keys[index] = index;
+		if(JHashTableAddData(table, &keys[index], &keys[index]) != NULL) foundCount++;
+	}
+	EXPECT_NUM_EQUAL(foundCount, count, int);
+	EXPECT_NUM_GREATER_EQUAL(JHashTableGetSize(table), count, int);
+
+	// 짝수 키 삭제 후 홀수 키만 남아 있는지 확인
+	for(index = 0; index < count; index += 2)
+	{
+		JHashTableDeleteData(table, &keys[index], &keys[index]);
+	}
+	foundCount = 0;
+	for(index = 0; index < count; index++)
+	{
+		if(JHashTableGet(table, &keys[index]) != NULL) foundCount += (index % 2 == 1) ? 1 : count;
+	}
+	EXPECT_NUM_EQUAL(foundCount, count / 2, int);
+
+	DeleteJHashTable(&table);
+	free(keys);
+})
+
+// ---------- Rehash Test ----------
+
+TEST(HashTable_REHASH, GrowAndFindData, {
+	int count = 1000;
+	int *keys = (int*)malloc(sizeof(int) * (size_t)count);
+	int index = 0;
+	int foundCount = 0;
+	JHashTablePtr table = NewJHashTable(10, IntType, IntType);
+
+	for(index = 0; index < count; index++)
+	{
+		keys[index] = index;
+		if(JHashTableAddData(table, &keys[index], &keys[index]) != NULL) foundCount++;
+	}
+	EXPECT_NUM_EQUAL(foundCount, count, int);
+	EXPECT_NUM_EQUAL(JHashTableGetCount(table), count, int);
+	EXPECT_NUM_GREATER_EQUAL(JHashTableGetSize(table), 320, int);
+
+	foundCount = 0;
+	for(index = 0; index < count; index++)
+	{
+		if(JHashTableGet(table, &keys[index]) == &keys[index]) foundCount++;
+	}
+	EXPECT_NUM_EQUAL(foundCount, count, int);
+
+	DeleteJHashTable(&table);
+	free(keys);
+})
+
+TEST(HashTable_REHASH, OperationsDuringRehash, {
+	int count = 64;
+	int *keys = (int*)malloc(sizeof(int) * (size_t)count);
+	int index = 0;
+	int foundCount = 0;
+	JHashTablePtr table = NewJHashTable(32, IntType, IntType);
+
+	// 33 번째 데이터 추가 시 재해싱이 시작되고 이후 연산마다 조금씩 진행된다.
+	for(index = 0; index < 33; index++)
+	{
+		keys[index] = index;
+		JHashTableAddData(table, &keys[index], &keys[index]);
+	}
+	EXPECT_NOT_NULL(table->rehashContainer);
+	EXPECT_NUM_EQUAL(JHashTableGetCount(table), 33, int);
+
+	for(index = 33; index < count; index++)
+	{
+		keys[index] = index;
+		JHashTableAddData(table, &keys[index], &keys[index]);
+		if(JHashTableFindData(table, &keys[index - 33], &keys[index - 33]) == FindSuccess) foundCount++;
+	}
+	EXPECT_NUM_EQUAL(foundCount, count - 33, int);
+	EXPECT_NUM_EQUAL(JHashTableGetCount(table), count, int);
+
+	// 중복 데이터는 재해싱 중에도 추가되지 않는다.
+	EXPECT_NULL(JHashTableAddData(table, &keys[0], &keys[0]));
+
+	EXPECT_NUM_EQUAL(JHashTableDeleteData(table, &keys[1], &keys[1]), DeleteSuccess, int);
+	EXPECT_NUM_EQUAL(JHashTableRemoveKey(table, &keys[2]), DeleteSuccess, int);
+	EXPECT_NULL(JHashTableGet(table, &keys[1]));
+	EXPECT_NULL(JHashTableGet(table, &keys[2]));
+	EXPECT_NUM_EQUAL(JHashTableGetCount(table), count - 2, int);
+
+	// 첫 번째 데이터부터 모두 삭제
+	foundCount = 0;
+	while(JHashTableDeleteFirstData(table) == DeleteSuccess) foundCount++;
+	EXPECT_NUM_EQUAL(foundCount, count - 2, int);
+	EXPECT_NUM_EQUAL(JHashTableGetCount(table), 0, int);
+	EXPECT_NULL(JHashTableGetFirstData(table));
+	EXPECT_NULL(JHashTableGetLastData(table));
+
+	DeleteJHashTable(&table);
+	free(keys);
+})
+
+TEST(HashTable_REHASH, DisableWithZeroLoadFactor, {
+	int count = 100;
+	int *keys = (int*)malloc(sizeof(int) * (size_t)count);
+	int index = 0;
+	JHashTableOption option;
+	JHashTableInitOption(&option);
+	option.loadFactor = 0;
+	JHashTablePtr table = NewJHashTableWithOption(10, IntType, IntType, &option);
+
+	for(index = 0; index < count; index++)
+	{
+		keys[index] = index;
+		JHashTableAddData(table, &keys[index], &keys[index]);
+	}
+	EXPECT_NUM_EQUAL(JHashTableGetSize(table), 10, int);
+	EXPECT_NUM_EQUAL(JHashTableGetCount(table), count, int);
+	EXPECT_NULL(table->rehashContainer);
+
+	DeleteJHashTable(&table);
+	free(keys);
+})
+
+// ---------- Node Pool Test ----------
+
+TEST(HashTable_POOL, ReuseReleasedNodes, {
+	int count = 500;
+	int *keys = (int*)malloc(sizeof(int) * (size_t)count);
+	int index = 0;
+	JHashTableOption option;
+	JHashTableInitOption(&option);
+	option.loadFactor = 0;
+	JHashTablePtr table = NewJHashTableWithOption(10, IntType, IntType, &option);
+	EXPECT_NOT_NULL(table->nodePool);
+
+	for(index = 0; index < count; index++)
+	{
+		keys[index] = index;
+		JHashTableAddData(table, &keys[index], &keys[index]);
+	}
+	// 데이터 노드와 10 개 Slot 의 Head, Tail 노드
+	EXPECT_NUM_EQUAL(table->nodePool->nodes.usedObjects, count + 20, int);
+	EXPECT_NUM_EQUAL(table->nodePool->lists.usedObjects, 10, int);
+	int slabCount = table->nodePool->nodes.slabCount;
+
+	// 삭제한 노드는 메모리 풀에 반환되고, 다시 추가할 때 새 슬랩 없이 재사용된다.
+	for(index = 0; index < count; index++)
+	{
+		JHashTableDeleteData(table, &keys[index], &keys[index]);
+	}
+	EXPECT_NUM_EQUAL(table->nodePool->nodes.usedObjects, 20, int);
+	for(index = 0; index < count; index++)
+	{
+		JHashTableAddData(table, &keys[index], &keys[index]);
+	}
+	EXPECT_NUM_EQUAL(table->nodePool->nodes.slabCount, slabCount, int);
+	EXPECT_NUM_EQUAL(JHashTableGetCount(table), count, int);
+	EXPECT_PTR_EQUAL(JHashTableGet(table, &keys[count - 1]), &keys[count - 1]);
+
+	DeleteJHashTable(&table);
+	free(keys);
+})
+
+TEST(HashTable_POOL, DisableNodePool, {
+	int count = 100;
+	int *keys = (int*)malloc(sizeof(int) * (size_t)count);
+	int index = 0;
+	int foundCount = 0;
+	JHashTableOption option;
+	JHashTableInitOption(&option);
+	option.useNodePool = 0;
+	JHashTablePtr table = NewJHashTableWithOption(10, IntType, IntType, &option);
+	EXPECT_NULL(table->nodePool);
+
+	for(index = 0; index < count; index++)
+	{
+		keys[index] = index;
+		JHashTableAddData(table, &keys[index], &keys[index]);
+	}
+	for(index = 0; index < JHashTableGetSize(table); index++)
+	{
+		if((table->listContainer[index] != NULL) && (table->listContainer[index]->pool != NULL)) foundCount++;
+	}
+	EXPECT_NUM_EQUAL(foundCount, 0, int);
+	for(index = 0; index < count; index += 2)
+	{
+		JHashTableDeleteData(table, &keys[index], &keys[index]);
+	}
+	for(index = 0; index < count; index++)
+	{
+		if(JHashTableFindData(table, &keys[index], &keys[index]) == FindSuccess) foundCount++;
+	}
+	EXPECT_NUM_EQUAL(foundCount, count / 2, int);
+
+	DeleteJHashTable(&table);
+	free(keys);
+})
+
+TEST(HashTable_POOL, LazyBucketMaterialization, {
+	int index = 0;
+	int createdCount = 0;
+	int key = 5;
+	JHashTablePtr table = NewJHashTable(1000, IntType, IntType);
+
+	// 생성 직후에는 어떤 Slot 도 연결 리스트를 할당하지 않는다.
+	for(index = 0; index < 1000; index++)
+	{
+		if(table->listContainer[index] != NULL) createdCount++;
+	}
+	EXPECT_NUM_EQUAL(createdCount, 0, int);
+	EXPECT_NUM_EQUAL(table->nodePool->nodes.slabCount, 0, int);
+	EXPECT_NULL(JHashTableGetFirstData(table));
+	EXPECT_NUM_EQUAL(JHashTableFindData(table, &key, &key), FindFail, int);
+	EXPECT_NUM_EQUAL(JHashTableDeleteData(table, &key, &key), DeleteFail, int);
+
+	EXPECT_PTR_EQUAL(JHashTableAddData(table, &key, &key), table);
+	for(index = 0; index < 1000; index++)
+	{
+		if(table->listContainer[index] != NULL) createdCount++;
+	}
+	EXPECT_NUM_EQUAL(createdCount, 1, int);
+	EXPECT_NOT_NULL(table->listContainer[5]);
+	EXPECT_NUM_EQUAL(table->nodePool->nodes.usedObjects, 3, int);
+
+	DeleteJHashTable(&table);
+})
+
+// ---------- Hash Fingerprint Test ----------
+
+TEST(HashTable_FINGERPRINT, CacheHashInNode, {
+	char key1[8];
+	char key2[8];
+	char value[8];
+	strcpy(key1, "abc");
+	strcpy(key2, "abc");
+	strcpy(value, "value");
+	JHashTableOption option;
+	JHashTableInitOption(&option);
+	option.loadFactor = 0;
+	JHashTablePtr table = NewJHashTableWithOption(1, StringType, StringType, &option);
+
+	EXPECT_PTR_EQUAL(JHashTableAddData(table, key1, value), table);
+	JNodePtr node = table->listContainer[0]->head->next;
+	EXPECT_PTR_EQUAL(node->key, key1);
+	EXPECT_NUM_EQUAL((node->hash != 0), 1, int);
+
+	// 주소가 다른 같은 문자열 키로도 검색된다.
+	EXPECT_PTR_EQUAL(JHashTableGet(table, key2), value);
+	EXPECT_NUM_EQUAL(JHashTableFindData(table, key2, value), FindSuccess, int);
+	EXPECT_NULL(JHashTableAddData(table, key2, value));
+
+	DeleteJHashTable(&table);
+})
+
+TEST(HashTable_FINGERPRINT, SameValueWithDifferentKeys, {
+	int key1 = 1;
+	int key2 = 2;
+	int value = 100;
+	JHashTableOption option;
+	JHashTableInitOption(&option);
+	option.loadFactor = 0;
+	JHashTablePtr table = NewJHashTableWithOption(1, IntType, IntType, &option);
+
+	// 같은 Slot 이라도 키가 다르면 같은 데이터를 저장할 수 있다.
+	EXPECT_PTR_EQUAL(JHashTableAddData(table, &key1, &value), table);
+	EXPECT_PTR_EQUAL(JHashTableAddData(table, &key2, &value), table);
+	EXPECT_NULL(JHashTableAddData(table, &key1, &value));
+	EXPECT_NUM_EQUAL(JHashTableGetCount(table), 2, int);
+
+	EXPECT_NUM_EQUAL(JHashTableDeleteData(table, &key1, &value), DeleteSuccess, int);
+	EXPECT_NUM_EQUAL(JHashTableFindData(table, &key1, &value), FindFail, int);
+	EXPECT_NUM_EQUAL(JHashTableFindData(table, &key2, &value), FindSuccess, int);
+
+	DeleteJHashTable(&table);
+})
+
+TEST(HashTable_FINGERPRINT, AddUnchecked, {
+	int count = 1000;
+	int *keys = (int*)malloc(sizeof(int) * (size_t)count);
+	int index = 0;
+	int foundCount = 0;
+	JHashTablePtr table = NewJHashTable(10, IntType, IntType);
+
+	for(index = 0; index < count; index++)
+	{
+		keys[index] = index;
+		if(JHashTableAddUnchecked(table, &keys[index], &keys[index]) != NULL) foundCount++;
+	}
+	EXPECT_NUM_EQUAL(foundCount, count, int);
+	EXPECT_NUM_EQUAL(JHashTableGetCount(table), count, int);
+
+	foundCount = 0;
+	for(index = 0; index < count; index++)
+	{
+		if(JHashTableGet(table, &keys[index]) == &keys[index]) foundCount++;
+	}
+	EXPECT_NUM_EQUAL(foundCount, count, int);
+
+	// 중복 검사를 하지 않으므로 같은 데이터가 한 번 더 저장된다.
+	EXPECT_PTR_EQUAL(JHashTableAddUnchecked(table, &keys[0], &keys[0]), table);
+	EXPECT_NUM_EQUAL(JHashTableGetCount(table), count + 1, int);
+	EXPECT_NULL(JHashTableAddUnchecked(table, NULL, &keys[0]));
+
+	DeleteJHashTable(&table);
+	free(keys);
+})
+
+TEST(HashTable_OPEN, AddUnchecked, {
+	int key = 1;
+	int value = 100;
+	JHashTableOption option;
+	JHashTableInitOption(&option);
+	option.storageType = OpenAddressStorage;
+	JHashTablePtr table = NewJHashTableWithOption(10, IntType, IntType, &option);
+
+	EXPECT_PTR_EQUAL(JHashTableAddUnchecked(table, &key, &value), table);
+	EXPECT_NULL(JHashTableAddData(table, &key, &value));
+	EXPECT_PTR_EQUAL(JHashTableAddUnchecked(table, &key, &value), table);
+	EXPECT_NUM_EQUAL(JHashTableGetCount(table), 2, int);
+	EXPECT_PTR_EQUAL(JHashTableGet(table, &key), &value);
+
+	DeleteJHashTable(&table);
+})
+
+// ---------- Hash Function Test ----------
+
+static uint64_t ConstantHash(int key, uint64_t seed)
+{
+	(void)key;
+	return seed;
+}
+
+TEST(HashFunc, BundledHashFunctions, {
+	char longKey[256];
+	int index = 0;
+	for(index = 0; index < 255; index++)
+	{
+		longKey[index] = (char)('a' + (index % 26));
+	}
+	longKey[255] = '\0';
+
+	EXPECT_NUM_EQUAL((JHashIntModulo(-1, 0) == 0xFFFFFFFFULL), 1, int);
+	EXPECT_NUM_EQUAL((JHashIntModulo(17, 0) == 17), 1, int);
+	EXPECT_NUM_EQUAL((JHashIntMix(1, 0) != JHashIntMix(2, 0)), 1, int);
+	EXPECT_NUM_EQUAL((JHashIntMix(1, 0) != JHashIntMix(1, 1)), 1, int);
+	EXPECT_NUM_EQUAL((JHashCharMix('a', 0) != JHashCharMix('b', 0)), 1, int);
+
+	// 첫 문자부터 위치를 곱해서 더함(첫 문자만 다른 키도 다른 해쉬값)
+	EXPECT_NUM_EQUAL((JHashStringSum("abc", 0) == 590), 1, int);
+	EXPECT_NUM_EQUAL((JHashStringSum("", 0) == 0), 1, int);
+	EXPECT_NUM_EQUAL((JHashStringSum("abc", 0) != JHashStringSum("xbc", 0)), 1, int);
+	EXPECT_NUM_EQUAL((JHashStringSum(longKey, 0) > 0), 1, int);
+
+	// wyhash(final4) 참조 구현의 테스트 벡터
+	EXPECT_NUM_EQUAL((JHashStringWy("", 0) == 0x93228a4de0eec5a2ULL), 1, int);
+	EXPECT_NUM_EQUAL((JHashStringWy("abc", 2) == 0xa97f2f7b1d9b3314ULL), 1, int);
+	EXPECT_NUM_EQUAL((JHashStringWy("message digest", 3) == 0x786d1f1df3801df4ULL), 1, int);
+	EXPECT_NUM_EQUAL((JHashStringWy("abcdefghijklmnopqrstuvwxyz", 4) == 0xdca5a8138ad37c87ULL), 1, int);
+	EXPECT_NUM_EQUAL((JHashStringWy("12345678901234567890123456789012345678901234567890123456789012345678901234567890", 6) == 0x6cc5eab49a92d617ULL), 1, int);
+
+	// 첫 문자만 다른 문자열, seed, 길이별 경계
+	EXPECT_NUM_EQUAL((JHashStringWy("abc", 0) == JHashStringWy("abc", 0)), 1, int);
+	EXPECT_NUM_EQUAL((JHashStringWy("abc", 0) != JHashStringWy("xbc", 0)), 1, int);
+	EXPECT_NUM_EQUAL((JHashStringWy("abc", 0) != JHashStringWy("abc", 1)), 1, int);
+	EXPECT_NUM_EQUAL((JHashStringWy("", 0) != JHashStringWy("a", 0)), 1, int);
+	EXPECT_NUM_EQUAL((JHashStringWy(longKey, 0) != JHashStringWy(longKey + 1, 0)), 1, int);
+	longKey[100] = '\0';
+	EXPECT_NUM_EQUAL((JHashStringWy(longKey, 0) != JHashStringWy(longKey + 50, 0)), 1, int);
+})
+
+TEST(HashTable_HASH, NegativeIntKey, {
+	int keys[4];
+	int values[4];
+	int index = 0;
+	JHashTablePtr table = NewJHashTable(10, IntType, IntType);
+
+	for(index = 0; index < 4; index++)
+	{
+		keys[index] = -1 - (index * 1000);
+		values[index] = index;
+		EXPECT_PTR_EQUAL(JHashTableAddData(table, &keys[index], &values[index]), table);
+	}
+	for(index = 0; index < 4; index++)
+	{
+		EXPECT_PTR_EQUAL(JHashTableGet(table, &keys[index]), &values[index]);
+	}
+	EXPECT_NUM_EQUAL(JHashTableRemoveKey(table, &keys[3]), DeleteSuccess, int);
+	EXPECT_NULL(JHashTableGet(table, &keys[3]));
+
+	DeleteJHashTable(&table);
+})
+
+TEST(HashTable_HASH, RegisterHashFunction, {
+	int keys[100];
+	int index = 0;
+	int foundCount = 0;
+	JHashTableOption option;
+	JHashTableInitOption(&option);
+	option.loadFactor = 0;
+	option.intHashFunc = ConstantHash;
+	option.hashSeed = 3;
+	JHashTablePtr table = NewJHashTableWithOption(10, IntType, IntType, &option);
+	EXPECT_NUM_EQUAL((JHashTableGetHashSeed(table) == 3), 1, int);
+
+	// 모든 키가 seed(3) 위치의 Slot 에 저장된다.
+	for(index = 0; index < 100; index++)
+	{
+		keys[index] = index;
+		JHashTableAddData(table, &keys[index], &keys[index]);
+	}
+	EXPECT_NUM_EQUAL(JLinkedListGetSize(table->listContainer[3]), 100, int);
+	for(index = 0; index < 100; index++)
+	{
+		if(JHashTableGet(table, &keys[index]) == &keys[index]) foundCount++;
+	}
+	EXPECT_NUM_EQUAL(foundCount, 100, int);
+
+	// 데이터가 있으면 해싱 함수와 seed 를 변경할 수 없다.
+	EXPECT_NULL(JHashTableSetIntHashFunc(table, JHashIntMix));
+	EXPECT_NULL(JHashTableSetHashSeed(table, 7));
+	DeleteJHashTable(&table);
+
+	table = NewJHashTable(10, StringType, IntType);
+	EXPECT_PTR_EQUAL(JHashTableSetStringHashFunc(table, JHashStringWy), table);
+	EXPECT_PTR_EQUAL(JHashTableSetCharHashFunc(table, JHashCharMix), table);
+	EXPECT_PTR_EQUAL(JHashTableSetHashSeed(table, 12345), table);
+	EXPECT_NULL(JHashTableSetStringHashFunc(table, NULL));
+	EXPECT_NULL(JHashTableSetIntHashFunc(NULL, JHashIntMix));
+	EXPECT_PTR_EQUAL(table->stringHashFunc, JHashStringWy);
+	DeleteJHashTable(&table);
+})
+
+TEST(HashTable_HASH, StringKeyDistribution, {
+	int count = 1000;
+	int bucketCount = 256;
+	char (*keys)[64] = malloc(sizeof(char[64]) * (size_t)count);
+	int index = 0;
+	int maxBucketSize = 0;
+	JHashTableOption option;
+	JHashTableInitOption(&option);
+	option.loadFactor = 0;
+	JHashTablePtr table = NewJHashTableWithOption(bucketCount, StringType, IntType, &option);
+	EXPECT_PTR_EQUAL(table->stringHashFunc, JHashStringWy);
+
+	// 기본 함수로도 앞부분이 같은 URL 키들이 고르게 분포한다.
+	for(index = 0; index < count; index++)
+	{
+		snprintf(keys[index], 64, "https://example.com/item/%d", index);
+		JHashTableAddData(table, keys[index], &count);
+	}
+	for(index = 0; index < bucketCount; index++)
+	{
+		if(JLinkedListGetSize(table->listContainer[index]) > maxBucketSize) maxBucketSize = JLinkedListGetSize(table->listContainer[index]);
+	}
+	EXPECT_NUM_EQUAL(JHashTableGetCount(table), count, int);
+	EXPECT_NUM_LESS_EQUAL(maxBucketSize, 16, int);
+
+	DeleteJHashTable(&table);
+	free(keys);
+})
+
+// ---------- Power Of Two Bucket Test ----------
+
+static int GetMaxBucketSize(const JHashTablePtr table)
+{
+	int index = 0;
+	int maxBucketSize = 0;
+	for(index = 0; index < table->size; index++)
+	{
+		if(JLinkedListGetSize(table->listContainer[index]) > maxBucketSize) maxBucketSize = JLinkedListGetSize(table->listContainer[index]);
+	}
+	return maxBucketSize;
+}
+
+TEST(HashTable_POW2, RoundUpBucketCount, {
+	JHashTableOption option;
+	JHashTableInitOption(&option);
+	option.powerOfTwoBuckets = 1;
+
+	JHashTablePtr table = NewJHashTableWithOption(10, IntType, IntType, &option);
+	EXPECT_NUM_EQUAL(JHashTableGetSize(table), 16, int);
+	DeleteJHashTable(&table);
+
+	table = NewJHashTableWithOption(1, IntType, IntType, &option);
+	EXPECT_NUM_EQUAL(JHashTableGetSize(table), 2, int);
+	DeleteJHashTable(&table);
+
+	table = NewJHashTableWithOption(1024, IntType, IntType, &option);
+	EXPECT_NUM_EQUAL(JHashTableGetSize(table), 1024, int);
+	DeleteJHashTable(&table);
+})
+
+TEST(HashTable_POW2, SpreadSequentialAndStridedKeys, {
+	int count = 1024;
+	int *keys = (int*)malloc(sizeof(int) * (size_t)count);
+	int index = 0;
+	JHashTableOption option;
+	JHashTableInitOption(&option);
+	option.loadFactor = 0;
+	option.powerOfTwoBuckets = 1;
+	JHashTablePtr table = NewJHashTableWithOption(count, IntType, IntType, &option);
+
+	for(index = 0; index < count; index++)
+	{
+		keys[index] = index;
+		JHashTableAddData(table, &keys[index], &keys[index]);
+	}
+	EXPECT_NUM_LESS_EQUAL(GetMaxBucketSize(table), 4, int);
+	DeleteJHashTable(&table);
+
+	// 버킷 개수 간격의 키는 나머지 연산이면 모두 한 버킷에 모인다.
+	table = NewJHashTableWithOption(count, IntType, IntType, &option);
+	for(index = 0; index < count; index++)
+	{
+		keys[index] = index * count;
+		JHashTableAddData(table, &keys[index], &keys[index]);
+	}
+	EXPECT_NUM_LESS_EQUAL(GetMaxBucketSize(table), 8, int);
+	DeleteJHashTable(&table);
+
+	option.powerOfTwoBuckets = 0;
+	table = NewJHashTableWithOption(count, IntType, IntType, &option);
+	for(index = 0; index < count; index++)
+	{
+		JHashTableAddData(table, &keys[index], &keys[index]);
+	}
+	EXPECT_NUM_EQUAL(GetMaxBucketSize(table), count, int);
+	DeleteJHashTable(&table);
+
+	free(keys);
+})
+
+TEST(HashTable_POW2, GrowWithNegativeKeys, {
+	int count = 1000;
+	int *keys = (int*)malloc(sizeof(int) * (size_t)count);
+	int index = 0;
+	int foundCount = 0;
+	JHashTableOption option;
+	JHashTableInitOption(&option);
+	option.powerOfTwoBuckets = 1;
+	JHashTablePtr table = NewJHashTableWithOption(4, IntType, IntType, &option);
+
+	for(index = 0; index < count; index++)
+	{
+		keys[index] = -index * 7;
+		JHashTableAddData(table, &keys[index], &keys[index]);
+	}
+	for(index = 0; index < count; index++)
+	{
+		if(JHashTableGet(table, &keys[index]) == &keys[index]) foundCount++;
+	}
+	EXPECT_NUM_EQUAL(foundCount, count, int);
+	EXPECT_NUM_EQUAL(JHashTableGetCount(table), count, int);
+	// 확장 후에도 2 의 거듭제곱 유지
+	EXPECT_NUM_EQUAL((JHashTableGetSize(table) & (JHashTableGetSize(table) - 1)), 0, int);
+
+	while(JHashTableDeleteLastData(table) == DeleteSuccess);
+	EXPECT_NUM_EQUAL(JHashTableGetCount(table), 0, int);
+
+	DeleteJHashTable(&table);
+	free(keys);
+})
+
+// ---------- Occupied Bucket Bitmap Test ----------
+
+TEST(HashTable_BITMAP, TrackOccupiedBuckets, {
+	int keys[3];
+	keys[0] = 3;
+	keys[1] = 70;
+	keys[2] = 199;
+	JHashTableOption option;
+	JHashTableInitOption(&option);
+	option.loadFactor = 0;
+	JHashTablePtr table = NewJHashTableWithOption(200, IntType, IntType, &option);
+	EXPECT_NUM_EQUAL(table->occupied.wordCount, 4, int);
+
+	JHashTableAddData(table, &keys[0], &keys[0]);
+	JHashTableAddData(table, &keys[1], &keys[1]);
+	JHashTableAddData(table, &keys[2], &keys[2]);
+	EXPECT_NUM_EQUAL((table->occupied.words[0] == (1ULL << 3)), 1, int);
+	EXPECT_NUM_EQUAL((table->occupied.words[1] == (1ULL << 6)), 1, int);
+	EXPECT_NUM_EQUAL((table->occupied.words[3] == (1ULL << 7)), 1, int);
+	EXPECT_PTR_EQUAL(JHashTableGetFirstData(table), &keys[0]);
+	EXPECT_PTR_EQUAL(JHashTableGetLastData(table), &keys[2]);
+
+	// 비어진 버킷의 bit 는 지워진다.
+	EXPECT_NUM_EQUAL(JHashTableRemoveKey(table, &keys[1]), DeleteSuccess, int);
+	EXPECT_NUM_EQUAL((table->occupied.words[1] == 0), 1, int);
+	EXPECT_NUM_EQUAL(JHashTableDeleteFirstData(table), DeleteSuccess, int);
+	EXPECT_PTR_EQUAL(JHashTableGetFirstData(table), &keys[2]);
+	EXPECT_NUM_EQUAL(JHashTableDeleteLastData(table), DeleteSuccess, int);
+	EXPECT_NULL(JHashTableGetFirstData(table));
+	EXPECT_NULL(JHashTableGetLastData(table));
+	EXPECT_NUM_EQUAL(JHashTableDeleteFirstData(table), DeleteFail, int);
+
+	DeleteJHashTable(&table);
+})
+
+TEST(HashTable_BITMAP, DrainSparseTable, {
+	int count = 1000;
+	int *keys = (int*)malloc(sizeof(int) * (size_t)count);
+	int index = 0;
+	int drainCount = 0;
+	int isOrdered = 1;
+	void *prevData = NULL;
+	JHashTablePtr table = NewJHashTable(100000, IntType, IntType);
+
+	for(index = 0; index < count; index++)
+	{
+		keys[index] = index * 97;
+		JHashTableAddData(table, &keys[index], &keys[index]);
+	}
+
+	// 키 % 버킷 개수 순서로 삭제된다.
+	while((prevData = JHashTableGetFirstData(table)) != NULL)
+	{
+		if(*((int*)prevData) != drainCount * 97) isOrdered = 0;
+		JHashTableDeleteFirstData(table);
+		drainCount++;
+	}
+	EXPECT_NUM_EQUAL(drainCount, count, int);
+	EXPECT_NUM_EQUAL(isOrdered, 1, int);
+	EXPECT_NUM_EQUAL(JHashTableGetCount(table), 0, int);
+
+	// 다시 추가한 후 뒤에서부터 삭제
+	for(index = 0; index < count; index++)
+	{
+		JHashTableAddData(table, &keys[index], &keys[index]);
+	}
+	drainCount = 0;
+	while(JHashTableDeleteLastData(table) == DeleteSuccess) drainCount++;
+	EXPECT_NUM_EQUAL(drainCount, count, int);
+
+	DeleteJHashTable(&table);
+	free(keys);
+})
+
+// ---------- POP Test ----------
+
+TEST(HashTable_POP, PopFirstAndPopLast, {
+	int keys[5];
+	int index = 0;
+	JHashTablePtr table = NewJHashTable(10, IntType, IntType);
+
+	for(index = 0; index < 5; index++)
+	{
+		keys[index] = index;
+		JHashTableAddData(table, &keys[index], &keys[index]);
+	}
+
+	// 삭제된 데이터가 Get 연산 결과와 같아야 한다.
+	EXPECT_PTR_EQUAL(JHashTablePopFirst(table), &keys[0]);
+	EXPECT_PTR_EQUAL(JHashTablePopLast(table), &keys[4]);
+	EXPECT_NUM_EQUAL(JHashTableGetCount(table), 3, int);
+	EXPECT_NULL(JHashTableGet(table, &keys[0]));
+	EXPECT_NULL(JHashTableGet(table, &keys[4]));
+	EXPECT_PTR_EQUAL(JHashTableGetFirstData(table), &keys[1]);
+	EXPECT_PTR_EQUAL(JHashTableGetLastData(table), &keys[3]);
+
+	EXPECT_PTR_EQUAL(JHashTablePopFirst(table), &keys[1]);
+	EXPECT_PTR_EQUAL(JHashTablePopFirst(table), &keys[2]);
+	EXPECT_PTR_EQUAL(JHashTablePopLast(table), &keys[3]);
+	EXPECT_NUM_EQUAL(JHashTableGetCount(table), 0, int);
+
+	EXPECT_NULL(JHashTablePopFirst(table));
+	EXPECT_NULL(JHashTablePopLast(table));
+	EXPECT_NULL(JHashTablePopFirst(NULL));
+	EXPECT_NULL(JHashTablePopLast(NULL));
+
+	DeleteJHashTable(&table);
+})
+
+TEST(HashTable_POP, PopDuringRehash, {
+	int count = 40;
+	int *keys = (int*)malloc(sizeof(int) * (size_t)count);
+	int index = 0;
+	int popCount = 0;
+	int isMatched = 1;
+	void *expected = NULL;
+	void *data = NULL;
+	JHashTablePtr table = NewJHashTable(32, IntType, IntType);
+
+	for(index = 0; index < count; index++)
+	{
+		keys[index] = index;
+		JHashTableAddData(table, &keys[index], &keys[index]);
+	}
+	EXPECT_NOT_NULL(table->rehashContainer);
+
+	// 앞과 뒤에서 번갈아 삭제해도 Get 연산 결과와 같아야 한다.
+	while(JHashTableGetCount(table) > 0)
+	{
+		expected = (popCount % 2 == 0) ? JHashTableGetFirstData(table) : JHashTableGetLastData(table);
+		data = (popCount % 2 == 0) ? JHashTablePopFirst(table) : JHashTablePopLast(table);
+		if((data == NULL) || (data != expected)) isMatched = 0;
+		popCount++;
+	}
+	EXPECT_NUM_EQUAL(popCount, count, int);
+	EXPECT_NUM_EQUAL(isMatched, 1, int);
+	EXPECT_NULL(JHashTablePopFirst(table));
+
+	DeleteJHashTable(&table);
+	free(keys);
+})
+
+TEST(HashTable_POP, OpenAddressing, {
+	int count = 100;
+	int *keys = (int*)malloc(sizeof(int) * (size_t)count);
+	int index = 0;
+	int popCount = 0;
+	JHashTableOption option;
+	JHashTableInitOption(&option);
+	option.storageType = OpenAddressStorage;
+	JHashTablePtr table = NewJHashTableWithOption(10, IntType, IntType, &option);
+
+	for(index = 0; index < count; index++)
+	{
+		keys[index] = index;
+		JHashTableAddData(table, &keys[index], &keys[index]);
+	}
+
+	void *expected = JHashTableGetFirstData(table);
+	EXPECT_PTR_EQUAL(JHashTablePopFirst(table), expected);
+	expected = JHashTableGetLastData(table);
+	EXPECT_PTR_EQUAL(JHashTablePopLast(table), expected);
+	EXPECT_NUM_EQUAL(JHashTableGetCount(table), count - 2, int);
+
+	popCount = 2;
+	while(JHashTablePopLast(table) != NULL) popCount++;
+	EXPECT_NUM_EQUAL(popCount, count, int);
+	EXPECT_NUM_EQUAL(JHashTableGetCount(table), 0, int);
+
+	DeleteJHashTable(&table);
+	free(keys);
+})
+
+// ---------- CONCURRENT Test ----------
+
+// 동시 접근 테스트 스레드 인자 구조체
+typedef struct _concurrent_arg_t {
+	// 함께 사용하는 해쉬 테이블
+	JHashTablePtr table;
+	// 전체 키 배열
+	int *keys;
+	// 스레드가 사용할 키 범위 시작 위치
+	int begin;
+	// 스레드가 사용할 키 범위 끝 위치(포함하지 않음)
+	int end;
+	// 성공한 연산 개수
+	int result;
+	// (삭제 테스트) 키별 삭제 횟수
+	int *popCounts;
+	// (샤드 테이블 테스트) 함께 사용하는 샤드 테이블
+	JShardedHashTablePtr shardedTable;
+} ConcurrentArg;
+
+static void* ConcurrentAddFindDelete(void *data)
+{
+	ConcurrentArg *arg = (ConcurrentArg*)data;
+	int index = 0;
+
+	for(index = arg->begin; index < arg->end; index++)
+	{
+		if(JHashTableAddData(arg->table, &(arg->keys[index]), &(arg->keys[index])) != NULL) arg->result++;
+	}
+	for(index = arg->begin; index < arg->end; index++)
+	{
+		if(JHashTableFindData(arg->table, &(arg->keys[index]), &(arg->keys[index])) == FindSuccess) arg->result++;
+		if(JHashTableGet(arg->table, &(arg->keys[index])) == &(arg->keys[index])) arg->result++;
+	}
+	// 짝수 번째 키만 삭제
+	for(index = arg->begin; index < arg->end; index += 2)
+	{
+		if(JHashTableDeleteData(arg->table, &(arg->keys[index]), &(arg->keys[index])) == DeleteSuccess) arg->result++;
+	}
+	return NULL;
+}
+
+static void* ConcurrentPop(void *data)
+{
+	ConcurrentArg *arg = (ConcurrentArg*)data;
+	void *popped = NULL;
+
+	while((popped = (arg->result % 2 == 0) ? JHashTablePopFirst(arg->table) : JHashTablePopLast(arg->table)) != NULL)
+	{
+		__atomic_fetch_add(&(arg->popCounts[*((int*)popped)]), 1, __ATOMIC_RELAXED);
+		arg->result++;
+	}
+	return NULL;
+}
+
+// 스레드 4 개가 서로 다른 키 범위를 동시에 추가, 검색, 삭제한 후 남은 데이터 개수를 반환한다.
+// 한 스레드라도 실패한 연산이 있으면 HASH_FAIL 을 반환한다.
+// tableSize 가 NULL 이 아니면 삭제 전 해쉬 테이블의 크기를 저장한다.
+static int RunConcurrentAddFindDeleteWithOption(int size, const JHashTableOptionPtr option, int *tableSize)
+{
+	int threadCount = 4;
+	int perThread = 2000;
+	int *keys = (int*)malloc(sizeof(int) * (size_t)(threadCount * perThread));
+	int index = 0;
+	int result = 0;
+	pthread_t threads[4];
+	ConcurrentArg args[4];
+
+	JHashTablePtr table = NewJHashTableWithOption(size, IntType, IntType, option);
+
+	for(index = 0; index < threadCount * perThread; index++) keys[index] = index;
+	for(index = 0; index < threadCount; index++)
+	{
+		memset(&args[index], 0, sizeof(ConcurrentArg));
+		args[index].table = table;
+		args[index].keys = keys;
+		args[index].begin = index * perThread;
+		args[index].end = (index + 1) * perThread;
+		pthread_create(&threads[index], NULL, ConcurrentAddFindDelete, &args[index]);
+	}
+	for(index = 0; index < threadCount; index++)
+	{
+		pthread_join(threads[index], NULL);
+		if(args[index].result != perThread * 3 + perThread / 2) result = HASH_FAIL;
+	}
+
+	// 홀수 번째 키만 남아 있어야 한다.
+	for(index = 0; (result == 0) && (index < threadCount * perThread); index++)
+	{
+		if((JHashTableGet(table, &keys[index]) != NULL) != (index % 2 == 1)) result = HASH_FAIL;
+	}
+	if(result == 0) result = JHashTableGetCount(table);
+	if(tableSize != NULL) *tableSize = JHashTableGetSize(table);
+
+	DeleteJHashTable(&table);
+	free(keys);
+	return result;
+}
+
+static int RunConcurrentAddFindDelete(LockType lockType, int lockStripeCount)
+{
+	JHashTableOption option;
+	JHashTableInitOption(&option);
+	option.lockType = lockType;
+	option.lockStripeCount = lockStripeCount;
+	return RunConcurrentAddFindDeleteWithOption(1024, &option, NULL);
+}
+
+TEST(HashTable_CONCURRENT, CreateWithLockOption, {
+	int keys[100];
+	int index = 0;
+	JHashTableOption option;
+	JHashTableInitOption(&option);
+	EXPECT_NUM_EQUAL(option.lockType, NoLock, int);
+	EXPECT_NUM_EQUAL(option.lockStripeCount, JHT_DEFAULT_LOCK_STRIPES, int);
+
+	JHashTablePtr table = NewJHashTable(10, IntType, IntType);
+	EXPECT_NUM_EQUAL(JHashTableGetLockType(table), NoLock, int);
+	EXPECT_NULL(table->lockStripes);
+	DeleteJHashTable(&table);
+
+	// 잠금 개수는 2 의 거듭제곱으로 올림하고, 자동 확장은 하지 않는다.
+	option.lockType = SpinLock;
+	option.lockStripeCount = 5;
+	table = NewJHashTableWithOption(10, IntType, IntType, &option);
+	EXPECT_NOT_NULL(table);
+	EXPECT_NUM_EQUAL(JHashTableGetLockType(table), SpinLock, int);
+	EXPECT_NUM_EQUAL(table->lockStripeCount, 8, int);
+	EXPECT_NUM_EQUAL((int)(((uintptr_t)table->lockStripes) % JHT_CACHE_LINE_SIZE), 0, int);
+	for(index = 0; index < 100; index++)
+	{
+		keys[index] = index;
+		JHashTableAddData(table, &keys[index], &keys[index]);
+	}
+	EXPECT_NULL(table->rehashContainer);
+	EXPECT_NUM_EQUAL(JHashTableGetSize(table), 10, int);
+	EXPECT_NUM_EQUAL(JHashTableGetCount(table), 100, int);
+	EXPECT_PTR_EQUAL(JHashTableGetFirstData(table), &keys[0]);
+	EXPECT_PTR_EQUAL(JHashTableGetLastData(table), &keys[99]);
+	EXPECT_NUM_EQUAL(JHashTableRemoveKey(table, &keys[10]), DeleteSuccess, int);
+	EXPECT_NUM_EQUAL(JHashTableGetCount(table), 99, int);
+	DeleteJHashTable(&table);
+
+	// Open Addressing 저장소와 잘못된 잠금 설정은 생성하지 않는다.
+	option.lockType = RwLock;
+	option.lockStripeCount = 0;
+	EXPECT_NULL(NewJHashTableWithOption(10, IntType, IntType, &option));
+	option.lockStripeCount = JHT_MAX_LOCK_STRIPES + 1;
+	EXPECT_NULL(NewJHashTableWithOption(10, IntType, IntType, &option));
+	option.lockStripeCount = JHT_DEFAULT_LOCK_STRIPES;
+	option.storageType = OpenAddressStorage;
+	EXPECT_NULL(NewJHashTableWithOption(10, IntType, IntType, &option));
+	option.storageType = ChainStorage;
+	option.lockType = (LockType)100;
+	EXPECT_NULL(NewJHashTableWithOption(10, IntType, IntType, &option));
+	option.lockType = UnknownLock;
+	EXPECT_NULL(NewJHashTableWithOption(10, IntType, IntType, &option));
+
+	EXPECT_NUM_EQUAL(JHashTableGetLockType(NULL), UnknownLock, int);
+})
+
+TEST(HashTable_CONCURRENT, ParallelAddFindDelete, {
+	EXPECT_NUM_EQUAL(RunConcurrentAddFindDelete(RwLock, JHT_DEFAULT_LOCK_STRIPES), 4000, int);
+	EXPECT_NUM_EQUAL(RunConcurrentAddFindDelete(SpinLock, JHT_DEFAULT_LOCK_STRIPES), 4000, int);
+	// 잠금이 하나뿐이어도 결과는 같다.
+	EXPECT_NUM_EQUAL(RunConcurrentAddFindDelete(RwLock, 1), 4000, int);
+})
+
+// 데이터 8000 개를 저장한 후 스레드 4 개가 동시에 처음/마지막 데이터를 번갈아 삭제하고, 삭제된 데이터 개수를 반환한다.
+// 데이터가 남아 있거나 두 번 이상 또는 한 번도 삭제되지 않은 데이터가 있으면 HASH_FAIL 을 반환한다.
+static int RunConcurrentPop(LockType lockType)
+{
+	int count = 8000;
+	int *keys = (int*)malloc(sizeof(int) * (size_t)count);
+	int *popCounts = (int*)calloc((size_t)count, sizeof(int));
+	int index = 0;
+	int popTotal = 0;
+	pthread_t threads[4];
+	ConcurrentArg args[4];
+
+	JHashTableOption option;
+	JHashTableInitOption(&option);
+	option.lockType = lockType;
+	JHashTablePtr table = NewJHashTableWithOption(count, IntType, IntType, &option);
+	for(index = 0; index < count; index++)
+	{
+		keys[index] = index;
+		JHashTableAddData(table, &keys[index], &keys[index]);
+	}
+
+	for(index = 0; index < 4; index++)
+	{
+		memset(&args[index], 0, sizeof(ConcurrentArg));
+		args[index].table = table;
+		args[index].popCounts = popCounts;
+		pthread_create(&threads[index], NULL, ConcurrentPop, &args[index]);
+	}
+	for(index = 0; index < 4; index++)
+	{
+		pthread_join(threads[index], NULL);
+		popTotal += args[index].result;
+	}
+	for(index = 0; index < count; index++)
+	{
+		if(popCounts[index] != 1) popTotal = HASH_FAIL;
+	}
+	if((JHashTableGetCount(table) != 0) || (JHashTablePopFirst(table) != NULL)) popTotal = HASH_FAIL;
+
+	DeleteJHashTable(&table);
+	free(popCounts);
+	free(keys);
+	return popTotal;
+}
+
+TEST(HashTable_CONCURRENT, ParallelPop, {
+	EXPECT_NUM_EQUAL(RunConcurrentPop(RwLock), 8000, int);
+})
+
+// ---------- LOCK FREE READ Test ----------
+
+static int CountEpochRecords(const JHashTablePtr table)
+{
+	int recordCount = 0;
+	JEpochRecordPtr record = table->epochRecords;
+	for( ; record != NULL; record = record->next) recordCount++;
+	return recordCount;
+}
+
+static void* LockFreeReadOnce(void *data)
+{
+	ConcurrentArg *arg = (ConcurrentArg*)data;
+	if(JHashTableGet(arg->table, &(arg->keys[0])) == &(arg->keys[0])) arg->result++;
+	JHashTableReleaseThread(arg->table);
+	return NULL;
+}
+
+static void* LockFreeReader(void *data)
+{
+	ConcurrentArg *arg = (ConcurrentArg*)data;
+	int round = 0;
+	int index = 0;
+
+	// 짝수 번째 키는 삭제되지 않으므로 항상 검색되어야 한다.
+	for(round = 0; round < 50; round++)
+	{
+		for(index = arg->begin; index < arg->end; index += 2)
+		{
+			if(JHashTableGet(arg->table, &(arg->keys[index])) != &(arg->keys[index])) arg->result++;
+			if(JHashTableFindData(arg->table, &(arg->keys[index]), &(arg->keys[index])) != FindSuccess) arg->result++;
+			JHashTableGet(arg->table, &(arg->keys[index + 1]));
+		}
+		if(JHashTableGetFirstData(arg->table) == NULL) arg->result++;
+	}
+	return NULL;
+}
+
+static void* LockFreeWriter(void *data)
+{
+	ConcurrentArg *arg = (ConcurrentArg*)data;
+	int round = 0;
+	int index = 0;
+
+	// 홀수 번째 키만 반복해서 삭제하고 다시 추가한다.
+	for(round = 0; round < 50; round++)
+	{
+		for(index = arg->begin + 1; index < arg->end; index += 2)
+		{
+			if(JHashTableDeleteData(arg->table, &(arg->keys[index]), &(arg->keys[index])) != DeleteSuccess) arg->result++;
+		}
+		for(index = arg->begin + 1; index < arg->end; index += 2)
+		{
+			if(JHashTableAddData(arg->table, &(arg->keys[index]), &(arg->keys[index])) == NULL) arg->result++;
+		}
+	}
+	return NULL;
+}
+
+TEST(HashTable_LOCKFREE, CreateWithLockFreeRead, {
+	int keys[10];
+	int index = 0;
+	JHashTableOption option;
+	JHashTableInitOption(&option);
+	EXPECT_NUM_EQUAL(option.lockFreeRead, 0, int);
+
+	// 잠금 없는 검색은 동시 접근 모드에서만 사용할 수 있다.
+	option.lockFreeRead = 1;
+	EXPECT_NULL(NewJHashTableWithOption(10, IntType, IntType, &option));
+
+	option.lockType = RwLock;
+	JHashTablePtr table = NewJHashTableWithOption(10, IntType, IntType, &option);
+	EXPECT_NOT_NULL(table);
+	EXPECT_NUM_EQUAL(table->lockFreeRead, 1, int);
+	EXPECT_NUM_EQUAL((table->globalEpoch == 1), 1, int);
+	EXPECT_NULL(table->epochRecords);
+
+	for(index = 0; index < 10; index++)
+	{
+		keys[index] = index;
+		JHashTableAddData(table, &keys[index], &keys[index]);
+	}
+	// 처음 검색할 때 스레드의 검색 상태가 등록되고, 검색이 끝나면 epoch 게시를 해제한다.
+	EXPECT_PTR_EQUAL(JHashTableGet(table, &keys[3]), &keys[3]);
+	EXPECT_NUM_EQUAL(JHashTableFindData(table, &keys[4], &keys[4]), FindSuccess, int);
+	EXPECT_PTR_EQUAL(JHashTableGetFirstData(table), &keys[0]);
+	EXPECT_PTR_EQUAL(JHashTableGetLastData(table), &keys[9]);
+	EXPECT_NUM_EQUAL(CountEpochRecords(table), 1, int);
+	EXPECT_NUM_EQUAL((table->epochRecords->localEpoch == 0), 1, int);
+
+	JHashTableReleaseThread(table);
+	EXPECT_NUM_EQUAL(table->epochRecords->isUsed, 0, int);
+	EXPECT_PTR_EQUAL(JHashTableGet(table, &keys[5]), &keys[5]);
+	EXPECT_NUM_EQUAL(CountEpochRecords(table), 1, int);
+	EXPECT_NUM_EQUAL(table->epochRecords->isUsed, 1, int);
+
+	DeleteJHashTable(&table);
+})
+
+TEST(HashTable_LOCKFREE, RetireAndReclaimNodes, {
+	int count = 1000;
+	int *keys = (int*)malloc(sizeof(int) * (size_t)count);
+	int index = 0;
+	JHashTableOption option;
+	JHashTableInitOption(&option);
+	option.lockType = SpinLock;
+	option.lockStripeCount = 1;
+	option.lockFreeRead = 1;
+	JHashTablePtr table = NewJHashTableWithOption(count, IntType, IntType, &option);
+	JLockStripePtr lockStripe = &(table->lockStripes[0]);
+
+	for(index = 0; index < count; index++)
+	{
+		keys[index] = index;
+		JHashTableAddData(table, &keys[index], &keys[index]);
+	}
+	int usedNodes = lockStripe->pool.nodes.usedObjects;
+
+	// 삭제된 노드는 바로 해제되지 않고, 검색 중인 스레드가 없으면 epoch 가 진행되면서 해제된다.
+	EXPECT_NUM_EQUAL(JHashTableDeleteData(table, &keys[0], &keys[0]), DeleteSuccess, int);
+	EXPECT_NUM_EQUAL(lockStripe->retired.count, 1, int);
+	EXPECT_NUM_EQUAL(lockStripe->pool.nodes.usedObjects, usedNodes, int);
+	EXPECT_NULL(JHashTableGet(table, &keys[0]));
+
+	for(index = 1; index < count; index++) JHashTableDeleteData(table, &keys[index], &keys[index]);
+	EXPECT_NUM_EQUAL(JHashTableGetCount(table), 0, int);
+	EXPECT_NUM_LESS_EQUAL(lockStripe->retired.count, JHT_RECLAIM_THRESHOLD, int);
+	EXPECT_NUM_LESS_EQUAL(lockStripe->pool.nodes.usedObjects, usedNodes - count + JHT_RECLAIM_THRESHOLD, int);
+	EXPECT_NUM_EQUAL((table->globalEpoch > 1), 1, int);
+
+	// 검색 중인 스레드가 없으면 Synchronize 는 epoch 를 두 번 진행하고 바로 반환한다.
+	uint64_t epoch = table->globalEpoch;
+	JHashTableSynchronize(table);
+	EXPECT_NUM_EQUAL((table->globalEpoch >= epoch + 2), 1, int);
+	JHashTableSynchronize(NULL);
+
+	DeleteJHashTable(&table);
+	free(keys);
+})
+
+TEST(HashTable_LOCKFREE, ReadersWithWriter, {
+	int count = 2000;
+	int *keys = (int*)malloc(sizeof(int) * (size_t)count);
+	int index = 0;
+	int errorCount = 0;
+	pthread_t threads[4];
+	ConcurrentArg args[4];
+	LockType lockTypes[2];
+	int useNodePools[2];
+	int caseIndex = 0;
+
+	lockTypes[0] = RwLock;
+	lockTypes[1] = SpinLock;
+	useNodePools[0] = 1;
+	useNodePools[1] = 0;
+	for(index = 0; index < count; index++) keys[index] = index;
+
+	for(caseIndex = 0; caseIndex < 2; caseIndex++)
+	{
+		JHashTableOption option;
+		JHashTableInitOption(&option);
+		option.lockType = lockTypes[caseIndex];
+		option.useNodePool = useNodePools[caseIndex];
+		option.lockFreeRead = 1;
+		JHashTablePtr table = NewJHashTableWithOption(256, IntType, IntType, &option);
+		for(index = 0; index < count; index++) JHashTableAddData(table, &keys[index], &keys[index]);
+
+		for(index = 0; index < 4; index++)
+		{
+			memset(&args[index], 0, sizeof(ConcurrentArg));
+			args[index].table = table;
+			args[index].keys = keys;
+			args[index].begin = (index % 2) * (count / 2);
+			args[index].end = args[index].begin + (count / 2);
+			pthread_create(&threads[index], NULL, (index == 0) ? LockFreeWriter : LockFreeReader, &args[index]);
+		}
+		for(index = 0; index < 4; index++)
+		{
+			pthread_join(threads[index], NULL);
+			errorCount += args[index].result;
+		}
+		EXPECT_NUM_EQUAL(JHashTableGetCount(table), count, int);
+
+		DeleteJHashTable(&table);
+	}
+	EXPECT_NUM_EQUAL(errorCount, 0, int);
+
+	free(keys);
+})
+
+TEST(HashTable_LOCKFREE, ReuseReleasedThreadState, {
+	int key = 7;
+	int index = 0;
+	int foundCount = 0;
+	pthread_t thread;
+	ConcurrentArg arg;
+	JHashTableOption option;
+	JHashTableInitOption(&option);
+	option.lockType = RwLock;
+	option.lockFreeRead = 1;
+	JHashTablePtr table = NewJHashTableWithOption(10, IntType, IntType, &option);
+	JHashTableAddData(table, &key, &key);
+
+	// 검색 후 검색 상태를 반환하고 종료하는 스레드들은 하나의 검색 상태를 재사용한다.
+	for(index = 0; index < 4; index++)
+	{
+		memset(&arg, 0, sizeof(ConcurrentArg));
+		arg.table = table;
+		arg.keys = &key;
+		pthread_create(&thread, NULL, LockFreeReadOnce, &arg);
+		pthread_join(thread, NULL);
+		foundCount += arg.result;
+	}
+	EXPECT_NUM_EQUAL(foundCount, 4, int);
+	EXPECT_NUM_EQUAL(CountEpochRecords(table), 1, int);
+
+	DeleteJHashTable(&table);
+})
+
+// ---------- SHARDED Test ----------
+
+static void* ShardedAddFindDelete(void *data)
+{
+	ConcurrentArg *arg = (ConcurrentArg*)data;
+	int index = 0;
+
+	for(index = arg->begin; index < arg->end; index++)
+	{
+		if(JShardedHashTableAddData(arg->shardedTable, &(arg->keys[index]), &(arg->keys[index])) != NULL) arg->result++;
+	}
+	for(index = arg->begin; index < arg->end; index++)
+	{
+		if(JShardedHashTableFindData(arg->shardedTable, &(arg->keys[index]), &(arg->keys[index])) == FindSuccess) arg->result++;
+		if(JShardedHashTableGet(arg->shardedTable, &(arg->keys[index])) == &(arg->keys[index])) arg->result++;
+	}
+	// 짝수 번째 키만 삭제
+	for(index = arg->begin; index < arg->end; index += 2)
+	{
+		if(JShardedHashTableDeleteData(arg->shardedTable, &(arg->keys[index]), &(arg->keys[index])) == DeleteSuccess) arg->result++;
+	}
+	return NULL;
+}
+
+// 스레드 4 개가 서로 다른 키 범위를 샤드 테이블에 동시에 추가, 검색, 삭제한 후 남은 데이터 개수를 반환한다.
+// 샤드는 작은 크기로 시작해서 자동 확장(재해싱)하며, 한 스레드라도 실패한 연산이 있으면 HASH_FAIL 을 반환한다.
+static int RunShardedAddFindDelete(LockType lockType, StorageType storageType)
+{
+	int threadCount = 4;
+	int perThread = 2000;
+	int *keys = (int*)malloc(sizeof(int) * (size_t)(threadCount * perThread));
+	int index = 0;
+	int result = 0;
+	pthread_t threads[4];
+	ConcurrentArg args[4];
+
+	JHashTableOption option;
+	JHashTableInitOption(&option);
+	option.storageType = storageType;
+	JShardedHashTablePtr table = NewJShardedHashTable(8, 64, IntType, IntType, lockType, &option);
+
+	for(index = 0; index < threadCount * perThread; index++) keys[index] = index;
+	for(index = 0; index < threadCount; index++)
+	{
+		memset(&args[index], 0, sizeof(ConcurrentArg));
+		args[index].shardedTable = table;
+		args[index].keys = keys;
+		args[index].begin = index * perThread;
+		args[index].end = (index + 1) * perThread;
+		pthread_create(&threads[index], NULL, ShardedAddFindDelete, &args[index]);
+	}
+	for(index = 0; index < threadCount; index++)
+	{
+		pthread_join(threads[index], NULL);
+		if(args[index].result != perThread * 3 + perThread / 2) result = HASH_FAIL;
+	}
+
+	// 홀수 번째 키만 남아 있어야 한다.
+	for(index = 0; (result == 0) && (index < threadCount * perThread); index++)
+	{
+		if((JShardedHashTableGet(table, &keys[index]) != NULL) != (index % 2 == 1)) result = HASH_FAIL;
+	}
+	if(result == 0) result = JShardedHashTableGetCount(table);
+
+	DeleteJShardedHashTable(&table);
+	free(keys);
+	return result;
+}
+
+TEST(HashTable_SHARDED, CreateAndRoute, {
+	int keys[1000];
+	int index = 0;
+	int shardIndex = 0;
+	int countSum = 0;
+	int addSum = 0;
+	int isEveryShardUsed = 1;
+	int isRoutedToShard = 1;
+	JHashShardStats stats;
+
+	// 샤드 개수는 2 의 거듭제곱으로 올림하고, 샤드는 캐시 라인 단위로 정렬한다.
+	JShardedHashTablePtr table = NewJShardedHashTable(5, 80, IntType, IntType, RwLock, NULL);
+	EXPECT_NOT_NULL(table);
+	EXPECT_NUM_EQUAL(JShardedHashTableGetShardCount(table), 8, int);
+	EXPECT_NUM_EQUAL((int)(((uintptr_t)table->shards) % JHT_CACHE_LINE_SIZE), 0, int);
+	EXPECT_NUM_EQUAL((int)(sizeof(JHashShard) % JHT_CACHE_LINE_SIZE), 0, int);
+	EXPECT_NUM_EQUAL(JHashTableGetSize(table->shards[0].table), 10, int);
+
+	for(index = 0; index < 1000; index++)
+	{
+		keys[index] = index;
+		EXPECT_PTR_EQUAL(JShardedHashTableAddData(table, &keys[index], &keys[index]), table);
+	}
+	EXPECT_NUM_EQUAL(JShardedHashTableGetCount(table), 1000, int);
+
+	// 키는 항상 같은 샤드에 저장되고, 연속된 정수 키도 모든 샤드에 나뉜다.
+	for(index = 0; index < 1000; index++)
+	{
+		shardIndex = JShardedHashTableGetShardIndex(table, &keys[index]);
+		if(JHashTableGet(table->shards[shardIndex].table, &keys[index]) != &keys[index]) isRoutedToShard = 0;
+		EXPECT_PTR_EQUAL(JShardedHashTableGet(table, &keys[index]), &keys[index]);
+	}
+	EXPECT_NUM_EQUAL(isRoutedToShard, 1, int);
+
+	for(shardIndex = 0; shardIndex < 8; shardIndex++)
+	{
+		EXPECT_PTR_EQUAL(JShardedHashTableGetShardStats(table, shardIndex, &stats), &stats);
+		if(stats.count == 0) isEveryShardUsed = 0;
+		countSum += stats.count;
+		addSum += (int)stats.addCount;
+		// 샤드마다 적재율 기준에 따라 자동 확장한다.
+		EXPECT_NUM_LESS_EQUAL(stats.count, stats.size * 2, int);
+	}
+	EXPECT_NUM_EQUAL(isEveryShardUsed, 1, int);
+	EXPECT_NUM_EQUAL(countSum, 1000, int);
+	EXPECT_NUM_EQUAL(addSum, 1000, int);
+
+	EXPECT_NUM_EQUAL(JShardedHashTableFindData(table, &keys[7], &keys[7]), FindSuccess, int);
+	EXPECT_NUM_EQUAL(JShardedHashTableDeleteData(table, &keys[7], &keys[7]), DeleteSuccess, int);
+	EXPECT_NUM_EQUAL(JShardedHashTableFindData(table, &keys[7], &keys[7]), FindFail, int);
+	EXPECT_NUM_EQUAL(JShardedHashTableRemoveKey(table, &keys[8]), DeleteSuccess, int);
+	EXPECT_NULL(JShardedHashTableGet(table, &keys[8]));
+	EXPECT_NUM_EQUAL(JShardedHashTableRemoveKey(table, &keys[8]), DeleteFail, int);
+	EXPECT_NUM_EQUAL(JShardedHashTableGetCount(table), 998, int);
+
+	EXPECT_NULL(JShardedHashTableGetShardStats(table, 8, &stats));
+	EXPECT_NULL(JShardedHashTableGetShardStats(table, 0, NULL));
+	EXPECT_NUM_EQUAL(JShardedHashTableGetShardIndex(table, NULL), HASH_FAIL, int);
+	EXPECT_NUM_EQUAL(DeleteJShardedHashTable(&table), DeleteSuccess, int);
+	EXPECT_NULL(table);
+	EXPECT_NUM_EQUAL(DeleteJShardedHashTable(&table), DeleteFail, int);
+
+	// 샤드가 하나이면 모든 키가 첫 번째 샤드에 저장된다.
+	table = NewJShardedHashTable(1, 16, IntType, IntType, SpinLock, NULL);
+	EXPECT_NUM_EQUAL(JShardedHashTableGetShardIndex(table, &keys[123]), 0, int);
+	DeleteJShardedHashTable(&table);
+
+	// 잘못된 설정과 동시 접근 모드의 샤드 옵션은 생성하지 않는다.
+	JHashTableOption option;
+	JHashTableInitOption(&option);
+	option.lockType = RwLock;
+	EXPECT_NULL(NewJShardedHashTable(4, 16, IntType, IntType, RwLock, &option));
+	EXPECT_NULL(NewJShardedHashTable(0, 16, IntType, IntType, RwLock, NULL));
+	EXPECT_NULL(NewJShardedHashTable(JHT_MAX_SHARDS + 1, 16, IntType, IntType, RwLock, NULL));
+	EXPECT_NULL(NewJShardedHashTable(4, 0, IntType, IntType, RwLock, NULL));
+	EXPECT_NULL(NewJShardedHashTable(4, 16, IntType, IntType, (LockType)100, NULL));
+	EXPECT_NULL(NewJShardedHashTable(4, 16, Unknown, IntType, RwLock, NULL));
+	EXPECT_NUM_EQUAL(JShardedHashTableGetShardCount(NULL), Unknown, int);
+	EXPECT_NUM_EQUAL(JShardedHashTableGetCount(NULL), Unknown, int);
+	EXPECT_NULL(JShardedHashTableAddData(NULL, &keys[0], &keys[0]));
+})
+
+TEST(HashTable_SHARDED, StringKeys, {
+	char *keys[7];
+	int values[7];
+	int index = 0;
+	keys[0] = "apple";
+	keys[1] = "banana";
+	keys[2] = "cherry";
+	keys[3] = "durian";
+	keys[4] = "elder";
+	keys[5] = "fig";
+	keys[6] = "grape";
+
+	JShardedHashTablePtr table = NewJShardedHashTable(4, 16, StringType, IntType, NoLock, NULL);
+	for(index = 0; index < 7; index++)
+	{
+		values[index] = index;
+		JShardedHashTableAddData(table, keys[index], &values[index]);
+	}
+
+	// 키는 값으로 비교하므로 다른 주소의 같은 문자열로도 검색된다.
+	char key[16];
+	snprintf(key, sizeof(key), "%s", "cherry");
+	EXPECT_PTR_EQUAL(JShardedHashTableGet(table, key), &values[2]);
+	EXPECT_NUM_EQUAL(JShardedHashTableGetCount(table), 7, int);
+	DeleteJShardedHashTable(&table);
+})
+
+TEST(HashTable_SHARDED, ParallelAddFindDelete, {
+	EXPECT_NUM_EQUAL(RunShardedAddFindDelete(RwLock, ChainStorage), 4000, int);
+	EXPECT_NUM_EQUAL(RunShardedAddFindDelete(SpinLock, ChainStorage), 4000, int);
+	// 샤드는 잠금 하나로 보호하므로 Open Addressing 저장소도 사용할 수 있다.
+	EXPECT_NUM_EQUAL(RunShardedAddFindDelete(RwLock, OpenAddressStorage), 4000, int);
+})
+
+static void* ShardedGetOnce(void *data)
+{
+	ConcurrentArg *arg = (ConcurrentArg*)data;
+	if(JShardedHashTableGet(arg->shardedTable, &(arg->keys[0])) == &(arg->keys[0])) arg->result++;
+	return NULL;
+}
+
+TEST(HashTable_SHARDED, CountContention, {
+	JHashShardStats stats;
+	int key = 1;
+	int shardIndex = 0;
+	pthread_t thread;
+	ConcurrentArg arg;
+
+	JShardedHashTablePtr table = NewJShardedHashTable(2, 16, IntType, IntType, RwLock, NULL);
+	JShardedHashTableAddData(table, &key, &key);
+	shardIndex = JShardedHashTableGetShardIndex(table, &key);
+	JHashShardPtr shard = &(table->shards[shardIndex]);
+
+	// 쓰기 잠금을 잡고 있는 동안 다른 스레드의 검색은 기다린 횟수로 기록된 후 잠금이 풀리면 진행된다.
+	memset(&arg, 0, sizeof(ConcurrentArg));
+	arg.shardedTable = table;
+	arg.keys = &key;
+	pthread_rwlock_wrlock(&(shard->rwlock));
+	pthread_create(&thread, NULL, ShardedGetOnce, &arg);
+	while(__atomic_load_n(&(shard->contendedCount), __ATOMIC_RELAXED) == 0) sched_yield();
+	pthread_rwlock_unlock(&(shard->rwlock));
+	pthread_join(thread, NULL);
+	EXPECT_NUM_EQUAL(arg.result, 1, int);
+
+	JShardedHashTableGetShardStats(table, shardIndex, &stats);
+	EXPECT_NUM_EQUAL(stats.count, 1, int);
+	EXPECT_NUM_EQUAL((int)stats.addCount, 1, int);
+	EXPECT_NUM_EQUAL((int)stats.findCount, 1, int);
+	EXPECT_NUM_EQUAL((int)stats.deleteCount, 0, int);
+	EXPECT_NUM_EQUAL((int)stats.contendedCount, 1, int);
+	DeleteJShardedHashTable(&table);
+})
+
+// ---------- LOCK FREE BUCKET Test ----------
+
+// 스레드 4 개가 모두 같은 키와 데이터를 추가한 후 모두 같은 키와 데이터를 삭제한다.
+static void* LockFreeSameKeys(void *data)
+{
+	ConcurrentArg *arg = (ConcurrentArg*)data;
+	int index = 0;
+
+	for(index = arg->begin; index < arg->end; index++)
+	{
+		if(JHashTableAddData(arg->table, &(arg->keys[index]), &(arg->keys[index])) != NULL) arg->result++;
+	}
+	// 모든 스레드가 추가를 마칠 때까지 기다린다.
+	__atomic_fetch_add(arg->popCounts, 1, __ATOMIC_RELAXED);
+	while(__atomic_load_n(arg->popCounts, __ATOMIC_RELAXED) < 4) sched_yield();
+	for(index = arg->begin; index < arg->end; index++)
+	{
+		if(JHashTableDeleteData(arg->table, &(arg->keys[index]), &(arg->keys[index])) == DeleteSuccess) arg->popCounts[1 + index]++;
+	}
+	return NULL;
+}
+
+TEST(HashTable_LFBUCKET, CreateAndBasicOperations, {
+	int keys[100];
+	int values[100];
+	int index = 0;
+	JHashTableOption option;
+	JHashTableInitOption(&option);
+	option.lockType = LockFree;
+
+	JHashTablePtr table = NewJHashTableWithOption(10, IntType, IntType, &option);
+	EXPECT_NOT_NULL(table);
+	EXPECT_NUM_EQUAL(JHashTableGetLockType(table), LockFree, int);
+	EXPECT_NOT_NULL(table->lockFreeBuckets);
+	EXPECT_NULL(table->listContainer);
+	EXPECT_NULL(table->lockStripes);
+	EXPECT_NULL(JHashTableGetFirstData(table));
+	EXPECT_NULL(JHashTablePopLast(table));
+
+	for(index = 0; index < 100; index++)
+	{
+		keys[index] = index;
+		values[index] = index * 10;
+		EXPECT_PTR_EQUAL(JHashTableAddData(table, &keys[index], &values[index]), table);
+	}
+	// 같은 키와 데이터는 중복 검사 시 추가하지 않고, 자동 확장은 하지 않는다.
+	EXPECT_NULL(JHashTableAddData(table, &keys[5], &values[5]));
+	EXPECT_NUM_EQUAL(JHashTableGetCount(table), 100, int);
+	EXPECT_NUM_EQUAL(JHashTableGetSize(table), 10, int);
+
+	// 한 버킷 안에서는 해쉬값 순서로 저장되므로, 정수 키는 키 순서와 같다.
+	EXPECT_PTR_EQUAL(JHashTableGetFirstData(table), &values[0]);
+	EXPECT_PTR_EQUAL(JHashTableGetLastData(table), &values[99]);
+	EXPECT_PTR_EQUAL(JHashTableGet(table, &keys[42]), &values[42]);
+	EXPECT_NUM_EQUAL(JHashTableFindData(table, &keys[42], &values[42]), FindSuccess, int);
+	EXPECT_NUM_EQUAL(JHashTableFindData(table, &keys[42], &values[43]), FindFail, int);
+
+	// 같은 키에 여러 데이터를 저장하면 먼저 추가한 데이터를 반환하고, RemoveKey 는 모두 삭제한다.
+	EXPECT_PTR_EQUAL(JHashTableAddUnchecked(table, &keys[7], &values[8]), table);
+	EXPECT_PTR_EQUAL(JHashTableGet(table, &keys[7]), &values[7]);
+	EXPECT_NUM_EQUAL(JHashTableDeleteData(table, &keys[7], &values[7]), DeleteSuccess, int);
+	EXPECT_PTR_EQUAL(JHashTableGet(table, &keys[7]), &values[8]);
+	EXPECT_PTR_EQUAL(JHashTableAddData(table, &keys[7], &values[7]), table);
+	EXPECT_NUM_EQUAL(JHashTableRemoveKey(table, &keys[7]), DeleteSuccess, int);
+	EXPECT_NULL(JHashTableGet(table, &keys[7]));
+	EXPECT_NUM_EQUAL(JHashTableRemoveKey(table, &keys[7]), DeleteFail, int);
+	EXPECT_NUM_EQUAL(JHashTableDeleteData(table, &keys[7], &values[7]), DeleteFail, int);
+	EXPECT_NUM_EQUAL(JHashTableGetCount(table), 99, int);
+
+	EXPECT_PTR_EQUAL(JHashTablePopFirst(table), &values[0]);
+	EXPECT_PTR_EQUAL(JHashTablePopLast(table), &values[99]);
+	EXPECT_NUM_EQUAL(JHashTableDeleteFirstData(table), DeleteSuccess, int);
+	EXPECT_NUM_EQUAL(JHashTableGetCount(table), 96, int);
+	while(JHashTablePopLast(table) != NULL);
+	EXPECT_NUM_EQUAL(JHashTableGetCount(table), 0, int);
+	EXPECT_NULL(JHashTableGetLastData(table));
+	DeleteJHashTable(&table);
+
+	// 문자열 키도 값으로 비교한다.
+	table = NewJHashTableWithOption(4, StringType, IntType, &option);
+	char key[8];
+	snprintf(key, sizeof(key), "%s", "key");
+	JHashTableAddData(table, "key", &values[1]);
+	EXPECT_PTR_EQUAL(JHashTableGet(table, key), &values[1]);
+	DeleteJHashTable(&table);
+
+	// Open Addressing 저장소에서는 사용할 수 없다.
+	option.storageType = OpenAddressStorage;
+	EXPECT_NULL(NewJHashTableWithOption(10, IntType, IntType, &option));
+})
+
+TEST(HashTable_LFBUCKET, RetireAndReclaimNodes, {
+	int count = 1000;
+	int *keys = (int*)malloc(sizeof(int) * (size_t)count);
+	int index = 0;
+	JHashTableOption option;
+	JHashTableInitOption(&option);
+	option.lockType = LockFree;
+	JHashTablePtr table = NewJHashTableWithOption(count, IntType, IntType, &option);
+
+	for(index = 0; index < count; index++)
+	{
+		keys[index] = index;
+		JHashTableAddData(table, &keys[index], &keys[index]);
+	}
+
+	// 분리된 노드는 스레드의 삭제 대기 목록에 들어가고, epoch 가 진행되면서 해제된다.
+	EXPECT_NUM_EQUAL(JHashTableDeleteData(table, &keys[0], &keys[0]), DeleteSuccess, int);
+	EXPECT_NOT_NULL(table->epochRecords);
+	EXPECT_NUM_EQUAL(table->epochRecords->retired.count, 1, int);
+	for(index = 1; index < count; index++) JHashTableDeleteData(table, &keys[index], &keys[index]);
+	EXPECT_NUM_EQUAL(JHashTableGetCount(table), 0, int);
+	EXPECT_NUM_LESS_EQUAL(table->epochRecords->retired.count, JHT_RECLAIM_THRESHOLD, int);
+	EXPECT_NUM_EQUAL((table->globalEpoch > 1), 1, int);
+
+	// 남은 삭제 대기 노드는 테이블 삭제 시 해제된다.
+	DeleteJHashTable(&table);
+	free(keys);
+})
+
+TEST(HashTable_LFBUCKET, ParallelAddFindDelete, {
+	EXPECT_NUM_EQUAL(RunConcurrentAddFindDelete(LockFree, JHT_DEFAULT_LOCK_STRIPES), 4000, int);
+})
+
+TEST(HashTable_LFBUCKET, ParallelPop, {
+	EXPECT_NUM_EQUAL(RunConcurrentPop(LockFree), 8000, int);
+})
+
+TEST(HashTable_LFBUCKET, SameKeysFromAllThreads, {
+	int count = 2000;
+	int *keys = (int*)malloc(sizeof(int) * (size_t)count);
+	int *deleteCounts = (int*)calloc((size_t)(count + 1), sizeof(int));
+	int index = 0;
+	int addTotal = 0;
+	int isDeletedOnce = 1;
+	pthread_t threads[4];
+	ConcurrentArg args[4];
+
+	JHashTableOption option;
+	JHashTableInitOption(&option);
+	option.lockType = LockFree;
+	JHashTablePtr table = NewJHashTableWithOption(256, IntType, IntType, &option);
+
+	for(index = 0; index < count; index++) keys[index] = index;
+	for(index = 0; index < 4; index++)
+	{
+		memset(&args[index], 0, sizeof(ConcurrentArg));
+		args[index].table = table;
+		args[index].keys = keys;
+		args[index].begin = 0;
+		args[index].end = count;
+		args[index].popCounts = deleteCounts;
+		pthread_create(&threads[index], NULL, LockFreeSameKeys, &args[index]);
+	}
+	for(index = 0; index < 4; index++)
+	{
+		pthread_join(threads[index], NULL);
+		addTotal += args[index].result;
+	}
+	for(index = 0; index < count; index++)
+	{
+		if(deleteCounts[1 + index] != 1) isDeletedOnce = 0;
+	}
+
+	// 같은 키와 데이터는 한 스레드만 추가하고, 한 스레드만 삭제한다.
+	EXPECT_NUM_EQUAL(addTotal, count, int);
+	EXPECT_NUM_EQUAL(isDeletedOnce, 1, int);
+	EXPECT_NUM_EQUAL(JHashTableGetCount(table), 0, int);
+
+	DeleteJHashTable(&table);
+	free(deleteCounts);
+	free(keys);
+})
+
+// ---------- CONCURRENT RESIZE Test ----------
+
+// 앞의 스레드 2 개는 서로 다른 키 범위를 추가하고, 뒤의 스레드 2 개는 추가가 끝날 때까지 처음/마지막 데이터를 삭제한다.
+// popCounts[0] 은 추가를 마친 스레드 개수, popCounts[1 + 키] 는 키별 삭제 횟수이다.
+static void* ConcurrentGrowAndPop(void *data)
+{
+	ConcurrentArg *arg = (ConcurrentArg*)data;
+	int index = 0;
+	int isAddDone = 0;
+	void *popped = NULL;
+
+	if(arg->keys != NULL)
+	{
+		for(index = arg->begin; index < arg->end; index++)
+		{
+			if(JHashTableAddData(arg->table, &(arg->keys[index]), &(arg->keys[index])) != NULL) arg->result++;
+		}
+		__atomic_fetch_add(&(arg->popCounts[0]), 1, __ATOMIC_RELEASE);
+		return NULL;
+	}
+
+	while(1)
+	{
+		// 추가가 모두 끝난 것을 확인한 후에 비어 있으면 종료한다.
+		isAddDone = (__atomic_load_n(&(arg->popCounts[0]), __ATOMIC_ACQUIRE) == 2);
+		popped = (arg->result % 2 == 0) ? JHashTablePopFirst(arg->table) : JHashTablePopLast(arg->table);
+		if(popped == NULL)
+		{
+			if(isAddDone != 0) break;
+			sched_yield();
+			continue;
+		}
+		__atomic_fetch_add(&(arg->popCounts[1 + *((int*)popped)]), 1, __ATOMIC_RELAXED);
+		arg->result++;
+	}
+	return NULL;
+}
+
+TEST(HashTable_CRESIZE, CreateAndGrow, {
+	int count = 2000;
+	int *keys = (int*)malloc(sizeof(int) * (size_t)count);
+	int index = 0;
+	int isFound = 1;
+	int isCheckedDuringRehash = 0;
+	int popCount = 0;
+	JHashTableOption option;
+	JHashTableInitOption(&option);
+	option.lockType = RwLock;
+	option.lockStripeCount = 4;
+	option.cooperativeResize = 1;
+
+	// 잠금 없는 검색, 잠금 없는 버킷, 단일 스레드 모드에서는 사용할 수 없다.
+	option.lockFreeRead = 1;
+	EXPECT_NULL(NewJHashTableWithOption(8, IntType, IntType, &option));
+	option.lockFreeRead = 0;
+	option.lockType = LockFree;
+	EXPECT_NULL(NewJHashTableWithOption(8, IntType, IntType, &option));
+	option.lockType = NoLock;
+	EXPECT_NULL(NewJHashTableWithOption(8, IntType, IntType, &option));
+	option.lockType = RwLock;
+
+	JHashTablePtr table = NewJHashTableWithOption(8, IntType, IntType, &option);
+	EXPECT_NOT_NULL(table);
+	EXPECT_NUM_EQUAL(table->cooperativeResize, 1, int);
+	for(index = 0; index < count; index++)
+	{
+		keys[index] = index;
+		EXPECT_PTR_EQUAL(JHashTableAddData(table, &keys[index], &keys[index]), table);
+
+		// 재해싱 중에도 옮겨진 Slot 과 옮겨지지 않은 Slot 의 데이터를 모두 찾는다.
+		if((isCheckedDuringRehash == 0) && (table->rehashContainer != NULL) && (table->rehashDoneCount > 0)
+			&& (table->rehashDoneCount < table->size))
+		{
+			int checkIndex = 0;
+			for( ; checkIndex <= index; checkIndex++)
+			{
+				if(JHashTableGet(table, &keys[checkIndex]) != &keys[checkIndex]) isFound = 0;
+			}
+			isCheckedDuringRehash = 1;
+		}
+	}
+	EXPECT_NUM_EQUAL(isCheckedDuringRehash, 1, int);
+	EXPECT_NUM_EQUAL(isFound, 1, int);
+	EXPECT_NUM_EQUAL(JHashTableGetCount(table), count, int);
+	EXPECT_NUM_EQUAL((JHashTableGetSize(table) >= 1024), 1, int);
+	EXPECT_NUM_EQUAL(table->lockBaseSize, 8, int);
+
+	for(index = 0; index < count; index++)
+	{
+		if(JHashTableFindData(table, &keys[index], &keys[index]) != FindSuccess) isFound = 0;
+	}
+	EXPECT_NUM_EQUAL(isFound, 1, int);
+	for(index = 0; index < count; index += 2) JHashTableDeleteData(table, &keys[index], &keys[index]);
+	EXPECT_NUM_EQUAL(JHashTableGetCount(table), count / 2, int);
+	EXPECT_NUM_EQUAL(JHashTableRemoveKey(table, &keys[1]), DeleteSuccess, int);
+	EXPECT_NULL(JHashTableGet(table, &keys[1]));
+
+	while(((popCount % 2 == 0) ? JHashTablePopFirst(table) : JHashTablePopLast(table)) != NULL) popCount++;
+	EXPECT_NUM_EQUAL(popCount, count / 2 - 1, int);
+	EXPECT_NUM_EQUAL(JHashTableGetCount(table), 0, int);
+
+	DeleteJHashTable(&table);
+	free(keys);
+})
+
+TEST(HashTable_CRESIZE, ParallelGrowth, {
+	int tableSize = 0;
+	JHashTableOption option;
+	JHashTableInitOption(&option);
+	option.lockType = RwLock;
+	option.lockStripeCount = 8;
+	option.cooperativeResize = 1;
+
+	// 버킷 16 개에서 시작해 데이터 8000 개를 추가하는 동안 여러 번 확장한다.
+	EXPECT_NUM_EQUAL(RunConcurrentAddFindDeleteWithOption(16, &option, &tableSize), 4000, int);
+	EXPECT_NUM_EQUAL((tableSize >= 4096), 1, int);
+
+	option.lockType = SpinLock;
+	option.powerOfTwoBuckets = 1;
+	option.useNodePool = 0;
+	EXPECT_NUM_EQUAL(RunConcurrentAddFindDeleteWithOption(16, &option, &tableSize), 4000, int);
+	EXPECT_NUM_EQUAL((tableSize >= 4096), 1, int);
+})
+
+TEST(HashTable_CRESIZE, PopWhileGrowing, {
+	int count = 8000;
+	int *keys = (int*)malloc(sizeof(int) * (size_t)count);
+	int *popCounts = (int*)calloc((size_t)(count + 1), sizeof(int));
+	int index = 0;
+	int addTotal = 0;
+	int popTotal = 0;
+	int isPoppedOnce = 1;
+	pthread_t threads[4];
+	ConcurrentArg args[4];
+
+	JHashTableOption option;
+	JHashTableInitOption(&option);
+	option.lockType = RwLock;
+	option.cooperativeResize = 1;
+	JHashTablePtr table = NewJHashTableWithOption(16, IntType, IntType, &option);
+
+	for(index = 0; index < count; index++) keys[index] = index;
+	for(index = 0; index < 4; index++)
+	{
+		memset(&args[index], 0, sizeof(ConcurrentArg));
+		args[index].table = table;
+		args[index].popCounts = popCounts;
+		if(index < 2)
+		{
+			args[index].keys = keys;
+			args[index].begin = index * (count / 2);
+			args[index].end = (index + 1) * (count / 2);
+		}
+		pthread_create(&threads[index], NULL, ConcurrentGrowAndPop, &args[index]);
+	}
+	for(index = 0; index < 4; index++)
+	{
+		pthread_join(threads[index], NULL);
+		if(index < 2) addTotal += args[index].result;
+		else popTotal += args[index].result;
+	}
+	for(index = 0; index < count; index++)
+	{
+		if(popCounts[1 + index] != 1) isPoppedOnce = 0;
+	}
+
+	// 추가한 데이터는 확장 중에도 정확히 한 번씩 삭제된다.
+	EXPECT_NUM_EQUAL(addTotal, count, int);
+	EXPECT_NUM_EQUAL(popTotal, count, int);
+	EXPECT_NUM_EQUAL(isPoppedOnce, 1, int);
+	EXPECT_NUM_EQUAL(JHashTableGetCount(table), 0, int);
+
+	DeleteJHashTable(&table);
+	free(popCounts);
+	free(keys);
+})
+
+// ---------- PARALLEL BUILD Test ----------
+
+// 두 테이블의 버킷 개수와 버킷별 노드 순서(키, 데이터)가 같으면 1 반환
+static int IsSameBuckets(const JHashTablePtr table1, const JHashTablePtr table2)
+{
+	if(table1->size != table2->size) return 0;
+
+	int listIndex = 0;
+	JNodePtr node1 = NULL;
+	JNodePtr node2 = NULL;
+	for( ; listIndex < table1->size; listIndex++)
+	{
+		if(JLinkedListGetSize(table1->listContainer[listIndex]) <= 0)
+		{
+			if(JLinkedListGetSize(table2->listContainer[listIndex]) > 0) return 0;
+			continue;
+		}
+		if(JLinkedListGetSize(table2->listContainer[listIndex]) != table1->listContainer[listIndex]->size) return 0;
+
+		node1 = table1->listContainer[listIndex]->head->next;
+		node2 = table2->listContainer[listIndex]->head->next;
+		for( ; node1 != table1->listContainer[listIndex]->tail; node1 = node1->next, node2 = node2->next)
+		{
+			if((node1->key != node2->key) || (node1->data != node2->data)) return 0;
+		}
+	}
+	return 1;
+}
+
+// 같은 옵션으로 JHashTableAddData 를 순서대로 호출한 테이블과 병렬 적재한 테이블을 비교한다.
+// 키는 count / 2 종류이고, 키마다 데이터 2 개를 저장하며 마지막 1000 개는 앞의 데이터를 다시 추가한다.
+static int RunBuildAndCompare(const JHashTableOptionPtr option, int size, int threadCount)
+{
+	int count = 40000;
+	int *keys = (int*)malloc(sizeof(int) * (size_t)count);
+	void **keyPtrs = (void**)malloc(sizeof(void*) * (size_t)count);
+	void **valuePtrs = (void**)malloc(sizeof(void*) * (size_t)count);
+	int index = 0;
+	int isSame = 0;
+
+	for(index = 0; index < count; index++)
+	{
+		keys[index] = index / 2;
+		keyPtrs[index] = &keys[index];
+		valuePtrs[index] = &keys[index];
+	}
+	for(index = count - 1000; index < count; index++)
+	{
+		keyPtrs[index] = &keys[index - 20000];
+		valuePtrs[index] = &keys[index - 20000];
+	}
+
+	JHashTablePtr expected = NewJHashTableWithOption(size, IntType, IntType, option);
+	JHashTablePtr table = NewJHashTableWithOption(size, IntType, IntType, option);
+	for(index = 0; index < count; index++) JHashTableAddData(expected, keyPtrs[index], valuePtrs[index]);
+	// 순서대로 추가한 테이블의 재해싱을 마치고 비교한다.
+	while(expected->rehashContainer != NULL) JHashTableFindData(expected, keyPtrs[0], valuePtrs[0]);
+
+	if((JHashTableBuildParallel(table, keyPtrs, valuePtrs, count, threadCount) == count - 1000)
+		&& (JHashTableGetCount(table) == count - 1000) && (table->rehashContainer == NULL))
+	{
+		isSame = (JHashTableGetSize(table) == JHashTableGetSize(expected)) ? IsSameBuckets(table, expected) : 0;
+		// 작업 스레드의 메모리 풀을 합친 후에도 사용 중인 노드 개수(Head/Tail 노드 포함)가 같아야 한다.
+		if((table->nodePool != NULL) && (table->nodePool->nodes.usedObjects != expected->nodePool->nodes.usedObjects)) isSame = 0;
+		for(index = 0; index < count; index++)
+		{
+			if(JHashTableFindData(table, keyPtrs[index], valuePtrs[index]) != FindSuccess) isSame = 0;
+		}
+	}
+
+	// 적재한 데이터를 삭제하고 다시 추가해도 메모리 풀이 올바르게 재사용된다.
+	for(index = 0; index < count; index += 2) JHashTableDeleteData(table, keyPtrs[index], valuePtrs[index]);
+	for(index = 0; index < count; index += 2) JHashTableAddData(table, keyPtrs[index], valuePtrs[index]);
+	if(JHashTableGetCount(table) != count - 1000) isSame = 0;
+
+	DeleteJHashTable(&expected);
+	DeleteJHashTable(&table);
+	free(valuePtrs);
+	free(keyPtrs);
+	free(keys);
+	return isSame;
+}
+
+TEST(HashTable_BUILD, MatchSequentialAdd, {
+	JHashTableOption option;
+	JHashTableInitOption(&option);
+
+	// 처음 크기에서 미리 확장한 후 적재한다.
+	EXPECT_NUM_EQUAL(RunBuildAndCompare(&option, 16, 4), 1, int);
+	EXPECT_NUM_EQUAL(RunBuildAndCompare(&option, 100, 3), 1, int);
+
+	option.useNodePool = 0;
+	option.powerOfTwoBuckets = 1;
+	EXPECT_NUM_EQUAL(RunBuildAndCompare(&option, 16, 4), 1, int);
+
+	// 자동 확장하지 않는 테이블은 현재 크기로 적재한다.
+	JHashTableInitOption(&option);
+	option.loadFactor = 0;
+	EXPECT_NUM_EQUAL(RunBuildAndCompare(&option, 1000, 4), 1, int);
+})
+
+TEST(HashTable_BUILD, InvalidPairsAndSerialFallback, {
+	int count = 20000;
+	int *keys = (int*)malloc(sizeof(int) * (size_t)count);
+	void **keyPtrs = (void**)malloc(sizeof(void*) * (size_t)count);
+	int index = 0;
+	int isFound = 1;
+	for(index = 0; index < count; index++)
+	{
+		keys[index] = index;
+		keyPtrs[index] = &keys[index];
+	}
+
+	JHashTablePtr table = NewJHashTable(16, IntType, IntType);
+	EXPECT_NUM_EQUAL(JHashTableBuildParallel(NULL, keyPtrs, keyPtrs, count, 4), HASH_FAIL, int);
+	EXPECT_NUM_EQUAL(JHashTableBuildParallel(table, keyPtrs, keyPtrs, count, 0), HASH_FAIL, int);
+	EXPECT_NUM_EQUAL(JHashTableBuildParallel(table, keyPtrs, keyPtrs, 0, 4), 0, int);
+
+	// NULL 인 키가 있으면 아무것도 추가하지 않는다.
+	keyPtrs[count - 1] = NULL;
+	EXPECT_NUM_EQUAL(JHashTableBuildParallel(table, keyPtrs, keyPtrs, count, 4), HASH_FAIL, int);
+	EXPECT_NUM_EQUAL(JHashTableBuildParallel(table, keyPtrs, keyPtrs, count, 1), HASH_FAIL, int);
+	EXPECT_NUM_EQUAL(JHashTableGetCount(table), 0, int);
+	keyPtrs[count - 1] = &keys[count - 1];
+
+	// 데이터가 적으면 호출한 스레드에서 순서대로 추가한다.
+	EXPECT_NUM_EQUAL(JHashTableBuildParallel(table, keyPtrs, keyPtrs, 100, 4), 100, int);
+	EXPECT_NUM_EQUAL(JHashTableBuildParallel(table, keyPtrs, keyPtrs, count, 4), count - 100, int);
+	EXPECT_NUM_EQUAL(JHashTableGetCount(table), count, int);
+	DeleteJHashTable(&table);
+
+	// Open Addressing 저장소는 순서대로 추가한다.
+	JHashTableOption option;
+	JHashTableInitOption(&option);
+	option.storageType = OpenAddressStorage;
+	table = NewJHashTableWithOption(16, IntType, IntType, &option);
+	EXPECT_NUM_EQUAL(JHashTableBuildParallel(table, keyPtrs, keyPtrs, count, 4), count, int);
+	for(index = 0; index < count; index++)
+	{
+		if(JHashTableGet(table, &keys[index]) != &keys[index]) isFound = 0;
+	}
+	EXPECT_NUM_EQUAL(isFound, 1, int);
+	DeleteJHashTable(&table);
+
+	free(keyPtrs);
+	free(keys);
+})
+
+TEST(HashTable_BUILD, ConcurrentTable, {
+	int tableSize = 0;
+	JHashTableOption option;
+	JHashTableInitOption(&option);
+	option.lockType = RwLock;
+	option.lockStripeCount = 8;
+
+	// 잠금 단위로 구역을 나누고 잠금별 메모리 풀과 데이터 개수를 사용한다.
+	EXPECT_NUM_EQUAL(RunBuildAndCompare(&option, 4096, 4), 1, int);
+	option.lockType = SpinLock;
+	option.useNodePool = 0;
+	EXPECT_NUM_EQUAL(RunBuildAndCompare(&option, 64, 4), 1, int);
+
+	// 자동 확장하는 테이블은 미리 확장한 후 적재하고, 적재 후에는 여러 스레드에서 사용할 수 있다.
+	option.lockType = RwLock;
+	option.useNodePool = 1;
+	option.cooperativeResize = 1;
+	EXPECT_NUM_EQUAL(RunBuildAndCompare(&option, 16, 4), 1, int);
+	EXPECT_NUM_EQUAL(RunConcurrentAddFindDeleteWithOption(16, &option, &tableSize), 4000, int);
+})
+
+// ---------- FOREACH Test ----------
+
+// ctx 는 키별 순회 횟수 배열
+static int CountVisit(void *key, void *value, void *ctx)
+{
+	(void)value;
+	__atomic_fetch_add(&(((int*)ctx)[*((int*)key)]), 1, __ATOMIC_RELAXED);
+	return 0;
+}
+
+// 10 번째 데이터에서 순회를 멈춘다.
+static int StopAfterTen(void *key, void *value, void *ctx)
+{
+	(void)key;
+	(void)value;
+	return (__atomic_add_fetch((int*)ctx, 1, __ATOMIC_RELAXED) >= 10) ? 1 : 0;
+}
+
+// ctx 는 스레드별 데이터 합계 배열
+static int SumByWorker(void *key, void *value, void *ctx)
+{
+	(void)key;
+	((long*)ctx)[JWorkPoolGetWorkerIndex()] += *((int*)value);
+	return 0;
+}
+
+// 앞의 count 개 키를 정확히 한 번씩 순회했으면 1 반환(순회 횟수는 0 으로 초기화)
+static int IsVisitedOnce(int *visitCounts, int count)
+{
+	int isOnce = 1;
+	int index = 0;
+	for( ; index < count; index++)
+	{
+		if(visitCounts[index] != 1) isOnce = 0;
+		visitCounts[index] = 0;
+	}
+	return isOnce;
+}
+
+// 재해싱이 진행 중인 상태가 될 때까지 데이터를 추가하고 추가한 개수를 반환한다.
+static int AddUntilRehashing(JHashTablePtr table, int *keys, int count)
+{
+	int index = 0;
+	for( ; index < count; index++)
+	{
+		JHashTableAddData(table, &keys[index], &keys[index]);
+		if((table->rehashContainer != NULL) && (table->rehashIndex > 0) && (table->rehashIndex < table->size / 2)) return index + 1;
+	}
+	return count;
+}
+
+TEST(HashTable_FOREACH, VisitAllStorages, {
+	int count = 5000;
+	int *keys = (int*)malloc(sizeof(int) * (size_t)count);
+	int *visitCounts = (int*)calloc((size_t)count, sizeof(int));
+	int index = 0;
+	int addedCount = 0;
+	int stopCount = 0;
+	for(index = 0; index < count; index++) keys[index] = index;
+
+	JHashTableOption option;
+	JHashTableInitOption(&option);
+	EXPECT_NUM_EQUAL(JHashTableForEach(NULL, CountVisit, visitCounts), HASH_FAIL, int);
+
+	// 재해싱 중에는 옮겨진 Slot 대신 새로운 Slot 들을 순회한다.
+	JHashTablePtr table = NewJHashTableWithOption(16, IntType, IntType, &option);
+	EXPECT_NUM_EQUAL(JHashTableForEach(table, NULL, NULL), HASH_FAIL, int);
+	addedCount = AddUntilRehashing(table, keys, count);
+	EXPECT_NOT_NULL(table->rehashContainer);
+	EXPECT_NUM_EQUAL(JHashTableForEach(table, CountVisit, visitCounts), addedCount, int);
+	EXPECT_NUM_EQUAL(IsVisitedOnce(visitCounts, addedCount), 1, int);
+	EXPECT_NUM_EQUAL(JHashTableForEach(table, StopAfterTen, &stopCount), 10, int);
+	DeleteJHashTable(&table);
+
+	option.powerOfTwoBuckets = 1;
+	table = NewJHashTableWithOption(16, IntType, IntType, &option);
+	addedCount = AddUntilRehashing(table, keys, count);
+	EXPECT_NOT_NULL(table->rehashContainer);
+	EXPECT_NUM_EQUAL(JHashTableForEach(table, CountVisit, visitCounts), addedCount, int);
+	EXPECT_NUM_EQUAL(IsVisitedOnce(visitCounts, addedCount), 1, int);
+	DeleteJHashTable(&table);
+
+	// 동시 접근 모드의 자동 확장 중에는 전달 표시된 Slot 대신 새로운 Slot 들을 순회한다.
+	option.lockType = SpinLock;
+	option.lockStripeCount = 4;
+	option.cooperativeResize = 1;
+	table = NewJHashTableWithOption(16, IntType, IntType, &option);
+	for(index = 0; index < count; index++)
+	{
+		JHashTableAddData(table, &keys[index], &keys[index]);
+		if((table->rehashContainer != NULL) && (table->rehashDoneCount > 0) && (table->rehashDoneCount < table->size / 2)) break;
+	}
+	addedCount = (index < count) ? index + 1 : count;
+	EXPECT_NOT_NULL(table->rehashContainer);
+	EXPECT_NUM_EQUAL(JHashTableForEach(table, CountVisit, visitCounts), addedCount, int);
+	EXPECT_NUM_EQUAL(IsVisitedOnce(visitCounts, addedCount), 1, int);
+	DeleteJHashTable(&table);
+
+	JHashTableInitOption(&option);
+	option.storageType = OpenAddressStorage;
+	table = NewJHashTableWithOption(16, IntType, IntType, &option);
+	for(index = 0; index < count; index++) JHashTableAddData(table, &keys[index], &keys[index]);
+	EXPECT_NUM_EQUAL(JHashTableForEach(table, CountVisit, visitCounts), count, int);
+	EXPECT_NUM_EQUAL(IsVisitedOnce(visitCounts, count), 1, int);
+	DeleteJHashTable(&table);
+
+	JHashTableInitOption(&option);
+	option.lockType = LockFree;
+	table = NewJHashTableWithOption(1024, IntType, IntType, &option);
+	for(index = 0; index < count; index++) JHashTableAddData(table, &keys[index], &keys[index]);
+	for(index = 0; index < count; index += 2) JHashTableRemoveKey(table, &keys[index]);
+	for(index = 0; index < count; index += 2) JHashTableAddData(table, &keys[index], &keys[index]);
+	EXPECT_NUM_EQUAL(JHashTableForEach(table, CountVisit, visitCounts), count, int);
+	EXPECT_NUM_EQUAL(IsVisitedOnce(visitCounts, count), 1, int);
+	DeleteJHashTable(&table);
+
+	free(visitCounts);
+	free(keys);
+})
+
+// 순회 함수 안에서 검색하는 순회 함수의 ctx
+typedef struct _nested_visit_ctx_t {
+	JHashTablePtr table;
+	// 검색에 성공한 횟수
+	int foundCount;
+	// 검색이 끝난 후 바깥 순회의 epoch 게시가 지워진 횟수
+	int lostEpochCount;
+} NestedVisitCtx;
+
+// 순회 중인 데이터를 다시 검색하고, 검색이 끝난 후에도 순회 중인 스레드의 epoch 가 게시되어 있는지 확인한다.
+static int GetInsideVisit(void *key, void *value, void *ctx)
+{
+	NestedVisitCtx *visitCtx = (NestedVisitCtx*)ctx;
+	if(JHashTableGet(visitCtx->table, key) == value) visitCtx->foundCount++;
+	if((visitCtx->table->epochRecords != NULL) && (__atomic_load_n(&(visitCtx->table->epochRecords->localEpoch), __ATOMIC_SEQ_CST) == 0)) visitCtx->lostEpochCount++;
+	return 0;
+}
+
+// 모든 버킷 잠금이 풀려 있으면 1 반환
+static int IsAllStripesUnlocked(const JHashTablePtr table)
+{
+	int isUnlocked = 1;
+	int index = 0;
+	for( ; index < table->lockStripeCount; index++)
+	{
+		if(table->lockType == RwLock)
+		{
+			if(pthread_rwlock_trywrlock(&(table->lockStripes[index].rwlock)) != 0) isUnlocked = 0;
+			else pthread_rwlock_unlock(&(table->lockStripes[index].rwlock));
+		}
+		else if(table->lockStripes[index].spinLock != 0)
+		{
+			isUnlocked = 0;
+		}
+	}
+	return isUnlocked;
+}
+
+TEST(HashTable_FOREACH, ReadInsideVisitor, {
+	int count = 2000;
+	int keys[2000];
+	int index = 0;
+	int round = 0;
+	NestedVisitCtx visitCtx;
+	JHashTableOption option;
+	for(index = 0; index < count; index++) keys[index] = index;
+
+	// 잠금 없는 검색과 LockFree 버킷은 검색 구간이 중첩되어도 바깥 순회가 끝날 때까지 epoch 를 유지하고,
+	// 순회 함수 안의 검색이 잡지 않은 버킷 잠금을 풀지 않는다(Open Addressing 은 검색이 테이블을 변경하지 않는다).
+	for( ; round < 4; round++)
+	{
+		JHashTableInitOption(&option);
+		option.lockType = (round == 0) ? RwLock : ((round == 1) ? SpinLock : ((round == 2) ? LockFree : NoLock));
+		option.lockFreeRead = (round < 2) ? 1 : 0;
+		if(round == 3) option.storageType = OpenAddressStorage;
+		JHashTablePtr table = NewJHashTableWithOption(256, IntType, IntType, &option);
+		for(index = 0; index < count; index++) JHashTableAddData(table, &keys[index], &keys[index]);
+
+		memset(&visitCtx, 0, sizeof(NestedVisitCtx));
+		visitCtx.table = table;
+		EXPECT_NUM_EQUAL(JHashTableForEach(table, GetInsideVisit, &visitCtx), count, int);
+		EXPECT_NUM_EQUAL(visitCtx.foundCount, count, int);
+		EXPECT_NUM_EQUAL(visitCtx.lostEpochCount, 0, int);
+		if(round < 3)
+		{
+			EXPECT_NOT_NULL(table->epochRecords);
+			EXPECT_NUM_EQUAL((table->epochRecords->localEpoch == 0), 1, int);
+			EXPECT_NUM_EQUAL(table->epochRecords->depth, 0, int);
+		}
+		if(table->lockStripes != NULL)
+		{
+			EXPECT_NUM_EQUAL(IsAllStripesUnlocked(table), 1, int);
+		}
+
+		// 순회 후에도 쓰기 잠금을 정상적으로 잡는다.
+		for(index = 0; index < count; index += 2) JHashTableRemoveKey(table, &keys[index]);
+		EXPECT_NUM_EQUAL(JHashTableGetCount(table), count / 2, int);
+		DeleteJHashTable(&table);
+	}
+})
+
+TEST(HashTable_FOREACH, ParallelWithWorkPool, {
+	int count = 20000;
+	int *keys = (int*)malloc(sizeof(int) * (size_t)count);
+	int *visitCounts = (int*)calloc((size_t)count, sizeof(int));
+	long sums[4] = { 0 };
+	long sum = 0;
+	int index = 0;
+	int stopCount = 0;
+	int visitedCount = 0;
+	for(index = 0; index < count; index++) keys[index] = index;
+
+	EXPECT_NULL(NewJWorkPool(0));
+	EXPECT_NULL(NewJWorkPool(JHT_MAX_WORK_THREADS + 1));
+	EXPECT_NUM_EQUAL(JWorkPoolGetWorkerIndex(), HASH_FAIL, int);
+	JWorkPoolPtr pool = NewJWorkPool(4);
+	EXPECT_NOT_NULL(pool);
+	EXPECT_NUM_EQUAL(JWorkPoolGetThreadCount(pool), 4, int);
+
+	// 한 버킷에 데이터 절반이 모여도 다른 스레드들이 남은 버킷 묶음을 가져가 모두 한 번씩 순회한다.
+	JHashTablePtr table = NewJHashTable(count, IntType, IntType);
+	EXPECT_NUM_EQUAL(JHashTableForEachParallel(table, NULL, CountVisit, visitCounts), HASH_FAIL, int);
+	JHashTableSetIntHashFunc(table, ConstantHash);
+	for(index = 0; index < count / 2; index++) JHashTableAddUnchecked(table, &keys[index], &keys[index]);
+	table->intHashFunc = JHashIntModulo;
+	for( ; index < count; index++) JHashTableAddData(table, &keys[index], &keys[index]);
+	EXPECT_NUM_EQUAL(JLinkedListGetSize(table->listContainer[0]), count / 2, int);
+	EXPECT_NUM_EQUAL(JHashTableGetCount(table), count, int);
+	EXPECT_NUM_EQUAL(JHashTableForEachParallel(table, pool, CountVisit, visitCounts), count, int);
+	EXPECT_NUM_EQUAL(IsVisitedOnce(visitCounts, count), 1, int);
+
+	// 같은 작업 풀을 다시 사용하고, 스레드별 공간에 합계를 나누어 계산한다.
+	EXPECT_NUM_EQUAL(JHashTableForEachParallel(table, pool, SumByWorker, sums), count, int);
+	for(index = 0; index < 4; index++) sum += sums[index];
+	EXPECT_NUM_EQUAL(sum, (long)count * (count - 1) / 2, long);
+	visitedCount = JHashTableForEachParallel(table, pool, StopAfterTen, &stopCount);
+	EXPECT_NUM_EQUAL(((visitedCount >= 10) && (visitedCount < count)), 1, int);
+	DeleteJHashTable(&table);
+
+	JHashTableOption option;
+	JHashTableInitOption(&option);
+	option.lockType = RwLock;
+	option.lockFreeRead = 1;
+	table = NewJHashTableWithOption(1024, IntType, IntType, &option);
+	for(index = 0; index < count; index++) JHashTableAddData(table, &keys[index], &keys[index]);
+	EXPECT_NUM_EQUAL(JHashTableForEachParallel(table, pool, CountVisit, visitCounts), count, int);
+	EXPECT_NUM_EQUAL(IsVisitedOnce(visitCounts, count), 1, int);
+	EXPECT_NUM_EQUAL(CountEpochRecords(table) <= 4, 1, int);
+	DeleteJHashTable(&table);
+
+	EXPECT_NUM_EQUAL(DeleteJWorkPool(&pool), DeleteSuccess, int);
+	EXPECT_NULL(pool);
+	EXPECT_NUM_EQUAL(DeleteJWorkPool(&pool), DeleteFail, int);
+	free(visitCounts);
+	free(keys);
+})
+
+// ---------- INSERT BUFFER Test ----------
+
+// 스레드마다 자신의 쓰기 버퍼로 키 범위를 추가한다.
+// 추가된 개수를 결과로 남기되, 비우면서 잡은 잠금 횟수가 추가 개수보다 적지 않으면 0 을 남긴다.
+static void* BufferedAdd(void *data)
+{
+	ConcurrentArg *arg = (ConcurrentArg*)data;
+	JInsertBufferPtr buffer = NewJInsertBuffer(arg->table, 64, 0);
+	JInsertBufferStats stats;
+	int index = arg->begin;
+
+	if(buffer == NULL) return NULL;
+	for( ; index < arg->end; index++) JInsertBufferAdd(buffer, &(arg->keys[index]), &(arg->keys[index]));
+	JInsertBufferFlush(buffer);
+	JInsertBufferGetStats(buffer, &stats);
+	if(stats.lockCount < stats.insertedCount) arg->result = (int)stats.insertedCount;
+	DeleteJInsertBuffer(&buffer);
+	return NULL;
+}
+
+// 쓰기 버퍼(비우기 크기 16)로 키 100 개를 추가한 후 테이블의 데이터 개수를 반환한다.
+static int RunBufferedAdd(const JHashTableOptionPtr option)
+{
+	int keys[100];
+	int index = 0;
+	int count = 0;
+	JHashTablePtr table = NewJHashTableWithOption(8, IntType, IntType, option);
+	if(table == NULL) return HASH_FAIL;
+
+	JInsertBufferPtr buffer = NewJInsertBuffer(table, 16, 0);
+	for( ; index < 100; index++)
+	{
+		keys[index] = index;
+		JInsertBufferAdd(buffer, &keys[index], &keys[index]);
+	}
+	DeleteJInsertBuffer(&buffer);
+
+	for(index = 0; index < 100; index++)
+	{
+		if(JHashTableGet(table, &keys[index]) == &keys[index]) count++;
+	}
+	if(count != JHashTableGetCount(table)) count = HASH_FAIL;
+	DeleteJHashTable(&table);
+	return count;
+}
+
+TEST(HashTable_INSERTBUFFER, AddAndFlushBySize, {
+	int keys[10] = { 0 };
+	int index = 0;
+	JInsertBufferStats stats;
+	JHashTableOption option;
+	JHashTablePtr table = NewJHashTable(16, IntType, IntType);
+	EXPECT_NOT_NULL(table);
+
+	EXPECT_NULL(NewJInsertBuffer(NULL, 8, 0));
+	EXPECT_NULL(JInsertBufferAdd(NULL, &keys[0], &keys[0]));
+	EXPECT_NUM_EQUAL(JInsertBufferFlush(NULL), HASH_FAIL, int);
+	EXPECT_NUM_EQUAL(JInsertBufferGetPendingCount(NULL), HASH_FAIL, int);
+	EXPECT_NUM_EQUAL(DeleteJInsertBuffer(NULL), DeleteFail, int);
+
+	JInsertBufferPtr buffer = NewJInsertBuffer(table, 0, 0);
+	EXPECT_NOT_NULL(buffer);
+	EXPECT_NUM_EQUAL(buffer->flushSize, JHT_DEFAULT_FLUSH_SIZE, int);
+	EXPECT_NUM_EQUAL(DeleteJInsertBuffer(&buffer), DeleteSuccess, int);
+	EXPECT_NULL(buffer);
+
+	buffer = NewJInsertBuffer(table, 8, 0);
+	EXPECT_NOT_NULL(buffer);
+	for(index = 0; index < 10; index++) keys[index] = index;
+
+	// 비우기 크기가 될 때까지 모아 둔 데이터는 검색되지 않는다.
+	for(index = 0; index < 7; index++) EXPECT_PTR_EQUAL(JInsertBufferAdd(buffer, &keys[index], &keys[index]), buffer);
+	EXPECT_NUM_EQUAL(JInsertBufferGetPendingCount(buffer), 7, int);
+	EXPECT_NUM_EQUAL(JHashTableGetCount(table), 0, int);
+	EXPECT_NULL(JHashTableGet(table, &keys[0]));
+
+	EXPECT_PTR_EQUAL(JInsertBufferAdd(buffer, &keys[7], &keys[7]), buffer);
+	EXPECT_NUM_EQUAL(JInsertBufferGetPendingCount(buffer), 0, int);
+	EXPECT_NUM_EQUAL(JHashTableGetCount(table), 8, int);
+	EXPECT_PTR_EQUAL(JHashTableGet(table, &keys[7]), &keys[7]);
+
+	// 이미 저장되어 있는 데이터는 추가하지 않는다.
+	EXPECT_NULL(JInsertBufferAdd(buffer, NULL, &keys[0]));
+	EXPECT_PTR_EQUAL(JInsertBufferAdd(buffer, &keys[0], &keys[0]), buffer);
+	EXPECT_PTR_EQUAL(JInsertBufferAdd(buffer, &keys[8], &keys[8]), buffer);
+	EXPECT_NUM_EQUAL(JInsertBufferFlush(buffer), 1, int);
+	EXPECT_NUM_EQUAL(JInsertBufferFlush(buffer), 0, int);
+	EXPECT_NUM_EQUAL(JHashTableGetCount(table), 9, int);
+
+	EXPECT_NULL(JInsertBufferGetStats(buffer, NULL));
+	EXPECT_PTR_EQUAL(JInsertBufferGetStats(buffer, &stats), &stats);
+	EXPECT_NUM_EQUAL((int)stats.bufferedCount, 10, int);
+	EXPECT_NUM_EQUAL((int)stats.insertedCount, 9, int);
+	EXPECT_NUM_EQUAL((int)stats.flushCount, 2, int);
+	EXPECT_NUM_EQUAL((int)stats.delayFlushCount, 0, int);
+	EXPECT_NUM_EQUAL((int)stats.lockCount, 0, int);
+	EXPECT_NUM_EQUAL((stats.totalFlushNs >= stats.maxFlushNs), 1, int);
+
+	// 삭제 시 모아 둔 데이터를 추가한다.
+	EXPECT_PTR_EQUAL(JInsertBufferAdd(buffer, &keys[9], &keys[9]), buffer);
+	EXPECT_NUM_EQUAL(DeleteJInsertBuffer(&buffer), DeleteSuccess, int);
+	EXPECT_NUM_EQUAL(JHashTableGetCount(table), 10, int);
+	DeleteJHashTable(&table);
+
+	// 잠금 그룹으로 나누지 않는 저장소도 모아 둔 순서대로 추가한다.
+	JHashTableInitOption(&option);
+	option.storageType = OpenAddressStorage;
+	EXPECT_NUM_EQUAL(RunBufferedAdd(&option), 100, int);
+	JHashTableInitOption(&option);
+	option.lockType = LockFree;
+	EXPECT_NUM_EQUAL(RunBufferedAdd(&option), 100, int);
+	JHashTableInitOption(&option);
+	option.lockType = SpinLock;
+	option.lockStripeCount = 4;
+	EXPECT_NUM_EQUAL(RunBufferedAdd(&option), 100, int);
+})
+
+TEST(HashTable_INSERTBUFFER, GroupByLockStripe, {
+	int count = 400;
+	int keys[400] = { 0 };
+	int index = 0;
+	int groupIndex = 0;
+	int groupUsed = 0;
+	int isGrouped = 1;
+	int chainSize = 0;
+	int entryIndex = 0;
+	int isFound = 1;
+	JInsertBufferStats stats;
+	JHashTableOption option;
+	JHashTableInitOption(&option);
+	option.lockType = RwLock;
+	option.lockStripeCount = 4;
+
+	JHashTablePtr table = NewJHashTableWithOption(64, IntType, IntType, &option);
+	EXPECT_NOT_NULL(table);
+	JInsertBufferPtr buffer = NewJInsertBuffer(table, 1000, 0);
+	EXPECT_NOT_NULL(buffer);
+	EXPECT_NUM_EQUAL(buffer->groupCount, 4, int);
+
+	for(index = 0; index < count; index++)
+	{
+		keys[index] = index;
+		JInsertBufferAdd(buffer, &keys[index], &keys[index]);
+	}
+	EXPECT_NUM_EQUAL(JInsertBufferGetPendingCount(buffer), count, int);
+	EXPECT_NUM_EQUAL(JHashTableGetCount(table), 0, int);
+
+	// 모아 둔 데이터는 잠금 그룹별로 연결되어 있다.
+	for(groupIndex = 0; groupIndex < buffer->groupCount; groupIndex++)
+	{
+		if(buffer->groupHeads[groupIndex] < 0) continue;
+		groupUsed++;
+		chainSize = 0;
+		for(entryIndex = buffer->groupHeads[groupIndex]; entryIndex >= 0; entryIndex = buffer->entries[entryIndex].next)
+		{
+			if(((buffer->entries[entryIndex].lockIndex >> table->lockStripeShift) & (table->lockStripeCount - 1)) != groupIndex) isGrouped = 0;
+			chainSize++;
+		}
+		if(chainSize != buffer->groupSizes[groupIndex]) isGrouped = 0;
+	}
+	EXPECT_NUM_EQUAL(isGrouped, 1, int);
+
+	// 잠금 그룹마다 잠금을 한 번만 잡는다.
+	EXPECT_NUM_EQUAL(JInsertBufferFlush(buffer), count, int);
+	JInsertBufferGetStats(buffer, &stats);
+	EXPECT_NUM_EQUAL((int)stats.lockCount, groupUsed, int);
+	EXPECT_NUM_EQUAL((int)stats.insertedCount, count, int);
+	EXPECT_NUM_EQUAL(JHashTableGetCount(table), count, int);
+	for(index = 0; index < count; index++)
+	{
+		if(JHashTableGet(table, &keys[index]) != &keys[index]) isFound = 0;
+	}
+	EXPECT_NUM_EQUAL(isFound, 1, int);
+	for(groupIndex = 0; groupIndex < buffer->groupCount; groupIndex++)
+	{
+		if((buffer->groupHeads[groupIndex] != -1) || (buffer->groupSizes[groupIndex] != 0)) isGrouped = 0;
+	}
+	EXPECT_NUM_EQUAL(isGrouped, 1, int);
+
+	DeleteJInsertBuffer(&buffer);
+	DeleteJHashTable(&table);
+})
+
+TEST(HashTable_INSERTBUFFER, FlushByDelay, {
+	int keys[4] = { 0 };
+	int index = 0;
+	JInsertBufferStats stats;
+	JHashTablePtr table = NewJHashTable(16, IntType, IntType);
+	EXPECT_NOT_NULL(table);
+	for(index = 0; index < 4; index++) keys[index] = index;
+
+	// 처음 모아 둔 데이터가 100 us 보다 오래 기다렸으면 다음 추가 시 비운다.
+	JInsertBufferPtr buffer = NewJInsertBuffer(table, 1000, 100000);
+	EXPECT_NOT_NULL(buffer);
+	JInsertBufferAdd(buffer, &keys[0], &keys[0]);
+	EXPECT_NUM_EQUAL(JInsertBufferGetPendingCount(buffer), 1, int);
+	usleep(1000);
+	JInsertBufferAdd(buffer, &keys[1], &keys[1]);
+	EXPECT_NUM_EQUAL(JInsertBufferGetPendingCount(buffer), 0, int);
+	EXPECT_NUM_EQUAL(JHashTableGetCount(table), 2, int);
+
+	JInsertBufferGetStats(buffer, &stats);
+	EXPECT_NUM_EQUAL((int)stats.flushCount, 1, int);
+	EXPECT_NUM_EQUAL((int)stats.delayFlushCount, 1, int);
+	EXPECT_NUM_EQUAL((stats.maxDelayNs >= 100000), 1, int);
+	DeleteJInsertBuffer(&buffer);
+
+	// 대기 시간이 길면 비우기 크기가 될 때까지 모아 둔다.
+	buffer = NewJInsertBuffer(table, 1000, 60000000000ULL);
+	EXPECT_NOT_NULL(buffer);
+	JInsertBufferAdd(buffer, &keys[2], &keys[2]);
+	usleep(1000);
+	JInsertBufferAdd(buffer, &keys[3], &keys[3]);
+	EXPECT_NUM_EQUAL(JInsertBufferGetPendingCount(buffer), 2, int);
+	EXPECT_NUM_EQUAL(JHashTableGetCount(table), 2, int);
+	DeleteJInsertBuffer(&buffer);
+	EXPECT_NUM_EQUAL(JHashTableGetCount(table), 4, int);
+
+	DeleteJHashTable(&table);
+})
+
+TEST(HashTable_INSERTBUFFER, ParallelBuffers, {
+	int threadCount = 4;
+	int countPerThread = 2000;
+	int count = threadCount * countPerThread;
+	int *keys = (int*)malloc(sizeof(int) * (size_t)count);
+	int index = 0;
+	int addTotal = 0;
+	int isFound = 1;
+	pthread_t threads[4];
+	ConcurrentArg args[4];
+	JHashTableOption option;
+	JHashTableInitOption(&option);
+	option.lockType = RwLock;
+	option.lockStripeCount = 8;
+	option.cooperativeResize = 1;
+
+	// 버킷 16 개에서 시작해 여러 번 확장하는 동안 스레드마다 버퍼로 추가한다.
+	JHashTablePtr table = NewJHashTableWithOption(16, IntType, IntType, &option);
+	EXPECT_NOT_NULL(table);
+	for(index = 0; index < count; index++) keys[index] = index;
+
+	for(index = 0; index < threadCount; index++)
+	{
+		memset(&args[index], 0, sizeof(ConcurrentArg));
+		args[index].table = table;
+		args[index].keys = keys;
+		args[index].begin = index * countPerThread;
+		args[index].end = (index + 1) * countPerThread;
+		pthread_create(&threads[index], NULL, BufferedAdd, &args[index]);
+	}
+	for(index = 0; index < threadCount; index++)
+	{
+		pthread_join(threads[index], NULL);
+		addTotal += args[index].result;
+	}
+
+	EXPECT_NUM_EQUAL(addTotal, count, int);
+	EXPECT_NUM_EQUAL(JHashTableGetCount(table), count, int);
+	for(index = 0; index < count; index++)
+	{
+		if(JHashTableGet(table, &keys[index]) != &keys[index]) isFound = 0;
+	}
+	EXPECT_NUM_EQUAL(isFound, 1, int);
+	// 마지막 재해싱은 검색이 도와서 마치므로 검색 후에 크기를 확인한다.
+	EXPECT_NUM_EQUAL((JHashTableGetSize(table) >= 4096), 1, int);
+
+	DeleteJHashTable(&table);
+	free(keys);
+})
+
+// ---------- FIND BATCH Test ----------
+
+// 키 300 개를 추가한 후 추가한 키 300 개와 없는 키 50 개를 일괄 검색한다.
+// 키별 결과가 JHashTableFindData 와 모두 같으면 찾은 개수, 하나라도 다르면 HASH_FAIL 을 반환한다.
+static int RunFindBatch(const JHashTableOptionPtr option, int distance)
+{
+	int keys[350];
+	void *keyPtrs[350];
+	FindResult results[350];
+	int index = 0;
+	int foundCount = 0;
+	JHashTablePtr table = NewJHashTableWithOption(8, IntType, IntType, option);
+	if(table == NULL) return HASH_FAIL;
+	if(JHashTableSetPrefetchDistance(table, distance) == NULL)
+	{
+		DeleteJHashTable(&table);
+		return HASH_FAIL;
+	}
+
+	for( ; index < 350; index++)
+	{
+		keys[index] = index * 7;
+		keyPtrs[index] = &keys[index];
+		if(index < 300) JHashTableAddData(table, &keys[index], &keys[index]);
+	}
+
+	foundCount = JHashTableFindBatch(table, keyPtrs, keyPtrs, results, 350);
+	for(index = 0; index < 350; index++)
+	{
+		if(results[index] != JHashTableFindData(table, &keys[index], &keys[index])) foundCount = HASH_FAIL;
+	}
+
+	DeleteJHashTable(&table);
+	return foundCount;
+}
+
+TEST(HashTable_FINDBATCH, FindKeysAndValues, {
+	int keys[4] = { 0 };
+	int otherValue = 99;
+	void *keyPtrs[4];
+	void *valuePtrs[4];
+	FindResult results[4];
+	int index = 0;
+	JHashTablePtr table = NewJHashTable(16, IntType, IntType);
+	EXPECT_NOT_NULL(table);
+
+	for( ; index < 4; index++)
+	{
+		keys[index] = index;
+		keyPtrs[index] = &keys[index];
+		valuePtrs[index] = &keys[index];
+	}
+	JHashTableAddData(table, &keys[0], &keys[0]);
+	JHashTableAddData(table, &keys[1], &keys[1]);
+	JHashTableAddData(table, &keys[2], &keys[2]);
+
+	EXPECT_NUM_EQUAL(JHashTableFindBatch(NULL, keyPtrs, valuePtrs, results, 4), HASH_FAIL, int);
+	EXPECT_NUM_EQUAL(JHashTableFindBatch(table, NULL, valuePtrs, results, 4), HASH_FAIL, int);
+	EXPECT_NUM_EQUAL(JHashTableFindBatch(table, keyPtrs, valuePtrs, NULL, 4), HASH_FAIL, int);
+	EXPECT_NUM_EQUAL(JHashTableFindBatch(table, keyPtrs, valuePtrs, results, -1), HASH_FAIL, int);
+	EXPECT_NUM_EQUAL(JHashTableFindBatch(table, keyPtrs, valuePtrs, results, 0), 0, int);
+
+	// 키와 데이터를 함께 비교한다.
+	valuePtrs[1] = &otherValue;
+	EXPECT_NUM_EQUAL(JHashTableFindBatch(table, keyPtrs, valuePtrs, results, 4), 2, int);
+	EXPECT_NUM_EQUAL(results[0], FindSuccess, int);
+	EXPECT_NUM_EQUAL(results[1], FindFail, int);
+	EXPECT_NUM_EQUAL(results[2], FindSuccess, int);
+	EXPECT_NUM_EQUAL(results[3], FindFail, int);
+
+	// 데이터 배열이 NULL 이면 키만 비교하고, NULL 인 키는 찾지 못한다.
+	keyPtrs[2] = NULL;
+	EXPECT_NUM_EQUAL(JHashTableFindBatch(table, keyPtrs, NULL, results, 4), 2, int);
+	EXPECT_NUM_EQUAL(results[1], FindSuccess, int);
+	EXPECT_NUM_EQUAL(results[2], FindFail, int);
+
+	DeleteJHashTable(&table);
+})
+
+TEST(HashTable_FINDBATCH, PrefetchDistance, {
+	JHashTableOption option;
+	JHashTablePtr table = NewJHashTable(16, IntType, IntType);
+	EXPECT_NOT_NULL(table);
+
+	EXPECT_NUM_EQUAL(JHashTableGetPrefetchDistance(table), JHT_DEFAULT_PREFETCH_DISTANCE, int);
+	EXPECT_NULL(JHashTableSetPrefetchDistance(table, -1));
+	EXPECT_NULL(JHashTableSetPrefetchDistance(table, JHT_MAX_PREFETCH_DISTANCE + 1));
+	EXPECT_NULL(JHashTableSetPrefetchDistance(NULL, 1));
+	EXPECT_NOT_NULL(JHashTableSetPrefetchDistance(table, JHT_MAX_PREFETCH_DISTANCE));
+	EXPECT_NUM_EQUAL(JHashTableGetPrefetchDistance(table), JHT_MAX_PREFETCH_DISTANCE, int);
+	EXPECT_NUM_EQUAL(JHashTableGetPrefetchDistance(NULL), HASH_FAIL, int);
+	DeleteJHashTable(&table);
+
+	JHashTableInitOption(&option);
+	option.prefetchDistance = JHT_MAX_PREFETCH_DISTANCE + 1;
+	EXPECT_NULL(NewJHashTableWithOption(16, IntType, IntType, &option));
+	option.prefetchDistance = 0;
+	table = NewJHashTableWithOption(16, IntType, IntType, &option);
+	EXPECT_NOT_NULL(table);
+	EXPECT_NUM_EQUAL(JHashTableGetPrefetchDistance(table), 0, int);
+	DeleteJHashTable(&table);
+})
+
+TEST(HashTable_FINDBATCH, ChainWhileRehashing, {
+	JHashTableOption option;
+	JHashTableInitOption(&option);
+
+	// 작은 테이블에 추가하므로 일괄 검색 중에도 재해싱이 진행된다.
+	EXPECT_NUM_EQUAL(RunFindBatch(&option, 0), 300, int);
+	EXPECT_NUM_EQUAL(RunFindBatch(&option, 1), 300, int);
+	EXPECT_NUM_EQUAL(RunFindBatch(&option, JHT_DEFAULT_PREFETCH_DISTANCE), 300, int);
+	EXPECT_NUM_EQUAL(RunFindBatch(&option, JHT_MAX_PREFETCH_DISTANCE), 300, int);
+})
+
+TEST(HashTable_FINDBATCH, OtherStorages, {
+	JHashTableOption option;
+
+	JHashTableInitOption(&option);
+	option.storageType = OpenAddressStorage;
+	EXPECT_NUM_EQUAL(RunFindBatch(&option, 0), 300, int);
+	EXPECT_NUM_EQUAL(RunFindBatch(&option, JHT_MAX_PREFETCH_DISTANCE), 300, int);
+
+	JHashTableInitOption(&option);
+	option.lockType = RwLock;
+	EXPECT_NUM_EQUAL(RunFindBatch(&option, JHT_DEFAULT_PREFETCH_DISTANCE), 300, int);
+	option.lockType = SpinLock;
+	option.lockFreeRead = 1;
+	EXPECT_NUM_EQUAL(RunFindBatch(&option, JHT_DEFAULT_PREFETCH_DISTANCE), 300, int);
+
+	JHashTableInitOption(&option);
+	option.lockType = RwLock;
+	option.cooperativeResize = 1;
+	EXPECT_NUM_EQUAL(RunFindBatch(&option, JHT_DEFAULT_PREFETCH_DISTANCE), 300, int);
+
+	JHashTableInitOption(&option);
+	option.lockType = LockFree;
+	EXPECT_NUM_EQUAL(RunFindBatch(&option, JHT_DEFAULT_PREFETCH_DISTANCE), 300, int);
+})
+
+// ---------- ADD BATCH Test ----------
+
+// 키 0 ~ 699 를 두 번씩(1000 개) 일괄 추가한 후, 데이터별 결과가 처음이면 1, 다시 나오면 0 인지 확인한다.
+// 결과가 모두 맞고 모든 키를 찾으면 테이블의 데이터 개수, 하나라도 다르면 HASH_FAIL 을 반환한다.
+static int RunAddBatch(const JHashTableOptionPtr option)
+{
+	int values[700];
+	void *keyPtrs[1000];
+	void *valuePtrs[1000];
+	int results[1000];
+	int index = 0;
+	int count = 0;
+	JHashTablePtr table = NewJHashTableWithOption(8, IntType, IntType, option);
+	if(table == NULL) return HASH_FAIL;
+
+	for( ; index < 1000; index++)
+	{
+		if(index < 700) values[index] = index;
+		keyPtrs[index] = &values[index % 700];
+		valuePtrs[index] = &values[index % 700];
+	}
+
+	count = JHashTableAddBatch(table, keyPtrs, valuePtrs, 1000, results);
+	for(index = 0; index < 1000; index++)
+	{
+		if(results[index] != ((index < 700) ? 1 : 0)) count = HASH_FAIL;
+		if(JHashTableGet(table, keyPtrs[index]) != valuePtrs[index]) count = HASH_FAIL;
+	}
+	if(count != JHashTableGetCount(table)) count = HASH_FAIL;
+
+	DeleteJHashTable(&table);
+	return count;
+}
+
+// 재해싱이 진행 중인 테이블에 작은 묶음을 일괄 추가하면, 재해싱을 한 번에 끝내지 않고 데이터마다 돕는 만큼만 돕는다.
+// 결과가 모두 맞고 모든 키를 찾으면 묶음으로 추가된 데이터 개수, 하나라도 다르면 HASH_FAIL 을 반환한다.
+static int RunSmallBatchDuringRehash(const JHashTableOptionPtr option)
+{
+	int keys[2000];
+	void *keyPtrs[8];
+	int results[8];
+	int index = 0;
+	int count = 0;
+	JHashTablePtr table = NewJHashTableWithOption(1024, IntType, IntType, option);
+	if(table == NULL) return HASH_FAIL;
+
+	for( ; index < 2000; index++) keys[index] = index;
+	int addedCount = AddUntilRehashing(table, keys, 1990);
+	int oldSize = table->size;
+	if(table->rehashContainer == NULL) count = HASH_FAIL;
+
+	// 이미 저장된 키 하나와 NULL 키 하나를 섞는다(keys[addedCount] 는 추가하지 않는다).
+	for(index = 0; index < 8; index++) keyPtrs[index] = &keys[addedCount + index];
+	keyPtrs[0] = &keys[0];
+	keyPtrs[7] = NULL;
+	if(JHashTableAddBatch(table, keyPtrs, keyPtrs, 8, results) != 6) count = HASH_FAIL;
+	if((table->rehashContainer == NULL) || (table->size != oldSize)) count = HASH_FAIL;
+	if((results[0] != 0) || (results[7] != HASH_FAIL)) count = HASH_FAIL;
+
+	for(index = 0; index < addedCount + 7; index++)
+	{
+		if(JHashTableGet(table, &keys[index]) != ((index == addedCount) ? NULL : &keys[index])) count = HASH_FAIL;
+	}
+	if(JHashTableGetCount(table) != addedCount + 6) count = HASH_FAIL;
+	if(count == 0) count = 6;
+
+	DeleteJHashTable(&table);
+	return count;
+}
+
+// 스레드마다 자신의 키 범위를 100 개씩 일괄 추가하고 추가된 개수를 결과로 남긴다.
+static void* BatchAdd(void *data)
+{
+	ConcurrentArg *arg = (ConcurrentArg*)data;
+	void *keyPtrs[100];
+	int index = arg->begin;
+	int batchCount = 0;
+
+	while(index < arg->end)
+	{
+		for(batchCount = 0; (batchCount < 100) && (index < arg->end); batchCount++, index++) keyPtrs[batchCount] = &(arg->keys[index]);
+		arg->result += JHashTableAddBatch(arg->table, keyPtrs, keyPtrs, batchCount, NULL);
+	}
+	return NULL;
+}
+
+TEST(HashTable_ADDBATCH, AddAndReport, {
+	int keys[4] = { 0 };
+	void *keyPtrs[6];
+	void *valuePtrs[6];
+	int results[6] = { 0 };
+	int index = 0;
+	JHashTablePtr table = NewJHashTable(16, IntType, IntType);
+	EXPECT_NOT_NULL(table);
+
+	for( ; index < 4; index++)
+	{
+		keys[index] = index;
+		keyPtrs[index] = &keys[index];
+		valuePtrs[index] = &keys[index];
+	}
+	// 같은 키와 데이터가 묶음 안에서 다시 나오면 추가하지 않고, NULL 인 키 또는 데이터는 실패한다.
+	keyPtrs[4] = &keys[1];
+	valuePtrs[4] = &keys[1];
+	keyPtrs[5] = NULL;
+	valuePtrs[5] = &keys[2];
+	valuePtrs[3] = NULL;
+	JHashTableAddData(table, &keys[0], &keys[0]);
+
+	EXPECT_NUM_EQUAL(JHashTableAddBatch(NULL, keyPtrs, valuePtrs, 6, results), HASH_FAIL, int);
+	EXPECT_NUM_EQUAL(JHashTableAddBatch(table, NULL, valuePtrs, 6, results), HASH_FAIL, int);
+	EXPECT_NUM_EQUAL(JHashTableAddBatch(table, keyPtrs, NULL, 6, results), HASH_FAIL, int);
+	EXPECT_NUM_EQUAL(JHashTableAddBatch(table, keyPtrs, valuePtrs, -1, results), HASH_FAIL, int);
+	EXPECT_NUM_EQUAL(JHashTableAddBatch(table, keyPtrs, valuePtrs, 0, results), 0, int);
+
+	EXPECT_NUM_EQUAL(JHashTableAddBatch(table, keyPtrs, valuePtrs, 6, results), 2, int);
+	EXPECT_NUM_EQUAL(results[0], 0, int);
+	EXPECT_NUM_EQUAL(results[1], 1, int);
+	EXPECT_NUM_EQUAL(results[2], 1, int);
+	EXPECT_NUM_EQUAL(results[3], HASH_FAIL, int);
+	EXPECT_NUM_EQUAL(results[4], 0, int);
+	EXPECT_NUM_EQUAL(results[5], HASH_FAIL, int);
+	EXPECT_NUM_EQUAL(JHashTableGetCount(table), 3, int);
+
+	// 결과 배열 없이도 추가한다.
+	valuePtrs[3] = &keys[3];
+	EXPECT_NUM_EQUAL(JHashTableAddBatch(table, keyPtrs, valuePtrs, 5, NULL), 1, int);
+	EXPECT_PTR_EQUAL(JHashTableGet(table, &keys[3]), &keys[3]);
+	EXPECT_NUM_EQUAL(JHashTableGetCount(table), 4, int);
+
+	DeleteJHashTable(&table);
+})
+
+TEST(HashTable_ADDBATCH, MatchesAddData, {
+	JHashTableOption option;
+
+	// 작은 테이블에 추가하므로 추가 전에 미리 확장한다.
+	JHashTableInitOption(&option);
+	EXPECT_NUM_EQUAL(RunAddBatch(&option), 700, int);
+	option.useNodePool = 0;
+	EXPECT_NUM_EQUAL(RunAddBatch(&option), 700, int);
+	option.useNodePool = 1;
+	option.powerOfTwoBuckets = 1;
+	EXPECT_NUM_EQUAL(RunAddBatch(&option), 700, int);
+
+	JHashTableInitOption(&option);
+	option.storageType = OpenAddressStorage;
+	EXPECT_NUM_EQUAL(RunAddBatch(&option), 700, int);
+
+	JHashTableInitOption(&option);
+	option.lockType = LockFree;
+	EXPECT_NUM_EQUAL(RunAddBatch(&option), 700, int);
+})
+
+TEST(HashTable_ADDBATCH, SmallBatchDuringRehash, {
+	JHashTableOption option;
+
+	JHashTableInitOption(&option);
+	EXPECT_NUM_EQUAL(RunSmallBatchDuringRehash(&option), 6, int);
+	option.useNodePool = 0;
+	EXPECT_NUM_EQUAL(RunSmallBatchDuringRehash(&option), 6, int);
+	option.powerOfTwoBuckets = 1;
+	EXPECT_NUM_EQUAL(RunSmallBatchDuringRehash(&option), 6, int);
+})
+
+TEST(HashTable_ADDBATCH, GroupByLockStripe, {
+	JHashTableOption option;
+
+	JHashTableInitOption(&option);
+	option.lockType = RwLock;
+	option.lockStripeCount = 4;
+	EXPECT_NUM_EQUAL(RunAddBatch(&option), 700, int);
+	option.lockType = SpinLock;
+	option.lockFreeRead = 1;
+	EXPECT_NUM_EQUAL(RunAddBatch(&option), 700, int);
+
+	JHashTableInitOption(&option);
+	option.lockType = RwLock;
+	option.lockStripeCount = 4;
+	option.cooperativeResize = 1;
+	EXPECT_NUM_EQUAL(RunAddBatch(&option), 700, int);
+})
+
+TEST(HashTable_ADDBATCH, ParallelBatches, {
+	int threadCount = 4;
+	int countPerThread = 2000;
+	int count = threadCount * countPerThread;
+	int *keys = (int*)malloc(sizeof(int) * (size_t)count);
+	int index = 0;
+	int addTotal = 0;
+	int isFound = 1;
+	pthread_t threads[4];
+	ConcurrentArg args[4];
+	JHashTableOption option;
+	JHashTableInitOption(&option);
+	option.lockType = RwLock;
+	option.lockStripeCount = 8;
+	option.cooperativeResize = 1;
+
+	// 버킷 16 개에서 시작해 여러 번 확장하는 동안 스레드마다 일괄 추가한다.
+	JHashTablePtr table = NewJHashTableWithOption(16, IntType, IntType, &option);
+	EXPECT_NOT_NULL(table);
+	for(index = 0; index < count; index++) keys[index] = index;
+
+	for(index = 0; index < threadCount; index++)
+	{
+		memset(&args[index], 0, sizeof(ConcurrentArg));
+		args[index].table = table;
+		args[index].keys = keys;
+		args[index].begin = index * countPerThread;
+		args[index].end = (index + 1) * countPerThread;
+		pthread_create(&threads[index], NULL, BatchAdd, &args[index]);
+	}
+	for(index = 0; index < threadCount; index++)
+	{
+		pthread_join(threads[index], NULL);
+		addTotal += args[index].result;
+	}
+
+	EXPECT_NUM_EQUAL(addTotal, count, int);
+	EXPECT_NUM_EQUAL(JHashTableGetCount(table), count, int);
+	for(index = 0; index < count; index++)
+	{
+		if(JHashTableGet(table, &keys[index]) != &keys[index]) isFound = 0;
+	}
+	EXPECT_NUM_EQUAL(isFound, 1, int);
+	// 마지막 재해싱은 검색이 도와서 마치므로 검색 후에 크기를 확인한다.
+	EXPECT_NUM_EQUAL((JHashTableGetSize(table) >= 4096), 1, int);
+
+	DeleteJHashTable(&table);
+	free(keys);
+})
+
+// ---------- UPSERT Test ----------
+
+// 키 300 개를 JHashTableGetOrInsert 로 추가하고 다시 호출한 후, JHashTableUpsert 로 모두 교체한다.
+// 결과가 모두 맞으면 테이블의 데이터 개수, 하나라도 다르면 HASH_FAIL 을 반환한다.
+static int RunUpsert(const JHashTableOptionPtr option)
+{
+	int keys[300];
+	int newValues[300];
+	int index = 0;
+	int count = 0;
+	void *oldValue = NULL;
+	InsertResult result = InsertFail;
+	JHashTablePtr table = NewJHashTableWithOption(8, IntType, IntType, option);
+	if(table == NULL) return HASH_FAIL;
+
+	for( ; index < 300; index++)
+	{
+		keys[index] = index;
+		newValues[index] = index;
+		if(JHashTableGetOrInsert(table, &keys[index], &keys[index], &result) != &keys[index]) count = HASH_FAIL;
+		if(result != InsertAdded) count = HASH_FAIL;
+	}
+	for(index = 0; index < 300; index++)
+	{
+		if(JHashTableGetOrInsert(table, &keys[index], &newValues[index], &result) != &keys[index]) count = HASH_FAIL;
+		if(result != InsertExisting) count = HASH_FAIL;
+		if(JHashTableUpsert(table, &keys[index], &newValues[index], &oldValue) != InsertExisting) count = HASH_FAIL;
+		if(oldValue != &keys[index]) count = HASH_FAIL;
+		if(JHashTableGet(table, &keys[index]) != &newValues[index]) count = HASH_FAIL;
+	}
+	if(count == 0) count = JHashTableGetCount(table);
+
+	DeleteJHashTable(&table);
+	return count;
+}
+
+// 모든 스레드가 같은 키들을 JHashTableGetOrInsert 로 추가하고, 직접 추가한 개수를 결과로 남긴 후 교체와 검색을 반복한다.
+static void* ConcurrentGetOrInsert(void *data)
+{
+	ConcurrentArg *arg = (ConcurrentArg*)data;
+	InsertResult result = InsertFail;
+	int index = arg->begin;
+
+	for( ; index < arg->end; index++)
+	{
+		if((JHashTableGetOrInsert(arg->table, &(arg->keys[index]), &(arg->keys[index]), &result) != NULL) && (result == InsertAdded)) arg->result++;
+	}
+	// 다른 스레드가 검색하는 동안 데이터를 교체한다(개수는 바뀌지 않음).
+	for(index = arg->begin; index < arg->end; index++)
+	{
+		JHashTableUpsert(arg->table, &(arg->keys[index]), &(arg->keys[index]), NULL);
+		JHashTableGet(arg->table, &(arg->keys[(index * 7) % arg->end]));
+	}
+	return NULL;
+}
+
+// 스레드 4 개가 같은 키 500 개를 동시에 추가했을 때 키마다 한 번만 추가되었는지 확인한다.
+static int RunConcurrentGetOrInsert(const JHashTableOptionPtr option)
+{
+	int keys[500];
+	int index = 0;
+	int addTotal = 0;
+	pthread_t threads[4];
+	ConcurrentArg args[4];
+	JHashTablePtr table = NewJHashTableWithOption(16, IntType, IntType, option);
+	if(table == NULL) return HASH_FAIL;
+
+	for( ; index < 500; index++) keys[index] = index;
+	for(index = 0; index < 4; index++)
+	{
+		memset(&args[index], 0, sizeof(ConcurrentArg));
+		args[index].table = table;
+		args[index].keys = keys;
+		args[index].begin = 0;
+		args[index].end = 500;
+		pthread_create(&threads[index], NULL, ConcurrentGetOrInsert, &args[index]);
+	}
+	for(index = 0; index < 4; index++)
+	{
+		pthread_join(threads[index], NULL);
+		addTotal += args[index].result;
+	}
+	if(addTotal != JHashTableGetCount(table)) addTotal = HASH_FAIL;
+
+	DeleteJHashTable(&table);
+	return addTotal;
+}
+
+TEST(HashTable_UPSERT, GetOrInsert, {
+	int key = 1;
+	int value = 10;
+	int otherValue = 20;
+	InsertResult result = InsertAdded;
+	JHashTablePtr table = NewJHashTable(16, IntType, IntType);
+	EXPECT_NOT_NULL(table);
+
+	EXPECT_NULL(JHashTableGetOrInsert(NULL, &key, &value, &result));
+	EXPECT_NUM_EQUAL(result, InsertFail, int);
+	EXPECT_NULL(JHashTableGetOrInsert(table, NULL, &value, &result));
+	EXPECT_NULL(JHashTableGetOrInsert(table, &key, NULL, NULL));
+
+	EXPECT_PTR_EQUAL(JHashTableGetOrInsert(table, &key, &value, &result), &value);
+	EXPECT_NUM_EQUAL(result, InsertAdded, int);
+	EXPECT_PTR_EQUAL(JHashTableGetOrInsert(table, &key, &otherValue, &result), &value);
+	EXPECT_NUM_EQUAL(result, InsertExisting, int);
+	EXPECT_PTR_EQUAL(JHashTableGetOrInsert(table, &key, &otherValue, NULL), &value);
+	EXPECT_NUM_EQUAL(JHashTableGetCount(table), 1, int);
+
+	DeleteJHashTable(&table);
+})
+
+TEST(HashTable_UPSERT, Upsert, {
+	int key = 1;
+	int value = 10;
+	int otherValue = 20;
+	void *oldValue = &key;
+	JHashTablePtr table = NewJHashTable(16, IntType, IntType);
+	EXPECT_NOT_NULL(table);
+
+	EXPECT_NUM_EQUAL(JHashTableUpsert(NULL, &key, &value, &oldValue), InsertFail, int);
+	EXPECT_NULL(oldValue);
+	EXPECT_NUM_EQUAL(JHashTableUpsert(table, &key, NULL, NULL), InsertFail, int);
+
+	oldValue = &key;
+	EXPECT_NUM_EQUAL(JHashTableUpsert(table, &key, &value, &oldValue), InsertAdded, int);
+	EXPECT_NULL(oldValue);
+	EXPECT_NUM_EQUAL(JHashTableUpsert(table, &key, &otherValue, &oldValue), InsertExisting, int);
+	EXPECT_PTR_EQUAL(oldValue, &value);
+	EXPECT_PTR_EQUAL(JHashTableGet(table, &key), &otherValue);
+	EXPECT_NUM_EQUAL(JHashTableFindData(table, &key, &value), FindFail, int);
+	EXPECT_NUM_EQUAL(JHashTableGetCount(table), 1, int);
+
+	DeleteJHashTable(&table);
+})
+
+TEST(HashTable_UPSERT, AllStorages, {
+	JHashTableOption option;
+
+	// 작은 테이블에 추가하므로 재해싱 중에도 검색과 추가가 이어진다.
+	JHashTableInitOption(&option);
+	EXPECT_NUM_EQUAL(RunUpsert(&option), 300, int);
+	option.storageType = OpenAddressStorage;
+	EXPECT_NUM_EQUAL(RunUpsert(&option), 300, int);
+
+	JHashTableInitOption(&option);
+	option.lockType = RwLock;
+	EXPECT_NUM_EQUAL(RunUpsert(&option), 300, int);
+	option.cooperativeResize = 1;
+	EXPECT_NUM_EQUAL(RunUpsert(&option), 300, int);
+
+	JHashTableInitOption(&option);
+	option.lockType = LockFree;
+	EXPECT_NUM_EQUAL(RunUpsert(&option), 300, int);
+})
+
+TEST(HashTable_UPSERT, ConcurrentGetOrInsert, {
+	JHashTableOption option;
+
+	JHashTableInitOption(&option);
+	option.lockType = RwLock;
+	option.lockStripeCount = 8;
+	option.cooperativeResize = 1;
+	EXPECT_NUM_EQUAL(RunConcurrentGetOrInsert(&option), 500, int);
+
+	JHashTableInitOption(&option);
+	option.lockType = SpinLock;
+	option.lockFreeRead = 1;
+	EXPECT_NUM_EQUAL(RunConcurrentGetOrInsert(&option), 500, int);
+
+	JHashTableInitOption(&option);
+	option.lockType = LockFree;
+	EXPECT_NUM_EQUAL(RunConcurrentGetOrInsert(&option), 500, int);
+})
+
+// ---------- ITER Test ----------
+
+// 키 300 개를 추가한 후 순회 커서로 모든 데이터를 한 번씩 순회하면서 짝수 키를 삭제하고, 다시 순회해서 홀수 키만 남았는지 확인한다.
+// 결과가 모두 맞으면 남은 데이터 개수, 하나라도 다르면 HASH_FAIL 을 반환한다.
+static int RunIterScan(const JHashTableOptionPtr option)
+{
+	int keys[300];
+	int seen[300];
+	int index = 0;
+	int count = 0;
+	void *key = NULL;
+	void *data = NULL;
+	JHashTableIter iter;
+	JHashTablePtr table = NewJHashTableWithOption(8, IntType, IntType, option);
+	if(table == NULL) return HASH_FAIL;
+
+	for( ; index < 300; index++)
+	{
+		keys[index] = index;
+		seen[index] = 0;
+		JHashTableAddData(table, &keys[index], &keys[index]);
+	}
+
+	for(index = JHashTableIterBegin(table, &iter); index == 1; index = JHashTableIterNext(&iter))
+	{
+		data = JHashTableIterGet(&iter, &key);
+		if((data == NULL) || (data != key))
+		{
+			count = HASH_FAIL;
+			continue;
+		}
+		seen[*((int*)key)]++;
+		if((*((int*)key) % 2 == 0) && (JHashTableIterDelete(&iter) != DeleteSuccess)) count = HASH_FAIL;
+	}
+	for(index = 0; index < 300; index++)
+	{
+		if(seen[index] != 1) count = HASH_FAIL;
+		seen[index] = 0;
+	}
+
+	for(index = JHashTableIterBegin(table, &iter); index == 1; index = JHashTableIterNext(&iter))
+	{
+		seen[*((int*)JHashTableIterGet(&iter, NULL))]++;
+	}
+	for(index = 0; index < 300; index++)
+	{
+		if(seen[index] != index % 2) count = HASH_FAIL;
+	}
+	if(count == 0) count = JHashTableGetCount(table);
+
+	DeleteJHashTable(&table);
+	return count;
+}
+
+TEST(HashTable_ITER, EmptyAndBadArgs, {
+	int key = 1;
+	JHashTableIter iter;
+	JHashTablePtr table = NewJHashTable(16, IntType, IntType);
+	EXPECT_NOT_NULL(table);
+
+	EXPECT_NUM_EQUAL(JHashTableIterBegin(NULL, &iter), HASH_FAIL, int);
+	EXPECT_NUM_EQUAL(JHashTableIterBegin(table, NULL), HASH_FAIL, int);
+	EXPECT_NUM_EQUAL(JHashTableIterNext(NULL), 0, int);
+	EXPECT_NULL(JHashTableIterGet(NULL, NULL));
+	EXPECT_NUM_EQUAL(JHashTableIterDelete(NULL), DeleteFail, int);
+
+	// 빈 테이블은 바로 끝난 상태가 된다.
+	EXPECT_NUM_EQUAL(JHashTableIterBegin(table, &iter), 0, int);
+	EXPECT_NULL(JHashTableIterGet(&iter, NULL));
+	EXPECT_NUM_EQUAL(JHashTableIterNext(&iter), 0, int);
+	EXPECT_NUM_EQUAL(JHashTableIterDelete(&iter), DeleteFail, int);
+
+	// 삭제한 데이터는 다시 삭제하거나 읽을 수 없다.
+	JHashTableAddData(table, &key, &key);
+	EXPECT_NUM_EQUAL(JHashTableIterBegin(table, &iter), 1, int);
+	EXPECT_PTR_EQUAL(JHashTableIterGet(&iter, NULL), &key);
+	EXPECT_NUM_EQUAL(JHashTableIterDelete(&iter), DeleteSuccess, int);
+	EXPECT_NUM_EQUAL(JHashTableIterDelete(&iter), DeleteFail, int);
+	EXPECT_NULL(JHashTableIterGet(&iter, NULL));
+	EXPECT_NUM_EQUAL(JHashTableIterNext(&iter), 0, int);
+	EXPECT_NUM_EQUAL(JHashTableGetCount(table), 0, int);
+
+	DeleteJHashTable(&table);
+})
+
+TEST(HashTable_ITER, ScanDuringRehash, {
+	int count = 0;
+	int index = 0;
+	int keys[33];
+	JHashTableIter iter;
+	JHashTablePtr table = NewJHashTable(32, IntType, IntType);
+
+	// 33 번째 데이터 추가 시 재해싱이 시작되므로 기존 Slot 과 새로운 Slot 에 데이터가 나누어져 있다.
+	for( ; index < 33; index++)
+	{
+		keys[index] = index;
+		JHashTableAddData(table, &keys[index], &keys[index]);
+	}
+	EXPECT_NOT_NULL(table->rehashContainer);
+
+	for(index = JHashTableIterBegin(table, &iter); index == 1; index = JHashTableIterNext(&iter)) count++;
+	EXPECT_NUM_EQUAL(count, 33, int);
+
+	// 모두 삭제한 후에는 재해싱 중이어도 순회할 데이터가 없다.
+	for(index = JHashTableIterBegin(table, &iter); index == 1; index = JHashTableIterNext(&iter)) JHashTableIterDelete(&iter);
+	EXPECT_NUM_EQUAL(JHashTableGetCount(table), 0, int);
+	EXPECT_NUM_EQUAL(JHashTableIterBegin(table, &iter), 0, int);
+
+	DeleteJHashTable(&table);
+})
+
+TEST(HashTable_ITER, AllStorages, {
+	JHashTableOption option;
+
+	// 작은 테이블에 추가하므로 재해싱 중에 순회하고 삭제한다.
+	JHashTableInitOption(&option);
+	EXPECT_NUM_EQUAL(RunIterScan(&option), 150, int);
+	option.useNodePool = 0;
+	EXPECT_NUM_EQUAL(RunIterScan(&option), 150, int);
+
+	JHashTableInitOption(&option);
+	option.storageType = OpenAddressStorage;
+	EXPECT_NUM_EQUAL(RunIterScan(&option), 150, int);
+
+	JHashTableInitOption(&option);
+	option.lockType = RwLock;
+	option.lockStripeCount = 4;
+	option.cooperativeResize = 1;
+	EXPECT_NUM_EQUAL(RunIterScan(&option), 150, int);
+
+	JHashTableInitOption(&option);
+	option.lockType = SpinLock;
+	option.lockFreeRead = 1;
+	EXPECT_NUM_EQUAL(RunIterScan(&option), 150, int);
+
+	JHashTableInitOption(&option);
+	option.lockType = LockFree;
+	EXPECT_NUM_EQUAL(RunIterScan(&option), 150, int);
+})
+
+// ---------- HANDLE Test ----------
+
+// 키 300 개를 추가하고 짝수 키의 핸들을 찾아 둔 후, 키 300 개를 더 추가해서 재해싱(재배치)으로 데이터를 옮기고 핸들로 삭제한다.
+// 키 1~99 중 홀수 키는 핸들을 찾은 후 바로 삭제하므로, 이 핸들로 삭제하면 실패해야 한다.
+// 결과가 모두 맞으면 남은 데이터 개수, 하나라도 다르면 HASH_FAIL 을 반환한다.
+static int RunEraseHandle(const JHashTableOptionPtr option)
+{
+	int keys[600];
+	JHashTableEntry entries[150];
+	JHashTableEntry staleEntries[50];
+	int index = 0;
+	int count = 0;
+	JHashTablePtr table = NewJHashTableWithOption(8, IntType, IntType, option);
+	if(table == NULL) return HASH_FAIL;
+
+	for( ; index < 300; index++)
+	{
+		keys[index] = index;
+		JHashTableAddData(table, &keys[index], &keys[index]);
+	}
+	for(index = 0; index < 150; index++)
+	{
+		if(JHashTableFindEntry(table, &keys[index * 2], NULL, &entries[index]) != &keys[index * 2]) count = HASH_FAIL;
+	}
+	// 핸들을 찾은 후 다른 함수로 삭제한 데이터의 노드는 아래에서 추가하는 데이터로 재사용될 수 있다.
+	for(index = 0; index < 50; index++)
+	{
+		if(JHashTableFindEntry(table, &keys[index * 2 + 1], NULL, &staleEntries[index]) != &keys[index * 2 + 1]) count = HASH_FAIL;
+		if(JHashTableDeleteData(table, &keys[index * 2 + 1], &keys[index * 2 + 1]) != DeleteSuccess) count = HASH_FAIL;
+	}
+	for(index = 300; index < 600; index++)
+	{
+		keys[index] = index;
+		JHashTableAddData(table, &keys[index], &keys[index]);
+	}
+
+	for(index = 0; index < 150; index++)
+	{
+		if(JHashTableEraseHandle(table, &entries[index]) != DeleteSuccess) count = HASH_FAIL;
+		if(JHashTableEraseHandle(table, &entries[index]) != DeleteFail) count = HASH_FAIL;
+	}
+	for(index = 0; index < 50; index++)
+	{
+		if(JHashTableEraseHandle(table, &staleEntries[index]) != DeleteFail) count = HASH_FAIL;
+	}
+	for(index = 0; index < 600; index++)
+	{
+		if((JHashTableGet(table, &keys[index]) == NULL) != (((index < 300) && (index % 2 == 0)) || (index < 100))) count = HASH_FAIL;
+	}
+	if(count == 0) count = JHashTableGetCount(table);
+
+	DeleteJHashTable(&table);
+	return count;
+}
+
+TEST(HashTable_HANDLE, FindAndErase, {
+	int key = 1;
+	int otherKey = 2;
+	int value = 10;
+	int otherValue = 20;
+	JHashTableEntry entry;
+	JHashTablePtr table = NewJHashTable(16, IntType, IntType);
+	EXPECT_NOT_NULL(table);
+
+	EXPECT_NULL(JHashTableFindEntry(NULL, &key, NULL, &entry));
+	EXPECT_NULL(JHashTableFindEntry(table, NULL, NULL, &entry));
+	EXPECT_NULL(JHashTableFindEntry(table, &key, NULL, NULL));
+	EXPECT_NUM_EQUAL(JHashTableEraseHandle(NULL, &entry), DeleteFail, int);
+	EXPECT_NUM_EQUAL(JHashTableEraseHandle(table, NULL), DeleteFail, int);
+
+	// 찾지 못하면 빈 핸들이 되므로 삭제할 수 없다.
+	EXPECT_NULL(JHashTableFindEntry(table, &key, NULL, &entry));
+	EXPECT_NUM_EQUAL(JHashTableEraseHandle(table, &entry), DeleteFail, int);
+
+	JHashTableAddData(table, &key, &value);
+	JHashTableAddData(table, &key, &otherValue);
+	JHashTableAddData(table, &otherKey, &value);
+	EXPECT_PTR_EQUAL(JHashTableFindEntry(table, &key, &otherValue, &entry), &otherValue);
+	EXPECT_PTR_EQUAL(entry.key, &key);
+	EXPECT_NUM_EQUAL(JHashTableEraseHandle(table, &entry), DeleteSuccess, int);
+	EXPECT_NUM_EQUAL(JHashTableEraseHandle(table, &entry), DeleteFail, int);
+
+	EXPECT_NUM_EQUAL(JHashTableFindData(table, &key, &otherValue), FindFail, int);
+	EXPECT_NUM_EQUAL(JHashTableFindData(table, &key, &value), FindSuccess, int);
+	EXPECT_NUM_EQUAL(JHashTableFindData(table, &otherKey, &value), FindSuccess, int);
+	EXPECT_NUM_EQUAL(JHashTableGetCount(table), 2, int);
+
+	// 핸들을 찾은 후 다른 함수로 삭제한 데이터는 핸들로 삭제할 수 없다.
+	EXPECT_PTR_EQUAL(JHashTableFindEntry(table, &otherKey, NULL, &entry), &value);
+	EXPECT_NUM_EQUAL(JHashTableDeleteData(table, &otherKey, &value), DeleteSuccess, int);
+	EXPECT_NUM_EQUAL(JHashTableEraseHandle(table, &entry), DeleteFail, int);
+	EXPECT_NUM_EQUAL(JHashTableFindData(table, &key, &value), FindSuccess, int);
+	EXPECT_NUM_EQUAL(JHashTableGetCount(table), 1, int);
+
+	DeleteJHashTable(&table);
+})
+
+TEST(HashTable_HANDLE, EraseAfterRehash, {
+	JHashTableOption option;
+
+	// 핸들을 찾은 후 추가한 데이터로 재해싱(Open Addressing 은 재배치)되어도 핸들로 삭제한다.
+	JHashTableInitOption(&option);
+	EXPECT_NUM_EQUAL(RunEraseHandle(&option), 400, int);
+	option.useNodePool = 0;
+	EXPECT_NUM_EQUAL(RunEraseHandle(&option), 400, int);
+
+	JHashTableInitOption(&option);
+	option.storageType = OpenAddressStorage;
+	EXPECT_NUM_EQUAL(RunEraseHandle(&option), 400, int);
+
+	JHashTableInitOption(&option);
+	option.lockType = RwLock;
+	option.lockStripeCount = 4;
+	option.cooperativeResize = 1;
+	EXPECT_NUM_EQUAL(RunEraseHandle(&option), 400, int);
+
+	JHashTableInitOption(&option);
+	option.lockType = SpinLock;
+	option.lockFreeRead = 1;
+	EXPECT_NUM_EQUAL(RunEraseHandle(&option), 400, int);
+
+	JHashTableInitOption(&option);
+	option.lockType = LockFree;
+	EXPECT_NUM_EQUAL(RunEraseHandle(&option), 400, int);
+})
+
+// 키 100 개를 추가하고 핸들을 찾은 후, JHashTableUpsert 로 모든 데이터를 교체하고 핸들로 삭제한다.
+// 핸들은 데이터가 아닌 노드(슬롯)를 가리키므로 교체된 데이터도 삭제되어야 한다.
+// 결과가 모두 맞으면 남은 데이터 개수, 하나라도 다르면 HASH_FAIL 을 반환한다.
+static int RunEraseAfterUpsert(const JHashTableOptionPtr option)
+{
+	int keys[100];
+	int values[100];
+	JHashTableEntry entries[100];
+	int index = 0;
+	int count = 0;
+	JHashTablePtr table = NewJHashTableWithOption(256, IntType, IntType, option);
+	if(table == NULL) return HASH_FAIL;
+
+	for( ; index < 100; index++)
+	{
+		keys[index] = index;
+		values[index] = index + 1000;
+		JHashTableAddData(table, &keys[index], &keys[index]);
+	}
+	for(index = 0; index < 100; index++)
+	{
+		if(JHashTableFindEntry(table, &keys[index], NULL, &entries[index]) != &keys[index]) count = HASH_FAIL;
+		if(JHashTableUpsert(table, &keys[index], &values[index], NULL) != InsertExisting) count = HASH_FAIL;
+	}
+	for(index = 0; index < 100; index++)
+	{
+		if(JHashTableEraseHandle(table, &entries[index]) != DeleteSuccess) count = HASH_FAIL;
+		if(JHashTableGet(table, &keys[index]) != NULL) count = HASH_FAIL;
+	}
+	if(count == 0) count = JHashTableGetCount(table);
+
+	DeleteJHashTable(&table);
+	return count;
+}
+
+TEST(HashTable_HANDLE, EraseAfterUpsert, {
+	JHashTableOption option;
+
+	// 핸들을 찾은 후 데이터만 교체되었으면 핸들로 삭제한다.
+	JHashTableInitOption(&option);
+	EXPECT_NUM_EQUAL(RunEraseAfterUpsert(&option), 0, int);
+	option.useNodePool = 0;
+	EXPECT_NUM_EQUAL(RunEraseAfterUpsert(&option), 0, int);
+
+	JHashTableInitOption(&option);
+	option.storageType = OpenAddressStorage;
+	EXPECT_NUM_EQUAL(RunEraseAfterUpsert(&option), 0, int);
+
+	JHashTableInitOption(&option);
+	option.lockType = RwLock;
+	option.lockStripeCount = 4;
+	EXPECT_NUM_EQUAL(RunEraseAfterUpsert(&option), 0, int);
+
+	JHashTableInitOption(&option);
+	option.lockType = SpinLock;
+	option.lockFreeRead = 1;
+	EXPECT_NUM_EQUAL(RunEraseAfterUpsert(&option), 0, int);
+
+	JHashTableInitOption(&option);
+	option.lockType = LockFree;
+	EXPECT_NUM_EQUAL(RunEraseAfterUpsert(&option), 0, int);
+})
+
+// ---------- CLEAR Test ----------
+
+// 키 300 개를 추가하고 비운 후 다시 추가하는 것을 두 번 반복한다.
+// 결과가 모두 맞으면 마지막에 비운 데이터 개수, 하나라도 다르면 HASH_FAIL 을 반환한다.
+static int RunClear(const JHashTableOptionPtr option)
+{
+	int keys[300];
+	int index = 0;
+	int round = 0;
+	int count = 0;
+	JHashTableIter iter;
+	JHashTablePtr table = NewJHashTableWithOption(8, IntType, IntType, option);
+	if(table == NULL) return HASH_FAIL;
+
+	for( ; index < 300; index++) keys[index] = index;
+	for( ; round < 2; round++)
+	{
+		for(index = 0; index < 300; index++)
+		{
+			if(JHashTableAddData(table, &keys[index], &keys[index]) == NULL) count = HASH_FAIL;
+		}
+		for(index = 0; index < 300; index++)
+		{
+			if(JHashTableGet(table, &keys[index]) != &keys[index]) count = HASH_FAIL;
+		}
+		if(JHashTableClear(table) != 300) count = HASH_FAIL;
+
+		// 비운 후에는 어떤 방법으로도 데이터를 찾을 수 없다.
+		if(JHashTableGetCount(table) != 0) count = HASH_FAIL;
+		if(JHashTableGetFirstData(table) != NULL) count = HASH_FAIL;
+		if(JHashTableIterBegin(table, &iter) != 0) count = HASH_FAIL;
+		for(index = 0; index < 300; index++)
+		{
+			if(JHashTableGet(table, &keys[index]) != NULL) count = HASH_FAIL;
+		}
+	}
+	if(count == 0) count = 300;
+
+	DeleteJHashTable(&table);
+	return count;
+}
+
+TEST(HashTable_CLEAR, ClearEmptyAndBadArgs, {
+	int key = 1;
+	JHashTablePtr table = NewJHashTable(16, IntType, IntType);
+	EXPECT_NOT_NULL(table);
+
+	EXPECT_NUM_EQUAL(JHashTableClear(NULL), HASH_FAIL, int);
+	EXPECT_NUM_EQUAL(JHashTableClear(table), 0, int);
+
+	JHashTableAddData(table, &key, &key);
+	EXPECT_NUM_EQUAL(JHashTableClear(table), 1, int);
+	EXPECT_NUM_EQUAL(JHashTableClear(table), 0, int);
+	EXPECT_NULL(JHashTableGetFirstData(table));
+	EXPECT_NULL(JHashTableGetLastData(table));
+	EXPECT_NUM_EQUAL(JHashTableDeleteFirstData(table), DeleteFail, int);
+
+	DeleteJHashTable(&table);
+})
+
+TEST(HashTable_CLEAR, ReusePoolNodes, {
+	int count = 1000;
+	int *keys = (int*)malloc(sizeof(int) * (size_t)count);
+	int index = 0;
+	int slabCount = 0;
+	int usedObjects = 0;
+	JHashTablePtr table = NewJHashTable(count * 2, IntType, IntType);
+	EXPECT_NOT_NULL(table);
+
+	for( ; index < count; index++)
+	{
+		keys[index] = index;
+		JHashTableAddData(table, &keys[index], &keys[index]);
+	}
+	slabCount = table->nodePool->nodes.slabCount;
+	usedObjects = table->nodePool->nodes.usedObjects;
+
+	// 데이터 노드만 메모리 풀에 반환되고 Head/Tail 노드와 연결 리스트는 남는다.
+	EXPECT_NUM_EQUAL(JHashTableClear(table), count, int);
+	EXPECT_NUM_EQUAL(table->nodePool->nodes.usedObjects, usedObjects - count, int);
+
+	// 다시 추가할 때는 반환된 노드를 사용하므로 슬랩이 늘지 않는다.
+	for(index = 0; index < count; index++) JHashTableAddData(table, &keys[index], &keys[index]);
+	EXPECT_NUM_EQUAL(table->nodePool->nodes.slabCount, slabCount, int);
+	EXPECT_NUM_EQUAL(table->nodePool->nodes.usedObjects, usedObjects, int);
+	EXPECT_NUM_EQUAL(JHashTableGetCount(table), count, int);
+
+	DeleteJHashTable(&table);
+	free(keys);
+})
+
+TEST(HashTable_CLEAR, AllStorages, {
+	JHashTableOption option;
+
+	// 작은 테이블에 추가하므로 재해싱 중에 비운다.
+	JHashTableInitOption(&option);
+	EXPECT_NUM_EQUAL(RunClear(&option), 300, int);
+	option.useNodePool = 0;
+	EXPECT_NUM_EQUAL(RunClear(&option), 300, int);
+
+	JHashTableInitOption(&option);
+	option.storageType = OpenAddressStorage;
+	EXPECT_NUM_EQUAL(RunClear(&option), 300, int);
+
+	JHashTableInitOption(&option);
+	option.lockType = RwLock;
+	option.lockStripeCount = 4;
+	option.cooperativeResize = 1;
+	EXPECT_NUM_EQUAL(RunClear(&option), 300, int);
+
+	JHashTableInitOption(&option);
+	option.lockType = SpinLock;
+	option.lockFreeRead = 1;
+	EXPECT_NUM_EQUAL(RunClear(&option), 300, int);
+
+	JHashTableInitOption(&option);
+	option.lockType = LockFree;
+	EXPECT_NUM_EQUAL(RunClear(&option), 300, int);
+})
+
 ////////////////////////////////////////////////////////////////////////////////
 /// Main Function
 ////////////////////////////////////////////////////////////////////////////////
@@ -1963,9 +5760,12 @@ int main()
 		// @ INT Test -------------------------------------------
 		Test_Node_INT_SetData,
 		Test_Node_INT_GetData,
+		Test_Node_INT_SetKey,
+		Test_Node_INT_GetKey,
 		Test_LinkedList_INT_AddNode,
 		Test_LinkedList_INT_GetFirstNodeData,
 		Test_LinkedList_INT_GetLastNodeData,
+		Test_LinkedList_INT_PopFrontAndPopBack,
 		Test_LinkedList_INT_SetData,
 		Test_LinkedList_INT_GetData,
 		Test_LinkedList_INT_DeleteNodeData,
@@ -1977,6 +5777,8 @@ int main()
 		Test_HashTable_INT_DeleteFirstData,
 		Test_HashTable_INT_DeleteLastData,
 		Test_HashTable_INT_FindData,
+		Test_HashTable_INT_Get,
+		Test_HashTable_INT_RemoveKey,
 
 		// @ CHAR Test -------------------------------------------
 		Test_Node_CHAR_SetData,
@@ -1995,6 +5797,8 @@ int main()
 		Test_HashTable_CHAR_DeleteFirstData,
 		Test_HashTable_CHAR_DeleteLastData,
 		Test_HashTable_CHAR_FindData,
+		Test_HashTable_CHAR_Get,
+		Test_HashTable_CHAR_RemoveKey,
 
 		// @ STRING Test -------------------------------------------
 		Test_Node_STRING_SetData,
@@ -2013,6 +5817,8 @@ int main()
 		Test_HashTable_STRING_DeleteFirstData,
 		Test_HashTable_STRING_DeleteLastData,
 		Test_HashTable_STRING_FindData,
+		Test_HashTable_STRING_Get,
+		Test_HashTable_STRING_RemoveKey,
 		
 		// @ Integrated Test -------------------------------------------
 		// [Format: Test_HashTable_(Key)_(Value)_*]
@@ -2063,7 +5869,130 @@ int main()
 		Test_HashTable_STRING_CHAR_DeleteData,
 		Test_HashTable_STRING_CHAR_DeleteFirstData,
 		Test_HashTable_STRING_CHAR_DeleteLastData,
-		Test_HashTable_STRING_CHAR_FindData
+		Test_HashTable_STRING_CHAR_FindData,
+
+		// @ OPEN ADDRESSING Test -------------------------------
+		Test_HashTable_OPEN_CreateAndDeleteHashTable,
+		Test_HashTable_OPEN_AddAndFindData,
+		Test_HashTable_OPEN_DeleteData,
+		Test_HashTable_OPEN_DeleteFirstAndLastData,
+		Test_HashTable_OPEN_GetAndRemoveKey,
+		Test_HashTable_OPEN_Grow,
+		Test_HashTable_OPEN_AddUnchecked,
+
+		// @ REHASH Test -------------------------------
+		Test_HashTable_REHASH_GrowAndFindData,
+		Test_HashTable_REHASH_OperationsDuringRehash,
+		Test_HashTable_REHASH_DisableWithZeroLoadFactor,
+
+		// @ NODE POOL Test -------------------------------
+		Test_HashTable_POOL_ReuseReleasedNodes,
+		Test_HashTable_POOL_DisableNodePool,
+		Test_HashTable_POOL_LazyBucketMaterialization,
+
+		// @ HASH FINGERPRINT Test -------------------------------
+		Test_HashTable_FINGERPRINT_CacheHashInNode,
+		Test_HashTable_FINGERPRINT_SameValueWithDifferentKeys,
+		Test_HashTable_FINGERPRINT_AddUnchecked,
+
+		// @ HASH FUNCTION Test -------------------------------
+		Test_HashFunc_BundledHashFunctions,
+		Test_HashTable_HASH_NegativeIntKey,
+		Test_HashTable_HASH_RegisterHashFunction,
+		Test_HashTable_HASH_StringKeyDistribution,
+
+		// @ POWER OF TWO BUCKET Test -------------------------------
+		Test_HashTable_POW2_RoundUpBucketCount,
+		Test_HashTable_POW2_SpreadSequentialAndStridedKeys,
+		Test_HashTable_POW2_GrowWithNegativeKeys,
+
+		// @ OCCUPIED BUCKET BITMAP Test -------------------------------
+		Test_HashTable_BITMAP_TrackOccupiedBuckets,
+		Test_HashTable_BITMAP_DrainSparseTable,
+
+		// @ POP Test -------------------------------
+		Test_HashTable_POP_PopFirstAndPopLast,
+		Test_HashTable_POP_PopDuringRehash,
+		Test_HashTable_POP_OpenAddressing,
+
+		// @ CONCURRENT Test -------------------------------
+		Test_HashTable_CONCURRENT_CreateWithLockOption,
+		Test_HashTable_CONCURRENT_ParallelAddFindDelete,
+		Test_HashTable_CONCURRENT_ParallelPop,
+
+		// @ LOCK FREE READ Test -------------------------------
+		Test_HashTable_LOCKFREE_CreateWithLockFreeRead,
+		Test_HashTable_LOCKFREE_RetireAndReclaimNodes,
+		Test_HashTable_LOCKFREE_ReadersWithWriter,
+		Test_HashTable_LOCKFREE_ReuseReleasedThreadState,
+
+		// @ SHARDED Test -------------------------------
+		Test_HashTable_SHARDED_CreateAndRoute,
+		Test_HashTable_SHARDED_StringKeys,
+		Test_HashTable_SHARDED_ParallelAddFindDelete,
+		Test_HashTable_SHARDED_CountContention,
+
+		// @ LOCK FREE BUCKET Test -------------------------------
+		Test_HashTable_LFBUCKET_CreateAndBasicOperations,
+		Test_HashTable_LFBUCKET_RetireAndReclaimNodes,
+		Test_HashTable_LFBUCKET_ParallelAddFindDelete,
+		Test_HashTable_LFBUCKET_ParallelPop,
+		Test_HashTable_LFBUCKET_SameKeysFromAllThreads,
+
+		// @ CONCURRENT RESIZE Test -------------------------------
+		Test_HashTable_CRESIZE_CreateAndGrow,
+		Test_HashTable_CRESIZE_ParallelGrowth,
+		Test_HashTable_CRESIZE_PopWhileGrowing,
+
+		// @ PARALLEL BUILD Test -------------------------------
+		Test_HashTable_BUILD_MatchSequentialAdd,
+		Test_HashTable_BUILD_InvalidPairsAndSerialFallback,
+		Test_HashTable_BUILD_ConcurrentTable,
+
+		// @ FOREACH Test -------------------------------
+		Test_HashTable_FOREACH_VisitAllStorages,
+		Test_HashTable_FOREACH_ParallelWithWorkPool,
+		Test_HashTable_FOREACH_ReadInsideVisitor,
+
+		// @ // @ INSERT BUFFER Test -------------------------------
+		Test_HashTable_INSERTBUFFER_AddAndFlushBySize,
+		Test_HashTable_INSERTBUFFER_GroupByLockStripe,
+		Test_HashTable_INSERTBUFFER_FlushByDelay,
+		Test_HashTable_INSERTBUFFER_ParallelBuffers,
+
+		// @ // @ // @ FIND BATCH Test -------------------------------
+		Test_HashTable_FINDBATCH_FindKeysAndValues,
+		Test_HashTable_FINDBATCH_PrefetchDistance,
+		Test_HashTable_FINDBATCH_ChainWhileRehashing,
+		Test_HashTable_FINDBATCH_OtherStorages,
+
+		// @ // @ // @ ADD BATCH Test -------------------------------
+		Test_HashTable_ADDBATCH_AddAndReport,
+		Test_HashTable_ADDBATCH_MatchesAddData,
+		Test_HashTable_ADDBATCH_SmallBatchDuringRehash,
+		Test_HashTable_ADDBATCH_GroupByLockStripe,
+		Test_HashTable_ADDBATCH_ParallelBatches,
+
+		// @ // @ // @ UPSERT Test -------------------------------
+		Test_HashTable_UPSERT_GetOrInsert,
+		Test_HashTable_UPSERT_Upsert,
+		Test_HashTable_UPSERT_AllStorages,
+		Test_HashTable_UPSERT_ConcurrentGetOrInsert,
+
+		// @ // @ // @ ITER Test -------------------------------
+		Test_HashTable_ITER_EmptyAndBadArgs,
+		Test_HashTable_ITER_ScanDuringRehash,
+		Test_HashTable_ITER_AllStorages,
+
+		// @ // @ // @ HANDLE Test -------------------------------
+		Test_HashTable_HANDLE_FindAndErase,
+		Test_HashTable_HANDLE_EraseAfterRehash,
+		Test_HashTable_HANDLE_EraseAfterUpsert,
+
+		// @ // @ // @ CLEAR Test -------------------------------
+		Test_HashTable_CLEAR_ClearEmptyAndBadArgs,
+		Test_HashTable_CLEAR_ReusePoolNodes,
+		Test_HashTable_CLEAR_AllStorages
     );
 
     RUN_ALL_TESTS();